@@ -0,0 +1,423 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA__CMATH_SIMD_KERNELS_H
+#define _CUDA__CMATH_SIMD_KERNELS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cmath>
+#include <cuda/std/cstdint>
+#include <cuda/std/detail/libcxx/include/cstring>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+namespace __detail
+{
+
+// Element kernels for the batched math functions on the host. They have no
+// branches and no calls, so that compilers vectorize the loops which apply
+// them to arrays. They assume finite arguments in a range which is checked
+// by the callers, outside of it the callers fall back to the scalar functions
+// of cuda::std. Within the range the results are within a few ulp of the
+// correctly rounded ones.
+//
+// The polynomials are the Taylor series of the functions, truncated after the
+// first term which is below half an ulp on the reduced range.
+
+template <class _Tp>
+struct __simd_math_traits;
+
+template <>
+struct __simd_math_traits<float>
+{
+  using __int_t  = int32_t;
+  using __uint_t = uint32_t;
+
+  static constexpr int __mantissa_bits  = 23;
+  static constexpr __int_t __bias       = 127;
+  static constexpr int __subnormal_bits = 25;
+
+  // adding and subtracting it rounds to an integer, which is left in the low
+  // bits of the sum
+  static constexpr float __round_magic = 12582912.0f;
+
+  static constexpr float __min_normal     = 1.17549435e-38f;
+  static constexpr float __subnormal_unit = 33554432.0f;
+
+  static constexpr float __log2e  = 1.44269504088896341f;
+  static constexpr float __ln2_hi = 0.693359375f;
+  static constexpr float __ln2_lo = -2.12194440e-4f;
+  static constexpr float __sqrt2  = 1.41421356237309505f;
+
+  // exp overflows above and underflows below these
+  static constexpr float __exp_max = 89.0f;
+  static constexpr float __exp_min = -104.0f;
+
+  static constexpr float __two_over_pi = 0.636619772367581343f;
+  // pi / 2 in four parts, the first three of 12 bits so that their products
+  // with the quadrant are exact up to __trig_max
+  static constexpr float __pio2_1   = 1.57080078125f;
+  static constexpr float __pio2_2   = -4.453584551811218e-06f;
+  static constexpr float __pio2_3   = -8.706138032721356e-10f;
+  static constexpr float __pio2_4   = 6.223371969669989e-14f;
+  static constexpr float __trig_max = 6400.0f;
+
+  static constexpr float __pi      = 3.14159265358979324f;
+  static constexpr float __pi_2    = 1.57079632679489662f;
+  static constexpr float __pi_4    = 0.785398163397448310f;
+  static constexpr float __tan_pi8 = 0.414213562373095049f;
+
+  // the magnitudes of complex arguments whose squared norm neither overflows
+  // nor loses precision
+  static constexpr float __norm_min = 8.67361738e-19f;
+  static constexpr float __norm_max = 1.15292150e18f;
+};
+
+template <>
+struct __simd_math_traits<double>
+{
+  using __int_t  = int64_t;
+  using __uint_t = uint64_t;
+
+  static constexpr int __mantissa_bits  = 52;
+  static constexpr __int_t __bias       = 1023;
+  static constexpr int __subnormal_bits = 54;
+
+  static constexpr double __round_magic = 6755399441055744.0;
+
+  static constexpr double __min_normal     = 2.2250738585072014e-308;
+  static constexpr double __subnormal_unit = 18014398509481984.0;
+
+  static constexpr double __log2e  = 1.44269504088896341;
+  static constexpr double __ln2_hi = 6.93147180369123816490e-01;
+  static constexpr double __ln2_lo = 1.90821492927058770002e-10;
+  static constexpr double __sqrt2  = 1.41421356237309505;
+
+  static constexpr double __exp_max = 710.0;
+  static constexpr double __exp_min = -746.0;
+
+  static constexpr double __two_over_pi = 0.636619772367581343;
+  // the first three parts of 33 bits, as in fdlibm
+  static constexpr double __pio2_1      = 1.57079632673412561417e+00;
+  static constexpr double __pio2_2      = 6.07710050630396597660e-11;
+  static constexpr double __pio2_3      = 2.02226624871116645580e-21;
+  static constexpr double __pio2_4      = 8.47842766036889956997e-32;
+  static constexpr double __trig_max    = 1.0e6;
+
+  static constexpr double __pi      = 3.14159265358979324;
+  static constexpr double __pi_2    = 1.57079632679489662;
+  static constexpr double __pi_4    = 0.785398163397448310;
+  static constexpr double __tan_pi8 = 0.414213562373095049;
+
+  static constexpr double __norm_min = 3.0549363634996047e-151;
+  static constexpr double __norm_max = 3.2733906078961419e150;
+};
+
+template <class _Tp>
+_CCCL_HOST inline typename __simd_math_traits<_Tp>::__int_t __simd_to_bits(_Tp __x)
+{
+  typename __simd_math_traits<_Tp>::__int_t __bits;
+  _CUDA_VSTD::memcpy(&__bits, &__x, sizeof(__x));
+  return __bits;
+}
+
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_from_bits(typename __simd_math_traits<_Tp>::__int_t __bits)
+{
+  _Tp __x;
+  _CUDA_VSTD::memcpy(&__x, &__bits, sizeof(__x));
+  return __x;
+}
+
+// __c0 + __x * (__c1 + __x * (...))
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_horner(_Tp, double __c0)
+{
+  return static_cast<_Tp>(__c0);
+}
+
+template <class _Tp, class... _Coefficients>
+_CCCL_HOST inline _Tp __simd_horner(_Tp __x, double __c0, _Coefficients... __cs)
+{
+  return static_cast<_Tp>(__c0) + __x * __simd_horner(__x, __cs...);
+}
+
+// rounds __x to the nearest integer, which is returned as a floating point
+// number and in __n
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_round(_Tp __x, typename __simd_math_traits<_Tp>::__int_t& __n)
+{
+  using __traits     = __simd_math_traits<_Tp>;
+  const _Tp __magic  = __traits::__round_magic;
+  const _Tp __biased = __x + __magic;
+  __n                = __simd_to_bits(__biased) - __simd_to_bits(__magic);
+  return __biased - __magic;
+}
+
+// 2 to the __n, for __n in the range of the normal numbers
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_pow2(typename __simd_math_traits<_Tp>::__int_t __n)
+{
+  using __traits = __simd_math_traits<_Tp>;
+  using __int_t  = typename __traits::__int_t;
+  using __uint_t = typename __traits::__uint_t;
+  return __simd_from_bits<_Tp>(
+    static_cast<__int_t>(static_cast<__uint_t>(__n + __traits::__bias) << __traits::__mantissa_bits));
+}
+
+_CCCL_HOST inline float __simd_exp_poly(float __r)
+{
+  return __simd_horner(
+    __r, 1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040);
+}
+
+_CCCL_HOST inline double __simd_exp_poly(double __r)
+{
+  return __simd_horner(
+    __r,
+    1.0,
+    1.0,
+    1.0 / 2,
+    1.0 / 6,
+    1.0 / 24,
+    1.0 / 120,
+    1.0 / 720,
+    1.0 / 5040,
+    1.0 / 40320,
+    1.0 / 362880,
+    1.0 / 3628800,
+    1.0 / 39916800,
+    1.0 / 479001600,
+    1.0 / 6227020800);
+}
+
+// exp(__x) for any __x but NaN: __x = n * ln(2) + r with |r| <= ln(2) / 2,
+// exp(__x) = 2^n * exp(r)
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_exp(_Tp __x)
+{
+  using __traits   = __simd_math_traits<_Tp>;
+  using __int_t    = typename __traits::__int_t;
+  const _Tp __max  = __traits::__exp_max;
+  const _Tp __min  = __traits::__exp_min;
+  const _Tp __hi   = __traits::__ln2_hi;
+  const _Tp __lo   = __traits::__ln2_lo;
+  const _Tp __l2e  = __traits::__log2e;
+  const _Tp __xc   = __x > __max ? __max : (__x < __min ? __min : __x);
+  __int_t __n      = 0;
+  const _Tp __nf   = __simd_round(__xc * __l2e, __n);
+  const _Tp __r    = (__xc - __nf * __hi) - __nf * __lo;
+  const __int_t __n1 = __n >> 1;
+  // two steps, so that neither factor leaves the normal range
+  return __simd_exp_poly(__r) * __simd_pow2<_Tp>(__n1) * __simd_pow2<_Tp>(__n - __n1);
+}
+
+// the series of atanh(s) / s - 1, divided by s^2
+_CCCL_HOST inline float __simd_log_poly(float __z)
+{
+  return __simd_horner(__z, 1.0 / 3, 1.0 / 5, 1.0 / 7, 1.0 / 9, 1.0 / 11);
+}
+
+_CCCL_HOST inline double __simd_log_poly(double __z)
+{
+  return __simd_horner(
+    __z,
+    1.0 / 3,
+    1.0 / 5,
+    1.0 / 7,
+    1.0 / 9,
+    1.0 / 11,
+    1.0 / 13,
+    1.0 / 15,
+    1.0 / 17,
+    1.0 / 19,
+    1.0 / 21,
+    1.0 / 23,
+    1.0 / 25);
+}
+
+// log(__x) for finite __x > 0: __x = 2^e * m with sqrt(1/2) <= m < sqrt(2),
+// log(__x) = e * ln(2) + log(1 + f) with f = m - 1 and s = f / (2 + f),
+// log(1 + f) = 2 * atanh(s) = f - (f^2 / 2 - s * (f^2 / 2 + R)) where the
+// correction R is small against f, as in fdlibm
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_log(_Tp __x)
+{
+  using __traits        = __simd_math_traits<_Tp>;
+  using __int_t         = typename __traits::__int_t;
+  const _Tp __min       = __traits::__min_normal;
+  const _Tp __unit      = __traits::__subnormal_unit;
+  const _Tp __sqrt2     = __traits::__sqrt2;
+  const _Tp __hi        = __traits::__ln2_hi;
+  const _Tp __lo        = __traits::__ln2_lo;
+  const __int_t __bits  = __traits::__mantissa_bits;
+  const __int_t __bias  = __traits::__bias;
+  const __int_t __shift = __traits::__subnormal_bits;
+  const __int_t __mask  = (__int_t(1) << __bits) - 1;
+
+  // subnormal numbers are scaled into the normal range first. The selections
+  // are between constants, so that no operation depends on a condition and
+  // compilers can vectorize without speculating floating point operations.
+  const bool __subnormal = __x < __min;
+  const __int_t __i      = __simd_to_bits(__x * (__subnormal ? __unit : _Tp(1)));
+  const __int_t __e      = (__i >> __bits) - __bias - (__subnormal ? __shift : 0);
+  const _Tp __m          = __simd_from_bits<_Tp>((__i & __mask) | (__bias << __bits));
+  const bool __large     = __m > __sqrt2;
+  const _Tp __mr         = __m * (__large ? _Tp(0.5) : _Tp(1));
+  const _Tp __ef         = static_cast<_Tp>(__e + (__large ? 1 : 0));
+
+  const _Tp __f    = __mr - _Tp(1);
+  const _Tp __s    = __f / (_Tp(2) + __f);
+  const _Tp __z    = __s * __s;
+  const _Tp __R    = _Tp(2) * __z * __simd_log_poly(__z);
+  const _Tp __hfsq = _Tp(0.5) * __f * __f;
+  return __ef * __hi + ((__f - (__hfsq - __s * (__hfsq + __R))) + __ef * __lo);
+}
+
+_CCCL_HOST inline float __simd_sin_poly(float __z)
+{
+  return __simd_horner(__z, 1.0, -1.0 / 6, 1.0 / 120, -1.0 / 5040, 1.0 / 362880);
+}
+
+_CCCL_HOST inline double __simd_sin_poly(double __z)
+{
+  return __simd_horner(
+    __z,
+    1.0,
+    -1.0 / 6,
+    1.0 / 120,
+    -1.0 / 5040,
+    1.0 / 362880,
+    -1.0 / 39916800,
+    1.0 / 6227020800,
+    -1.0 / 1307674368000,
+    1.0 / 355687428096000);
+}
+
+_CCCL_HOST inline float __simd_cos_poly(float __z)
+{
+  return __simd_horner(__z, 1.0, -1.0 / 2, 1.0 / 24, -1.0 / 720, 1.0 / 40320, -1.0 / 3628800);
+}
+
+_CCCL_HOST inline double __simd_cos_poly(double __z)
+{
+  return __simd_horner(
+    __z,
+    1.0,
+    -1.0 / 2,
+    1.0 / 24,
+    -1.0 / 720,
+    1.0 / 40320,
+    -1.0 / 3628800,
+    1.0 / 479001600,
+    -1.0 / 87178291200,
+    1.0 / 20922789888000,
+    -1.0 / 6402373705728000);
+}
+
+// sin(__x) and cos(__x) for |__x| <= __trig_max: __x = n * pi / 2 + r with
+// |r| <= pi / 4, the quadrant n selects the signs and which of sin(r) and
+// cos(r) each of them is
+template <class _Tp>
+_CCCL_HOST inline void __simd_sincos(_Tp __x, _Tp& __sin, _Tp& __cos)
+{
+  using __traits  = __simd_math_traits<_Tp>;
+  using __int_t   = typename __traits::__int_t;
+  const _Tp __tpi = __traits::__two_over_pi;
+  const _Tp __p1  = __traits::__pio2_1;
+  const _Tp __p2  = __traits::__pio2_2;
+  const _Tp __p3  = __traits::__pio2_3;
+  const _Tp __p4  = __traits::__pio2_4;
+
+  __int_t __n    = 0;
+  const _Tp __nf = __simd_round(__x * __tpi, __n);
+  // without a reduction __r is __x itself; taking it as is keeps the sign of a zero, which the negative parts of
+  // pi/2 would otherwise turn into +0
+  const _Tp __r  = __n == 0 ? __x : (((__x - __nf * __p1) - __nf * __p2) - __nf * __p3) - __nf * __p4;
+  const _Tp __z  = __r * __r;
+  const _Tp __sr = __r * __simd_sin_poly(__z);
+  const _Tp __cr = __simd_cos_poly(__z);
+
+  const bool __swap = (__n & 1) != 0;
+  const _Tp __s     = __swap ? __cr : __sr;
+  const _Tp __c     = __swap ? __sr : __cr;
+  __sin             = (__n & 2) != 0 ? -__s : __s;
+  __cos             = ((__n + 1) & 2) != 0 ? -__c : __c;
+}
+
+_CCCL_HOST inline float __simd_atan_poly(float __z)
+{
+  return __simd_horner(
+    __z, 1.0, -1.0 / 3, 1.0 / 5, -1.0 / 7, 1.0 / 9, -1.0 / 11, 1.0 / 13, -1.0 / 15, 1.0 / 17);
+}
+
+_CCCL_HOST inline double __simd_atan_poly(double __z)
+{
+  return __simd_horner(
+    __z,
+    1.0,
+    -1.0 / 3,
+    1.0 / 5,
+    -1.0 / 7,
+    1.0 / 9,
+    -1.0 / 11,
+    1.0 / 13,
+    -1.0 / 15,
+    1.0 / 17,
+    -1.0 / 19,
+    1.0 / 21,
+    -1.0 / 23,
+    1.0 / 25,
+    -1.0 / 27,
+    1.0 / 29,
+    -1.0 / 31,
+    1.0 / 33,
+    -1.0 / 35,
+    1.0 / 37,
+    -1.0 / 39);
+}
+
+// atan2(__y, __x) for finite __x and __y which are not both zero: the ratio
+// t of the smaller to the larger magnitude is in [0, 1], above tan(pi / 8)
+// atan(t) = pi / 4 + atan((t - 1) / (t + 1)), so that the series is only
+// evaluated on [-tan(pi / 8), tan(pi / 8)]
+template <class _Tp>
+_CCCL_HOST inline _Tp __simd_atan2(_Tp __y, _Tp __x)
+{
+  using __traits      = __simd_math_traits<_Tp>;
+  const _Tp __pi      = __traits::__pi;
+  const _Tp __pi_2    = __traits::__pi_2;
+  const _Tp __pi_4    = __traits::__pi_4;
+  const _Tp __tan_pi8 = __traits::__tan_pi8;
+
+  const _Tp __ax      = _CUDA_VSTD::fabs(__x);
+  const _Tp __ay      = _CUDA_VSTD::fabs(__y);
+  const bool __steep  = __ay > __ax;
+  const _Tp __t       = __steep ? __ax / __ay : __ay / __ax;
+  const bool __reduce = __t > __tan_pi8;
+  const _Tp __u       = __reduce ? (__t - _Tp(1)) / (__t + _Tp(1)) : __t;
+  const _Tp __a       = (__reduce ? __pi_4 : _Tp(0)) + __u * __simd_atan_poly(__u * __u);
+  const _Tp __b       = __steep ? __pi_2 - __a : __a;
+  const _Tp __c       = __x < _Tp(0) ? __pi - __b : __b;
+  return _CUDA_VSTD::copysign(__c, __y);
+}
+
+} // namespace __detail
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CUDA__CMATH_SIMD_KERNELS_H
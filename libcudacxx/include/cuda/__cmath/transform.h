@@ -0,0 +1,314 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA__CMATH_TRANSFORM_H
+#define _CUDA__CMATH_TRANSFORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/simd_kernels.h>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/span>
+
+#if _CCCL_STD_VER >= 2014
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+namespace __detail
+{
+
+// Applies __kernel to [__in, __in + __n) and writes the results to __out,
+// except for the elements for which __special is true, which get the result
+// of __scalar instead. The blocks are applied to a buffer first, so that
+// __out may be __in, and the loop which applies __kernel vectorizes. The
+// __special predicates combine their conditions with & rather than &&, the
+// branches of && keep that loop from vectorizing.
+template <class _Tp, class _Kernel, class _Special, class _Scalar>
+_CCCL_HOST void
+__simd_transform(const _Tp* __in, _Tp* __out, size_t __n, _Kernel __kernel, _Special __special, _Scalar __scalar)
+{
+  constexpr size_t __block = 256;
+  _Tp __buf[__block];
+
+  for (size_t __first = 0; __first < __n; __first += __block)
+  {
+    const size_t __count = __n - __first < __block ? __n - __first : __block;
+    const _Tp* __src     = __in + __first;
+    _Tp* __dst           = __out + __first;
+
+    int __any = 0;
+    for (size_t __i = 0; __i < __count; ++__i)
+    {
+      __buf[__i] = __kernel(__src[__i]);
+      __any |= __special(__src[__i]) ? 1 : 0;
+    }
+
+    if (__any == 0)
+    {
+      for (size_t __i = 0; __i < __count; ++__i)
+      {
+        __dst[__i] = __buf[__i];
+      }
+    }
+    else
+    {
+      for (size_t __i = 0; __i < __count; ++__i)
+      {
+        __dst[__i] = __special(__src[__i]) ? __scalar(__src[__i]) : __buf[__i];
+      }
+    }
+  }
+}
+
+template <class _Tp>
+_CCCL_HOST void __simd_transform_exp(const _Tp* __in, _Tp* __out, size_t __n)
+{
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](_Tp __x) {
+      return __simd_exp(__x);
+    },
+    [](_Tp __x) {
+      return __x != __x;
+    },
+    [](_Tp __x) {
+      return __x;
+    });
+}
+
+template <class _Tp>
+_CCCL_HOST void __simd_transform_log(const _Tp* __in, _Tp* __out, size_t __n)
+{
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](_Tp __x) {
+      return __simd_log(__x);
+    },
+    [](_Tp __x) {
+      return !((__x > _Tp(0)) & (__x <= _CUDA_VSTD::numeric_limits<_Tp>::max()));
+    },
+    [](_Tp __x) {
+      return _CUDA_VSTD::log(__x);
+    });
+}
+
+template <class _Tp>
+_CCCL_HOST void __simd_transform_sin(const _Tp* __in, _Tp* __out, size_t __n)
+{
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](_Tp __x) {
+      _Tp __s, __c;
+      __simd_sincos(__x, __s, __c);
+      return __s;
+    },
+    [](_Tp __x) {
+      return !(_CUDA_VSTD::fabs(__x) <= __simd_math_traits<_Tp>::__trig_max);
+    },
+    [](_Tp __x) {
+      return _CUDA_VSTD::sin(__x);
+    });
+}
+
+template <class _Tp>
+_CCCL_HOST void __simd_transform_cos(const _Tp* __in, _Tp* __out, size_t __n)
+{
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](_Tp __x) {
+      _Tp __s, __c;
+      __simd_sincos(__x, __s, __c);
+      return __c;
+    },
+    [](_Tp __x) {
+      return !(_CUDA_VSTD::fabs(__x) <= __simd_math_traits<_Tp>::__trig_max);
+    },
+    [](_Tp __x) {
+      return _CUDA_VSTD::cos(__x);
+    });
+}
+
+// sqrt is a single instruction already, which keeps the loop simple
+template <class _Tp>
+_CCCL_HOST void __simd_transform_sqrt(const _Tp* __in, _Tp* __out, size_t __n)
+{
+  for (size_t __i = 0; __i < __n; ++__i)
+  {
+    __out[__i] = _CUDA_VSTD::sqrt(__in[__i]);
+  }
+}
+
+// exp(a + bi) = exp(a) * (cos(b) + sin(b) i), the scalar function handles
+// arguments whose exponential overflows before it is scaled by cos(b) or sin(b)
+template <class _Tp>
+_CCCL_HOST void __simd_transform_exp(const _CUDA_VSTD::complex<_Tp>* __in, _CUDA_VSTD::complex<_Tp>* __out, size_t __n)
+{
+  using __complex_t = _CUDA_VSTD::complex<_Tp>;
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](const __complex_t& __z) {
+      const _Tp __e = __simd_exp(__z.real());
+      _Tp __s, __c;
+      __simd_sincos(__z.imag(), __s, __c);
+      return __complex_t(__e * __c, __e * __s);
+    },
+    [](const __complex_t& __z) {
+      return !((__z.real() <= __simd_math_traits<_Tp>::__exp_max - _Tp(2))
+               & (__z.real() >= __simd_math_traits<_Tp>::__exp_min)
+               & (_CUDA_VSTD::fabs(__z.imag()) <= __simd_math_traits<_Tp>::__trig_max));
+    },
+    [](const __complex_t& __z) {
+      return _CUDA_VSTD::exp(__z);
+    });
+}
+
+// true unless the squared magnitude of __z can be computed without overflow
+// or loss of precision, which is also the case for zero and non finite parts
+template <class _Tp>
+_CCCL_HOST bool __simd_complex_out_of_range(const _CUDA_VSTD::complex<_Tp>& __z)
+{
+  const _Tp __ax = _CUDA_VSTD::fabs(__z.real());
+  const _Tp __ay = _CUDA_VSTD::fabs(__z.imag());
+  const _Tp __m  = __ax > __ay ? __ax : __ay;
+  // written so that a NaN in either part makes it true
+  return !((__m >= __simd_math_traits<_Tp>::__norm_min) & (__ax <= __simd_math_traits<_Tp>::__norm_max)
+           & (__ay <= __simd_math_traits<_Tp>::__norm_max));
+}
+
+// log(a + bi) = log(a^2 + b^2) / 2 + atan2(b, a) i
+template <class _Tp>
+_CCCL_HOST void __simd_transform_log(const _CUDA_VSTD::complex<_Tp>* __in, _CUDA_VSTD::complex<_Tp>* __out, size_t __n)
+{
+  using __complex_t = _CUDA_VSTD::complex<_Tp>;
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](const __complex_t& __z) {
+      const _Tp __a = __z.real();
+      const _Tp __b = __z.imag();
+      return __complex_t(_Tp(0.5) * __simd_log(__a * __a + __b * __b), __simd_atan2(__b, __a));
+    },
+    [](const __complex_t& __z) {
+      return __simd_complex_out_of_range(__z);
+    },
+    [](const __complex_t& __z) {
+      return _CUDA_VSTD::log(__z);
+    });
+}
+
+// with t = sqrt((|a + bi| + |a|) / 2), sqrt(a + bi) is t + b / (2 t) i for
+// a >= 0 and |b| / (2 t) + copysign(t, b) i otherwise
+template <class _Tp>
+_CCCL_HOST void
+__simd_transform_sqrt(const _CUDA_VSTD::complex<_Tp>* __in, _CUDA_VSTD::complex<_Tp>* __out, size_t __n)
+{
+  using __complex_t = _CUDA_VSTD::complex<_Tp>;
+  __simd_transform(
+    __in,
+    __out,
+    __n,
+    [](const __complex_t& __z) {
+      const _Tp __a = __z.real();
+      const _Tp __b = __z.imag();
+      const _Tp __r = _CUDA_VSTD::sqrt(__a * __a + __b * __b);
+      const _Tp __t = _CUDA_VSTD::sqrt((__r + _CUDA_VSTD::fabs(__a)) * _Tp(0.5));
+      const _Tp __u = __b / (_Tp(2) * __t);
+      return __a >= _Tp(0) ? __complex_t(__t, __u) : __complex_t(_CUDA_VSTD::fabs(__u), _CUDA_VSTD::copysign(__t, __b));
+    },
+    [](const __complex_t& __z) {
+      return __simd_complex_out_of_range(__z);
+    },
+    [](const __complex_t& __z) {
+      return _CUDA_VSTD::sqrt(__z);
+    });
+}
+
+} // namespace __detail
+
+// Batched math functions
+//
+// transform_exp, transform_log, transform_sin, transform_cos and
+// transform_sqrt write the function of every element of __in to the element
+// of __out at the same position. They exist for float and double and, except
+// for sin and cos, for complex<float> and complex<double>. __out must have at
+// least as many elements as __in, and the two must either be the same range or
+// not overlap.
+//
+// On the host the loops over the elements vectorize: the functions are
+// evaluated by branch free kernels which agree with the scalar functions of
+// cuda::std to within a few ulp, and the elements outside of the range of the
+// kernels, e.g. infinities, NaNs or very large arguments of sin and cos, are
+// computed by the scalar functions. The complex logarithm loses relative
+// precision in its real part for arguments very close to the unit circle.
+// The loops vectorize where the compiler's vectorizer runs, e.g. with -O3 or
+// -ftree-vectorize for GCC, and sqrt only if the compiler does not need to
+// set errno, e.g. with -fno-math-errno. On the device the scalar functions
+// are applied to every element.
+
+#  define _LIBCUDACXX_BATCHED_MATH_FUNCTION(__name, __type)                                            \
+    _LIBCUDACXX_INLINE_VISIBILITY inline void transform_##__name(                                      \
+      _CUDA_VSTD::span<const __type> __in, _CUDA_VSTD::span<__type> __out)                             \
+    {                                                                                                  \
+      _LIBCUDACXX_ASSERT(__out.size() >= __in.size(), "transform_" #__name " requires enough output"); \
+      NV_IF_ELSE_TARGET(                                                                               \
+        NV_IS_HOST,                                                                                    \
+        (__detail::__simd_transform_##__name(__in.data(), __out.data(), __in.size());),                \
+        (for (size_t __i = 0; __i < __in.size(); ++__i) { __out[__i] = _CUDA_VSTD::__name(__in[__i]); })) \
+    }
+
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(exp, float)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(exp, double)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(exp, _CUDA_VSTD::complex<float>)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(exp, _CUDA_VSTD::complex<double>)
+
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(log, float)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(log, double)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(log, _CUDA_VSTD::complex<float>)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(log, _CUDA_VSTD::complex<double>)
+
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sin, float)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sin, double)
+
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(cos, float)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(cos, double)
+
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sqrt, float)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sqrt, double)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sqrt, _CUDA_VSTD::complex<float>)
+_LIBCUDACXX_BATCHED_MATH_FUNCTION(sqrt, _CUDA_VSTD::complex<double>)
+
+#  undef _LIBCUDACXX_BATCHED_MATH_FUNCTION
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER >= 2014
+
+#endif // _CUDA__CMATH_TRANSFORM_H
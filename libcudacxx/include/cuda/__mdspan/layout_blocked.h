@@ -0,0 +1,404 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_LAYOUT_BLOCKED_H
+#define _CUDA___MDSPAN_LAYOUT_BLOCKED_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/full_extent_t.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__mdspan/mdspan.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/detail/libcxx/include/__assert>
+#include <cuda/std/tuple>
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+/// \brief Layout policy which splits the index space into tiles of the static
+/// extents \c _TileExtents...
+///
+/// Elements are stored row-major within a tile and the tiles themselves are
+/// stored row-major, so every tile occupies a contiguous chunk of
+/// \c (_TileExtents * ...) elements. Extents which are not a multiple of the
+/// tile extent are padded up to the next full tile.
+template <size_t... _TileExtents>
+struct layout_blocked
+{
+  static_assert(__MDSPAN_FOLD_AND((_TileExtents > 0) /* && ... */), "layout_blocked requires non-zero tile extents");
+
+  template <class _Extents>
+  class mapping;
+};
+
+template <size_t... _TileExtents>
+template <class _Extents>
+class layout_blocked<_TileExtents...>::mapping
+{
+public:
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_blocked<_TileExtents...>;
+
+private:
+  static_assert(_CUDA_VSTD::__detail::__is_extents_v<extents_type>,
+                "layout_blocked::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+  static_assert(sizeof...(_TileExtents) == extents_type::rank(),
+                "layout_blocked requires one tile extent per rank of the extents.");
+
+  template <class>
+  friend class mapping;
+
+  using __tile_strides_type = _CUDA_VSTD::array<index_type, extents_type::rank()>;
+  using __rank_sequence     = _CUDA_VSTD::make_index_sequence<extents_type::rank()>;
+
+  template <size_t _Np>
+  _CCCL_HOST_DEVICE static constexpr index_type __tile_extent() noexcept
+  {
+    return static_cast<index_type>(_CUDA_VSTD::array<size_t, sizeof...(_TileExtents)>{{_TileExtents...}}[_Np]);
+  }
+
+  // distance between consecutive elements of a tile along rank _Np
+  template <size_t _Np, size_t... _Idx>
+  _CCCL_HOST_DEVICE static constexpr index_type __intra_stride(_CUDA_VSTD::index_sequence<_Idx...>) noexcept
+  {
+    return __MDSPAN_FOLD_TIMES_RIGHT((_Idx > _Np ? __tile_extent<_Idx>() : index_type(1)), index_type(1));
+  }
+
+  template <size_t _Np>
+  _CCCL_HOST_DEVICE static constexpr index_type __grid_extent(const extents_type& __exts) noexcept
+  {
+    return static_cast<index_type>((__exts.template __extent<_Np>() + __tile_extent<_Np>() - 1) / __tile_extent<_Np>());
+  }
+
+  // tiles are packed row-major, so the stride of a tile along rank _Np is the
+  // size of a tile times the number of tiles in the faster running ranks
+  template <size_t _Np, size_t... _Idx>
+  _CCCL_HOST_DEVICE static constexpr index_type
+  __packed_tile_stride(const extents_type& __exts, _CUDA_VSTD::index_sequence<_Idx...>) noexcept
+  {
+    return __MDSPAN_FOLD_TIMES_RIGHT((_Idx > _Np ? __grid_extent<_Idx>(__exts) : index_type(1)), tile_size());
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE static constexpr __tile_strides_type
+  __packed_tile_strides(const extents_type& __exts, _CUDA_VSTD::index_sequence<_Idx...> __seq) noexcept
+  {
+    return __tile_strides_type{{__packed_tile_stride<_Idx>(__exts, __seq)...}};
+  }
+
+  template <size_t... _Idx, class... _Indices>
+  _CCCL_HOST_DEVICE constexpr index_type
+  __compute_offset(_CUDA_VSTD::index_sequence<_Idx...>, _Indices... __idxs) const noexcept
+  {
+    // The tile extents are compile time constants, so the divisions and
+    // remainders below reduce to shifts and masks for power of two tiles
+    return __MDSPAN_FOLD_PLUS_RIGHT((__idxs / __tile_extent<_Idx>() * __tile_strides[_Idx]
+                                     + __idxs % __tile_extent<_Idx>() * __intra_stride<_Idx>(__rank_sequence())),
+                                    index_type(0));
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr index_type __size(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __MDSPAN_FOLD_TIMES_RIGHT((__extents.template __extent<_Idx>()), index_type(1));
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr index_type __last_tile_offset(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __MDSPAN_FOLD_PLUS_RIGHT(((__grid_extent<_Idx>(__extents) - 1) * __tile_strides[_Idx]), index_type(0));
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _CCCL_HOST_DEVICE constexpr mapping() noexcept
+      : mapping(extents_type())
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __tile_strides(__packed_tile_strides(__exts, __rank_sequence()))
+  {}
+
+  /// \brief Constructs a mapping whose tiles are placed at the given strides,
+  /// as produced by taking a tile aligned \c submdspan of a larger mapping.
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts, __tile_strides_type const& __strides) noexcept
+      : __extents(__exts)
+      , __tile_strides(__strides)
+  {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __tile_strides(__other.template __tile_strides_as<index_type>(__rank_sequence()))
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping&
+  operator=(mapping const&) noexcept = default;
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept
+  {
+    return __size(__rank_sequence()) == 0 ? index_type(0) : __last_tile_offset(__rank_sequence()) + tile_size();
+  }
+
+  //--------------------------------------------------------------------------------
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _Indices,
+    /* requires */ (
+      (sizeof...(_Indices) == extents_type::rank())
+      && __MDSPAN_FOLD_AND((_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+                            && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices)))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __compute_offset(__rank_sequence(), static_cast<index_type>(__idxs)...);
+  }
+
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept
+  {
+    return false;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept
+  {
+    return __MDSPAN_FOLD_AND((_TileExtents == 1) /* && ... */);
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept
+  {
+    return required_span_size() == __size(__rank_sequence());
+  }
+  // The mapping is strided if every rank is either covered by a single tile or
+  // has a tile extent of one.
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept
+  {
+    return __is_strided(__rank_sequence());
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(class _Ext = _Extents,
+                             /* requires */ (_Ext::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type __r) const noexcept
+  {
+    return __stride(__r, __rank_sequence());
+  }
+
+  /// \brief Returns the number of elements of a single tile.
+  __MDSPAN_INLINE_FUNCTION static constexpr index_type tile_size() noexcept
+  {
+    return static_cast<index_type>(__MDSPAN_FOLD_TIMES_RIGHT((_TileExtents), size_t(1)));
+  }
+
+  /// \brief Returns the static tile extent of rank \c __r.
+  __MDSPAN_INLINE_FUNCTION static constexpr index_type tile_extent(rank_type __r) noexcept
+  {
+    return static_cast<index_type>(_CUDA_VSTD::array<size_t, sizeof...(_TileExtents)>{{_TileExtents...}}[__r]);
+  }
+
+  /// \brief Returns the distance between the first elements of two neighboring
+  /// tiles along rank \c __r.
+  __MDSPAN_INLINE_FUNCTION constexpr index_type tile_stride(rank_type __r) const noexcept
+  {
+    return __tile_strides[__r];
+  }
+
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents() && __lhs.__equal_strides(__rhs, __rank_sequence());
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#  endif
+
+private:
+  template <class _OtherIndexType, size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr _CUDA_VSTD::array<_OtherIndexType, extents_type::rank()>
+  __tile_strides_as(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return {{static_cast<_OtherIndexType>(__tile_strides[_Idx])...}};
+  }
+
+  template <class _OtherMapping, size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr bool
+  __equal_strides(const _OtherMapping& __other, _CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __MDSPAN_FOLD_AND((__tile_strides[_Idx] == __other.__tile_strides[_Idx]) /* && ... */);
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr bool __is_strided(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __MDSPAN_FOLD_AND((__tile_extent<_Idx>() == 1 || __grid_extent<_Idx>(__extents) <= 1) /* && ... */);
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr index_type
+  __stride(rank_type __r, _CUDA_VSTD::index_sequence<_Idx...> __seq) const noexcept
+  {
+    // only meaningful if is_strided(): a rank with a tile extent of one moves
+    // between tiles, every other rank stays within the first tile
+    return __MDSPAN_FOLD_PLUS_RIGHT(
+      ((_Idx == __r ? (__tile_extent<_Idx>() == 1 ? __tile_strides[_Idx] : __intra_stride<_Idx>(__seq))
+                    : index_type(0))),
+      index_type(0));
+  }
+
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+  __tile_strides_type __tile_strides{};
+};
+
+namespace __detail
+{
+
+_CCCL_HOST_DEVICE constexpr size_t __blocked_slice_begin(_CUDA_VSTD::full_extent_t, size_t) noexcept
+{
+  return 0;
+}
+_CCCL_HOST_DEVICE constexpr size_t
+__blocked_slice_begin(const _CUDA_VSTD::tuple<size_t, size_t>& __slice, size_t) noexcept
+{
+  return _CUDA_VSTD::get<0>(__slice);
+}
+
+_CCCL_HOST_DEVICE constexpr size_t __blocked_slice_extent(_CUDA_VSTD::full_extent_t, size_t __ext) noexcept
+{
+  return __ext;
+}
+_CCCL_HOST_DEVICE constexpr size_t
+__blocked_slice_extent(const _CUDA_VSTD::tuple<size_t, size_t>& __slice, size_t) noexcept
+{
+  return _CUDA_VSTD::get<1>(__slice) - _CUDA_VSTD::get<0>(__slice);
+}
+
+// A full_extent slice keeps the static extent, a pair of indices results in a dynamic one
+template <size_t _Extent, class _Slice>
+struct __blocked_slice_static_extent
+    : _CUDA_VSTD::integral_constant<
+        size_t,
+        _CUDA_VSTD::is_convertible<_Slice, _CUDA_VSTD::full_extent_t>::value ? _Extent : _CUDA_VSTD::dynamic_extent>
+{};
+
+template <class _ET,
+          class _IndexType,
+          size_t... _Exts,
+          size_t... _TileExtents,
+          class _AP,
+          class... _SliceSpecs,
+          size_t... _Idxs>
+_CCCL_HOST_DEVICE constexpr _CUDA_VSTD::mdspan<
+  _ET,
+  _CUDA_VSTD::extents<_IndexType, __blocked_slice_static_extent<_Exts, _SliceSpecs>::value...>,
+  layout_blocked<_TileExtents...>,
+  typename _AP::offset_policy>
+__submdspan_blocked(
+  _CUDA_VSTD::index_sequence<_Idxs...>,
+  _CUDA_VSTD::mdspan<_ET, _CUDA_VSTD::extents<_IndexType, _Exts...>, layout_blocked<_TileExtents...>, _AP> const& __src,
+  _SliceSpecs... __slices)
+{
+  using __sub_extents_type =
+    _CUDA_VSTD::extents<_IndexType, __blocked_slice_static_extent<_Exts, _SliceSpecs>::value...>;
+  using __sub_mapping_type = typename layout_blocked<_TileExtents...>::template mapping<__sub_extents_type>;
+
+  // every slice has to start at a tile boundary so that the tiles of the
+  // submdspan coincide with the tiles of the source
+  _LIBCUDACXX_ASSERT(__MDSPAN_FOLD_AND((__blocked_slice_begin(__slices, __src.extent(_Idxs)) % _TileExtents == 0)),
+                     "submdspan of layout_blocked requires tile aligned slices");
+
+  return {
+    __src.accessor().offset(
+      __src.data_handle(),
+      __src.mapping()(static_cast<_IndexType>(__blocked_slice_begin(__slices, __src.extent(_Idxs)))...)),
+    __sub_mapping_type(
+      __sub_extents_type(static_cast<_IndexType>(__blocked_slice_extent(__slices, __src.extent(_Idxs)))...),
+      {{__src.mapping().tile_stride(_Idxs)...}}),
+    typename _AP::offset_policy(__src.accessor())};
+}
+
+} // namespace __detail
+
+/// \brief Returns a view of the tiles of \c __src selected by \c __slices.
+///
+/// Each slice is either \c full_extent or a pair of indices whose first element
+/// is a multiple of the corresponding tile extent, so the result keeps the
+/// \c layout_blocked layout of the source.
+__MDSPAN_TEMPLATE_REQUIRES(
+  class _ET,
+  class _IndexType,
+  size_t... _Exts,
+  size_t... _TileExtents,
+  class _AP,
+  class... _SliceSpecs,
+  /* requires */
+  (__MDSPAN_FOLD_AND(
+     (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SliceSpecs, _CUDA_VSTD::tuple<size_t, size_t>)
+      || _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _SliceSpecs, _CUDA_VSTD::full_extent_t)) /* && ... */)
+   && sizeof...(_SliceSpecs) == sizeof...(_Exts)))
+__MDSPAN_INLINE_FUNCTION constexpr auto submdspan(
+  _CUDA_VSTD::mdspan<_ET, _CUDA_VSTD::extents<_IndexType, _Exts...>, layout_blocked<_TileExtents...>, _AP> const& __src,
+  _SliceSpecs... __slices)
+{
+  return __detail::__submdspan_blocked(_CUDA_VSTD::make_index_sequence<sizeof...(_SliceSpecs)>(), __src, __slices...);
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _CUDA___MDSPAN_LAYOUT_BLOCKED_H
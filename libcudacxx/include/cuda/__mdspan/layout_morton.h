@@ -0,0 +1,292 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___MDSPAN_LAYOUT_MORTON_H
+#define _CUDA___MDSPAN_LAYOUT_MORTON_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#if _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+/// \brief Layout policy which orders elements along a Z-order (Morton) curve.
+///
+/// The offset of an element is obtained by interleaving the bits of its
+/// indices, the last index providing the least significant bit. Once the
+/// indices of a rank run out of bits, the remaining ranks are interleaved
+/// among themselves, so non-square extents do not waste storage. Every aligned
+/// power of two block of the index space is contiguous, which keeps
+/// neighboring elements close in memory along all ranks.
+struct layout_morton
+{
+  template <class _Extents>
+  class mapping;
+};
+
+namespace __detail
+{
+
+// spreads the lower 32 bits of __x so that there is a zero bit between every
+// two consecutive bits
+_CCCL_HOST_DEVICE constexpr _CUDA_VSTD::uint64_t __morton_spread2(_CUDA_VSTD::uint64_t __x) noexcept
+{
+  __x &= 0x00000000FFFFFFFFull;
+  __x = (__x | (__x << 16)) & 0x0000FFFF0000FFFFull;
+  __x = (__x | (__x << 8)) & 0x00FF00FF00FF00FFull;
+  __x = (__x | (__x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+  __x = (__x | (__x << 2)) & 0x3333333333333333ull;
+  __x = (__x | (__x << 1)) & 0x5555555555555555ull;
+  return __x;
+}
+
+// number of bits needed to represent every index of an extent
+_CCCL_HOST_DEVICE constexpr int __morton_bits(_CUDA_VSTD::uint64_t __extent) noexcept
+{
+  int __bits = 0;
+  for (_CUDA_VSTD::uint64_t __max_index = __extent <= 1 ? 0 : __extent - 1; __max_index != 0; __max_index >>= 1)
+  {
+    ++__bits;
+  }
+  return __bits;
+}
+
+} // namespace __detail
+
+template <class _Extents>
+class layout_morton::mapping
+{
+public:
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_morton;
+
+private:
+  static_assert(_CUDA_VSTD::__detail::__is_extents_v<extents_type>,
+                "layout_morton::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+
+  template <class>
+  friend class mapping;
+
+  using __bits_type     = _CUDA_VSTD::array<int, extents_type::rank()>;
+  using __indices_type  = _CUDA_VSTD::array<_CUDA_VSTD::uint64_t, extents_type::rank()>;
+  using __rank_sequence = _CUDA_VSTD::make_index_sequence<extents_type::rank()>;
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE static constexpr __bits_type
+  __make_bits(const extents_type& __exts, _CUDA_VSTD::index_sequence<_Idx...>) noexcept
+  {
+    return __bits_type{
+      {__detail::__morton_bits(static_cast<_CUDA_VSTD::uint64_t>(__exts.template __extent<_Idx>()))...}};
+  }
+
+  // Interleaves one bit of every rank which still has bits left, starting with
+  // the least significant bits and the last rank.
+  _CCCL_HOST_DEVICE constexpr index_type __encode(const __indices_type& __idx, _CUDA_VSTD::false_type) const noexcept
+  {
+    _CUDA_VSTD::uint64_t __offset = 0;
+    int __pos                     = 0;
+    for (int __bit = 0; __bit < __max_bits(); ++__bit)
+    {
+      for (size_t __r = extents_type::rank(); __r-- > 0;)
+      {
+        if (__bit < __bits[__r])
+        {
+          __offset |= ((__idx[__r] >> __bit) & 1) << __pos;
+          ++__pos;
+        }
+      }
+    }
+    return static_cast<index_type>(__offset);
+  }
+
+  // For two ranks the bits shared by both indices are interleaved with the
+  // usual bit tricks, the surplus bits of the larger rank are appended on top.
+  _CCCL_HOST_DEVICE constexpr index_type __encode(const __indices_type& __idx, _CUDA_VSTD::true_type) const noexcept
+  {
+    const int __common = __bits[0] < __bits[1] ? __bits[0] : __bits[1];
+    if (__common > 32)
+    {
+      return __encode(__idx, _CUDA_VSTD::false_type());
+    }
+    const _CUDA_VSTD::uint64_t __mask = (_CUDA_VSTD::uint64_t(1) << __common) - 1;
+    const _CUDA_VSTD::uint64_t __low =
+      __detail::__morton_spread2(__idx[1] & __mask) | (__detail::__morton_spread2(__idx[0] & __mask) << 1);
+    const _CUDA_VSTD::uint64_t __high = (__idx[0] >> __common) | (__idx[1] >> __common);
+    return static_cast<index_type>(__common == 32 ? __low : (__low | (__high << (2 * __common))));
+  }
+
+  _CCCL_HOST_DEVICE constexpr index_type __offset(const __indices_type& __idx) const noexcept
+  {
+    return __encode(__idx, _CUDA_VSTD::integral_constant<bool, extents_type::rank() == 2>());
+  }
+
+  _CCCL_HOST_DEVICE constexpr int __max_bits() const noexcept
+  {
+    int __result = 0;
+    for (size_t __r = 0; __r < extents_type::rank(); ++__r)
+    {
+      __result = __bits[__r] > __result ? __bits[__r] : __result;
+    }
+    return __result;
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr index_type __size(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __MDSPAN_FOLD_TIMES_RIGHT((__extents.template __extent<_Idx>()), index_type(1));
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr index_type __last_offset(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __offset(__indices_type{{static_cast<_CUDA_VSTD::uint64_t>(__extents.template __extent<_Idx>() - 1)...}});
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _CCCL_HOST_DEVICE constexpr mapping() noexcept
+      : mapping(extents_type())
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __bits(__make_bits(__exts, __rank_sequence()))
+  {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __bits(__other.__bits)
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping&
+  operator=(mapping const&) noexcept = default;
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept
+  {
+    return __size(__rank_sequence()) == 0 ? index_type(0) : __last_offset(__rank_sequence()) + 1;
+  }
+
+  //--------------------------------------------------------------------------------
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _Indices,
+    /* requires */ (
+      (sizeof...(_Indices) == extents_type::rank())
+      && __MDSPAN_FOLD_AND((_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+                            && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices)))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __offset(__indices_type{{static_cast<_CUDA_VSTD::uint64_t>(static_cast<index_type>(__idxs))...}});
+  }
+
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept
+  {
+    return extents_type::rank() <= 1;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept
+  {
+    return extents_type::rank() <= 1;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept
+  {
+    return required_span_size() == __size(__rank_sequence());
+  }
+  // Only one rank may contribute bits to the offset, it then has a stride of one
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept
+  {
+    int __ranks_with_bits = 0;
+    for (size_t __r = 0; __r < extents_type::rank(); ++__r)
+    {
+      __ranks_with_bits += __bits[__r] > 0 ? 1 : 0;
+    }
+    return __ranks_with_bits <= 1;
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(class _Ext = _Extents,
+                             /* requires */ (_Ext::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type) const noexcept
+  {
+    return 1;
+  }
+
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents();
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() != __rhs.extents();
+  }
+#  endif
+
+private:
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+  __bits_type __bits{};
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _CCCL_STD_VER > 2011
+
+#endif // _CUDA___MDSPAN_LAYOUT_MORTON_H
@@ -277,6 +277,164 @@ inline _CCCL_HOST_DEVICE void atomic_signal_fence(memory_order __m)
   std::atomic_signal_fence(__m);
 }
 
+// atomic_reduce_add
+
+// Adds __op to the value of __a like fetch_add, but relaxed by default and
+// without returning the previous value, which lets the compilers emit
+// reductions, e.g. red instead of atom on devices and lock add instead of
+// lock xadd on x86.
+template <class _Tp, int _Sco, class _Base>
+_CCCL_HOST_DEVICE void atomic_reduce_add(std::__atomic_base<_Tp, _Sco, _Base>& __a,
+                                         std::__type_identity_t<_Tp> __op,
+                                         memory_order __m = memory_order_relaxed) noexcept
+{
+  (void) __a.fetch_add(__op, __m);
+}
+
+template <class _Tp, int _Sco, class _Base>
+_CCCL_HOST_DEVICE void atomic_reduce_add(std::__atomic_base_ref<_Tp, _Sco, _Base> const& __a,
+                                         std::__type_identity_t<_Tp> __op,
+                                         memory_order __m = memory_order_relaxed) noexcept
+{
+  (void) __a.fetch_add(__op, __m);
+}
+
+#if !defined(_LIBCUDACXX_HAS_NO_THREADS)
+
+// sharded_counter
+
+// A counter for many threads which add to it at once. It keeps _Shards
+// partial sums on cache lines of their own and every thread adds to the
+// shard of its slot: host threads are spread over the shards by a hash,
+// device threads use the shard of their SM. Reading the counter sums up all
+// shards, so it pays off when it is read much less often than it is updated.
+//
+// The additions are relaxed. load() observes every addition which happens
+// before it, a load concurrent with additions observes any subset of them.
+template <class _Tp, size_t _Shards = 32, thread_scope _Sco = thread_scope::thread_scope_system>
+class sharded_counter
+{
+  static_assert(std::is_arithmetic<_Tp>::value && !std::is_same<_Tp, bool>::value,
+                "sharded_counter requires an arithmetic value type");
+  static_assert(_Shards > 0, "sharded_counter requires at least one shard");
+
+  struct alignas(64) __shard_t
+  {
+    std::__atomic_base<_Tp, _Sco> __value;
+  };
+
+  __shard_t __shards[_Shards];
+
+public:
+  using value_type = _Tp;
+
+  _CCCL_HOST_DEVICE sharded_counter() noexcept
+      : sharded_counter(_Tp())
+  {}
+
+  _CCCL_HOST_DEVICE explicit sharded_counter(_Tp __initial) noexcept
+  {
+    for (size_t __i = 0; __i < _Shards; ++__i)
+    {
+      __shards[__i].__value.store(__i == 0 ? __initial : _Tp(), memory_order_relaxed);
+    }
+  }
+
+  sharded_counter(const sharded_counter&)            = delete;
+  sharded_counter& operator=(const sharded_counter&) = delete;
+
+  _CCCL_HOST_DEVICE static constexpr size_t shards() noexcept
+  {
+    return _Shards;
+  }
+
+  _CCCL_HOST_DEVICE void add(_Tp __op) noexcept
+  {
+    atomic_reduce_add(__shards[std::__libcpp_thread_slot(_Shards)].__value, __op);
+  }
+
+  _CCCL_HOST_DEVICE void sub(_Tp __op) noexcept
+  {
+    (void) __shards[std::__libcpp_thread_slot(_Shards)].__value.fetch_sub(__op, memory_order_relaxed);
+  }
+
+  _CCCL_HOST_DEVICE _Tp load(memory_order __m = memory_order_relaxed) const noexcept
+  {
+    _Tp __sum = _Tp();
+    for (size_t __i = 0; __i < _Shards; ++__i)
+    {
+      __sum += __shards[__i].__value.load(__m);
+    }
+    return __sum;
+  }
+
+  // Sets the counter to zero and returns its value before. Every addition
+  // is either part of the returned value or stays in the counter.
+  _CCCL_HOST_DEVICE _Tp reset(memory_order __m = memory_order_relaxed) noexcept
+  {
+    _Tp __sum = _Tp();
+    for (size_t __i = 0; __i < _Shards; ++__i)
+    {
+      __sum += __shards[__i].__value.exchange(_Tp(), __m);
+    }
+    return __sum;
+  }
+};
+
+// wait_policy
+
+// How a host thread waits in atomic::wait, barrier, latch and
+// counting_semaphore while the condition it waits for does not hold yet.
+enum class wait_kind : int
+{
+  // polls spin_count times, then parks (the default)
+  spin_then_park = static_cast<int>(std::__libcpp_wait_kind::__spin_then_park),
+  // polls until the condition holds and never parks, for latency critical
+  // threads which have a core of their own
+  spin = static_cast<int>(std::__libcpp_wait_kind::__spin),
+  // parks right away, for threads which should not take CPU time from others
+  park = static_cast<int>(std::__libcpp_wait_kind::__park),
+  // polls for about twice as long as the recent waits of the thread which
+  // ended while polling, but at most spin_count times, then parks
+  adaptive = static_cast<int>(std::__libcpp_wait_kind::__adaptive)
+};
+
+struct wait_policy
+{
+  wait_kind kind;
+  int spin_count;
+
+  _CCCL_HOST_DEVICE constexpr wait_policy(
+    wait_kind __kind = wait_kind::spin_then_park, int __spin_count = _LIBCUDACXX_POLLING_COUNT) noexcept
+      : kind(__kind)
+      , spin_count(__spin_count)
+  {}
+};
+
+#  if !defined(_CCCL_COMPILER_NVRTC)
+
+// Returns the wait policy of the calling host thread.
+inline _CCCL_HOST wait_policy get_wait_policy() noexcept
+{
+  std::__libcpp_wait_policy_t const __policy = std::__libcpp_thread_wait_policy();
+  return wait_policy(static_cast<wait_kind>(__policy.__kind), __policy.__spin_count);
+}
+
+// Sets the wait policy of the calling host thread and returns the previous
+// one. Every thread starts with the default policy, and device threads always
+// use it.
+inline _CCCL_HOST wait_policy set_wait_policy(wait_policy __policy) noexcept
+{
+  wait_policy const __previous = get_wait_policy();
+  std::__libcpp_thread_wait_policy() = {
+    static_cast<std::__libcpp_wait_kind>(__policy.kind), __policy.spin_count < 0 ? 0 : __policy.spin_count};
+  return __previous;
+}
+
+#  endif // !_CCCL_COMPILER_NVRTC
+
+#endif // !_LIBCUDACXX_HAS_NO_THREADS
+
 _LIBCUDACXX_END_NAMESPACE_CUDA
 
 #endif // _LIBCUDACXX___CUDA_ATOMIC_H
@@ -52,7 +52,12 @@ static_assert(ATOMIC_POINTER_LOCK_FREE == 2, "");
 
 // pre-define lock free query for heterogeneous compatibility
 #ifndef _LIBCUDACXX_ATOMIC_IS_LOCK_FREE
-#  define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) (__x <= 8)
+#  if defined(_LIBCUDACXX_HAS_HOST_CMPXCHG16B)
+#    define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) \
+      ((__x) <= 8 || ((__x) == 16 && __detail::__cxx_atomic_has_cmpxchg16b()))
+#  else
+#    define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(__x) (__x <= 8)
+#  endif
 #endif
 
 #ifndef _CCCL_COMPILER_NVRTC
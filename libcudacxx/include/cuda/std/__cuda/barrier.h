@@ -108,6 +108,25 @@ public:
   }
 };
 
+#if !defined(_CCCL_COMPILER_NVRTC)
+
+// A barrier for host threads with the interface of cuda::std::barrier which
+// combines the arrivals in a tree when many threads are expected, so that the
+// phases complete without all threads contending for one cache line.
+template <class _CompletionF = _CUDA_VSTD::__empty_completion>
+class tree_barrier : public _CUDA_VSTD::__tree_barrier_base<_CompletionF>
+{
+public:
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  _CCCL_HOST explicit tree_barrier(_CUDA_VSTD::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : _CUDA_VSTD::__tree_barrier_base<_CompletionF>(__expected, __completion)
+  {}
+};
+
+#endif // !_CCCL_COMPILER_NVRTC
+
 struct __block_scope_barrier_base
 {};
 
@@ -0,0 +1,224 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___CUDA_COMPLEX_H
+#define _LIBCUDACXX___CUDA_COMPLEX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA
+
+// fast_complex<T>
+
+// A complex number with the layout of cuda::std::complex<T> whose
+// multiplication and division assume that their operands and results are
+// finite, like C's CX_LIMITED_RANGE. They skip the NaN and infinity recovery
+// of Annex G which cuda::std::complex does, multiplication is the textbook
+// four multiplications and two additions, and division is Smith's algorithm
+// without the rescaling by logb and scalbn. Without branches on special
+// values loops over them vectorize. Results overflow or lose precision for
+// operands with very large or very small magnitudes.
+//
+// fast_complex converts implicitly from and to cuda::std::complex<T>, so it
+// can be applied to just the loops which need it.
+template <class _Tp>
+class alignas(alignof(_CUDA_VSTD::complex<_Tp>)) fast_complex
+{
+  static_assert(_CUDA_VSTD::__is_complex_float<_Tp>::value, "fast_complex requires a floating point value type");
+
+  _Tp __re_;
+  _Tp __im_;
+
+public:
+  using value_type = _Tp;
+
+  _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex(const value_type& __re = value_type(),
+                                                       const value_type& __im = value_type())
+      : __re_(__re)
+      , __im_(__im)
+  {}
+
+  _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex(const _CUDA_VSTD::complex<_Tp>& __c)
+      : __re_(__c.real())
+      , __im_(__c.imag())
+  {}
+
+  _LIBCUDACXX_INLINE_VISIBILITY constexpr operator _CUDA_VSTD::complex<_Tp>() const
+  {
+    return _CUDA_VSTD::complex<_Tp>(__re_, __im_);
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY constexpr value_type real() const
+  {
+    return __re_;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY constexpr value_type imag() const
+  {
+    return __im_;
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 void real(value_type __re)
+  {
+    __re_ = __re;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 void imag(value_type __im)
+  {
+    __im_ = __im;
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator+=(const fast_complex& __c)
+  {
+    __re_ += __c.__re_;
+    __im_ += __c.__im_;
+    return *this;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator-=(const fast_complex& __c)
+  {
+    __re_ -= __c.__re_;
+    __im_ -= __c.__im_;
+    return *this;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator*=(const fast_complex& __c)
+  {
+    *this = *this * __c;
+    return *this;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator/=(const fast_complex& __c)
+  {
+    *this = *this / __c;
+    return *this;
+  }
+
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator*=(const value_type& __re)
+  {
+    __re_ *= __re;
+    __im_ *= __re;
+    return *this;
+  }
+  _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex& operator/=(const value_type& __re)
+  {
+    __re_ /= __re;
+    __im_ /= __re;
+    return *this;
+  }
+
+  // The operators are found by argument dependent lookup only, so that
+  // cuda::std::complex operands convert to fast_complex.
+
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex operator+(const fast_complex& __x)
+  {
+    return __x;
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex operator-(const fast_complex& __x)
+  {
+    return fast_complex(-__x.__re_, -__x.__im_);
+  }
+
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex
+  operator+(const fast_complex& __x, const fast_complex& __y)
+  {
+    return fast_complex(__x.__re_ + __y.__re_, __x.__im_ + __y.__im_);
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex
+  operator-(const fast_complex& __x, const fast_complex& __y)
+  {
+    return fast_complex(__x.__re_ - __y.__re_, __x.__im_ - __y.__im_);
+  }
+
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex
+  operator*(const fast_complex& __z, const fast_complex& __w)
+  {
+    return fast_complex(__z.__re_ * __w.__re_ - __z.__im_ * __w.__im_, __z.__re_ * __w.__im_ + __z.__im_ * __w.__re_);
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex operator*(const fast_complex& __x, const value_type& __y)
+  {
+    return fast_complex(__x.__re_ * __y, __x.__im_ * __y);
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex operator*(const value_type& __x, const fast_complex& __y)
+  {
+    return fast_complex(__x * __y.__re_, __x * __y.__im_);
+  }
+
+  // Smith's algorithm: the ratio of the smaller to the larger part of the
+  // divisor keeps the intermediate products from overflowing in most cases.
+  friend _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex
+  operator/(const fast_complex& __z, const fast_complex& __w)
+  {
+    _Tp const __a = __z.__re_;
+    _Tp const __b = __z.__im_;
+    _Tp const __c = __w.__re_;
+    _Tp const __d = __w.__im_;
+    if ((__c < _Tp(0) ? -__c : __c) >= (__d < _Tp(0) ? -__d : __d))
+    {
+      _Tp const __r     = __d / __c;
+      _Tp const __denom = __c + __d * __r;
+      return fast_complex((__a + __b * __r) / __denom, (__b - __a * __r) / __denom);
+    }
+    _Tp const __r     = __c / __d;
+    _Tp const __denom = __c * __r + __d;
+    return fast_complex((__a * __r + __b) / __denom, (__b * __r - __a) / __denom);
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex operator/(const fast_complex& __x, const value_type& __y)
+  {
+    return fast_complex(__x.__re_ / __y, __x.__im_ / __y);
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 fast_complex
+  operator/(const value_type& __x, const fast_complex& __y)
+  {
+    return fast_complex(__x) / __y;
+  }
+
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr bool operator==(const fast_complex& __x, const fast_complex& __y)
+  {
+    return __x.__re_ == __y.__re_ && __x.__im_ == __y.__im_;
+  }
+  friend _LIBCUDACXX_INLINE_VISIBILITY constexpr bool operator!=(const fast_complex& __x, const fast_complex& __y)
+  {
+    return !(__x == __y);
+  }
+};
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp real(const fast_complex<_Tp>& __c)
+{
+  return __c.real();
+}
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp imag(const fast_complex<_Tp>& __c)
+{
+  return __c.imag();
+}
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY constexpr fast_complex<_Tp> conj(const fast_complex<_Tp>& __c)
+{
+  return fast_complex<_Tp>(__c.real(), -__c.imag());
+}
+
+// the squared magnitude, without the special cases of cuda::std::norm
+template <class _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp norm(const fast_complex<_Tp>& __c)
+{
+  return __c.real() * __c.real() + __c.imag() * __c.imag();
+}
+
+_LIBCUDACXX_END_NAMESPACE_CUDA
+
+#endif // _LIBCUDACXX___CUDA_COMPLEX_H
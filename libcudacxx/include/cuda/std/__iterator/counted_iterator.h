@@ -0,0 +1,413 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___ITERATOR_COUNTED_ITERATOR_H
+#define _LIBCUDACXX___ITERATOR_COUNTED_ITERATOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/assignable.h>
+#include <cuda/std/__concepts/common_with.h>
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__concepts/derived_from.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/default_sentinel.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__iterator/iter_move.h>
+#include <cuda/std/__iterator/iter_swap.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__iterator/readable_traits.h>
+#include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__type_traits/add_pointer.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+// Pointers have no member `iterator_concept`, std::counted_iterator picks it up through its iterator_traits
+// specialization instead. As we do not specialize iterator_traits we need to provide it here.
+template <class _Iter, class = void>
+struct __counted_iterator_concept
+{};
+
+template <class _Tp>
+struct __counted_iterator_concept<_Tp*, void>
+{
+  using iterator_concept = contiguous_iterator_tag;
+};
+
+template <class _Iter>
+struct __counted_iterator_concept<_Iter, void_t<typename _Iter::iterator_concept>>
+{
+  using iterator_concept = typename _Iter::iterator_concept;
+};
+
+template <class _Iter, class = void>
+struct __counted_iterator_category
+{};
+
+template <class _Iter>
+struct __counted_iterator_category<_Iter, void_t<typename _Iter::iterator_category>>
+{
+  using iterator_category = typename _Iter::iterator_category;
+};
+
+// Only query contiguous_iterator for iterators that claim to be contiguous, as the C++17 emulation of the concept
+// would otherwise instantiate pointer_traits for arbitrary iterator types.
+template <class _Iter, bool = derived_from<_ITER_CONCEPT<_Iter>, contiguous_iterator_tag>>
+struct __counted_iterator_pointer
+{
+  using type = void;
+};
+
+template <class _Iter>
+struct __counted_iterator_pointer<_Iter, true>
+{
+  using type = _If<contiguous_iterator<_Iter>, add_pointer_t<iter_reference_t<_Iter>>, void>;
+};
+
+// [counted.iterator] only specializes iterator_traits to provide `pointer`. We rather provide the member types
+// for readable iterators directly, so that the traits of the host standard library pick them up as well.
+template <class _Iter, bool = indirectly_readable<_Iter>>
+struct __counted_iterator_value_type
+{};
+
+template <class _Iter>
+struct __counted_iterator_value_type<_Iter, true>
+{
+  using value_type = iter_value_t<_Iter>;
+  using reference  = iter_reference_t<_Iter>;
+  using pointer    = typename __counted_iterator_pointer<_Iter>::type;
+};
+
+#  if _CCCL_STD_VER >= 2020
+template <input_or_output_iterator _Iter>
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+// No SFINAE parameter here, an additional template parameter would break pointer_traits for contiguous iterators
+template <class _Iter>
+#  endif // _CCCL_STD_VER <= 2017
+class _LIBCUDACXX_TEMPLATE_VIS counted_iterator
+    : public __counted_iterator_concept<_Iter>
+    , public __counted_iterator_category<_Iter>
+    , public __counted_iterator_value_type<_Iter>
+{
+  static_assert(input_or_output_iterator<_Iter>, "counted_iterator requires an input_or_output_iterator");
+
+public:
+  _Iter __current_                  = _Iter();
+  iter_difference_t<_Iter> __count_ = 0;
+
+  using iterator_type   = _Iter;
+  using difference_type = iter_difference_t<_Iter>;
+
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI constexpr counted_iterator()
+    requires default_initializable<_Iter>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(default_initializable<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator() noexcept(
+    is_nothrow_default_constructible_v<_I2>)
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator(_Iter __iter, difference_type __n)
+      : __current_(_CUDA_VSTD::move(__iter))
+      , __count_(__n)
+  {
+    _LIBCUDACXX_ASSERT(__n >= 0, "__n must not be negative.");
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2)
+  _LIBCUDACXX_REQUIRES(convertible_to<const _I2&, _Iter>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator(
+    const counted_iterator<_I2>& __other)
+      : __current_(__other.__current_)
+      , __count_(__other.__count_)
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _I2)
+  _LIBCUDACXX_REQUIRES(assignable_from<_Iter&, const _I2&>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator&
+  operator=(const counted_iterator<_I2>& __other)
+  {
+    __current_ = __other.__current_;
+    __count_   = __other.__count_;
+    return *this;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr const _Iter& base() const& noexcept
+  {
+    return __current_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Iter base() &&
+  {
+    return _CUDA_VSTD::move(__current_);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iter_difference_t<_Iter> count() const noexcept
+  {
+    return __count_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr decltype(auto) operator*()
+  {
+    _LIBCUDACXX_ASSERT(__count_ > 0, "Iterator is equal to or past end.");
+    return *__current_;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(__dereferenceable<const _I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr decltype(auto) operator*() const
+  {
+    _LIBCUDACXX_ASSERT(__count_ > 0, "Iterator is equal to or past end.");
+    return *__current_;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(contiguous_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto operator->() const noexcept
+  {
+    return _CUDA_VSTD::to_address(__current_);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator& operator++()
+  {
+    _LIBCUDACXX_ASSERT(__count_ > 0, "Iterator already at or past end.");
+    ++__current_;
+    --__count_;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES((!forward_iterator<_I2>) )
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr decltype(auto) operator++(int)
+  {
+    _LIBCUDACXX_ASSERT(__count_ > 0, "Iterator already at or past end.");
+    --__count_;
+    return __current_++;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(forward_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator operator++(int)
+  {
+    counted_iterator __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(bidirectional_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator& operator--()
+  {
+    --__current_;
+    ++__count_;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(bidirectional_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator operator--(int)
+  {
+    counted_iterator __tmp = *this;
+    --*this;
+    return __tmp;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(random_access_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator
+  operator+(difference_type __n) const
+  {
+    return counted_iterator(__current_ + __n, __count_ - __n);
+  }
+
+  template <class _I2 = _Iter>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator+(difference_type __n, const counted_iterator& __x)
+    _LIBCUDACXX_TRAILING_REQUIRES(counted_iterator)(random_access_iterator<_I2>)
+  {
+    return __x + __n;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(random_access_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator& operator+=(difference_type __n)
+  {
+    _LIBCUDACXX_ASSERT(__n <= __count_, "Cannot advance iterator past end.");
+    __current_ += __n;
+    __count_ -= __n;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(random_access_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator
+  operator-(difference_type __n) const
+  {
+    return counted_iterator(__current_ - __n, __count_ + __n);
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator-(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(iter_difference_t<_I2>)(common_with<_I2, _Iter>)
+  {
+    return __rhs.__count_ - __lhs.__count_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr iter_difference_t<_Iter>
+  operator-(const counted_iterator& __lhs, default_sentinel_t)
+  {
+    return -__lhs.__count_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr iter_difference_t<_Iter>
+  operator-(default_sentinel_t, const counted_iterator& __rhs)
+  {
+    return __rhs.__count_;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(random_access_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr counted_iterator& operator-=(difference_type __n)
+  {
+    _LIBCUDACXX_ASSERT(-__n <= __count_, "Attempt to subtract too large of a size.");
+    __current_ -= __n;
+    __count_ += __n;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _I2 = _Iter)
+  _LIBCUDACXX_REQUIRES(random_access_iterator<_I2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr decltype(auto)
+  operator[](difference_type __n) const
+  {
+    _LIBCUDACXX_ASSERT(__n < __count_, "Subscript argument must be less than size.");
+    return __current_[__n];
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator==(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __lhs.__count_ == __rhs.__count_;
+  }
+#  if _CCCL_STD_VER <= 2017
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator!=(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __lhs.__count_ != __rhs.__count_;
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator==(const counted_iterator& __lhs, default_sentinel_t)
+  {
+    return __lhs.__count_ == 0;
+  }
+#  if _CCCL_STD_VER <= 2017
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator==(default_sentinel_t, const counted_iterator& __lhs)
+  {
+    return __lhs.__count_ == 0;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator!=(const counted_iterator& __lhs, default_sentinel_t)
+  {
+    return __lhs.__count_ != 0;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator!=(default_sentinel_t, const counted_iterator& __lhs)
+  {
+    return __lhs.__count_ != 0;
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+  // counted_iterators compare by their remaining count, so a larger count means an earlier position.
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator<(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __rhs.__count_ < __lhs.__count_;
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator>(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __lhs.__count_ < __rhs.__count_;
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator<=(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __rhs.__count_ <= __lhs.__count_;
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator>=(const counted_iterator& __lhs, const counted_iterator<_I2>& __rhs)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(common_with<_I2, _Iter>)
+  {
+    return __lhs.__count_ <= __rhs.__count_;
+  }
+
+  template <class _I2 = _Iter>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr auto iter_move(
+    const counted_iterator& __i) noexcept(noexcept(_CUDA_VRANGES::iter_move(__i.__current_)))
+    _LIBCUDACXX_TRAILING_REQUIRES(iter_rvalue_reference_t<_I2>)(input_iterator<_I2>)
+  {
+    _LIBCUDACXX_ASSERT(__i.__count_ > 0, "Iterator must not be past end of range.");
+    return _CUDA_VRANGES::iter_move(__i.__current_);
+  }
+
+  template <class _I2>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr auto
+  iter_swap(const counted_iterator& __x, const counted_iterator<_I2>& __y) noexcept(
+    noexcept(_CUDA_VRANGES::iter_swap(__x.__current_, __y.__current_)))
+    _LIBCUDACXX_TRAILING_REQUIRES(void)(indirectly_swappable<_I2, _Iter>)
+  {
+    _LIBCUDACXX_ASSERT(__x.__count_ > 0 && __y.__count_ > 0, "Iterators must not be past end of range.");
+    return _CUDA_VRANGES::iter_swap(__x.__current_, __y.__current_);
+  }
+};
+
+template <class _Iter>
+_CCCL_HOST_DEVICE counted_iterator(_Iter, iter_difference_t<_Iter>) -> counted_iterator<_Iter>;
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___ITERATOR_COUNTED_ITERATOR_H
@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_ALIGNED_ACCESSOR_H
+#define _LIBCUDACXX___MDSPAN_ALIGNED_ACCESSOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/default_accessor.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__memory/assume_aligned.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstddef>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+// Accessor which promises that every data handle it is handed is aligned to
+// _ByteAlignment bytes. The promise is forwarded to the compiler through
+// assume_aligned, which lets loops over the accessed elements use aligned
+// vector loads and stores.
+template <class _ElementType, size_t _ByteAlignment>
+struct aligned_accessor
+{
+  static_assert(_ByteAlignment != 0 && (_ByteAlignment & (_ByteAlignment - 1)) == 0,
+                "aligned_accessor: the byte alignment must be a power of two.");
+  static_assert(_ByteAlignment >= alignof(_ElementType),
+                "aligned_accessor: the byte alignment must be at least the alignment of the element type.");
+
+  using offset_policy    = default_accessor<_ElementType>;
+  using element_type     = _ElementType;
+  using reference        = _ElementType&;
+  using data_handle_type = _ElementType*;
+
+  static constexpr size_t byte_alignment = _ByteAlignment;
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr aligned_accessor() noexcept = default;
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    size_t _OtherByteAlignment,
+    /* requires */ (_LIBCUDACXX_TRAIT(is_convertible, _OtherElementType (*)[], element_type (*)[])
+                    && (_OtherByteAlignment >= byte_alignment)))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr aligned_accessor(aligned_accessor<_OtherElementType, _OtherByteAlignment>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (_LIBCUDACXX_TRAIT(is_convertible, _OtherElementType (*)[], element_type (*)[])))
+  __MDSPAN_INLINE_FUNCTION
+  explicit constexpr aligned_accessor(default_accessor<_OtherElementType>) noexcept {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherElementType,
+    /* requires */ (_LIBCUDACXX_TRAIT(is_convertible, element_type (*)[], _OtherElementType (*)[])))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr operator default_accessor<_OtherElementType>() const noexcept
+  {
+    return {};
+  }
+
+  // The result of offset is in general no longer aligned, hence offset_policy
+  // is default_accessor.
+  __MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type offset(data_handle_type __p, size_t __i) const noexcept
+  {
+    return _CUDA_VSTD::__assume_aligned<byte_alignment>(__p) + __i;
+  }
+
+  __MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type __p, size_t __i) const noexcept
+  {
+    return _CUDA_VSTD::__assume_aligned<byte_alignment>(__p)[__i];
+  }
+};
+
+#  if _CCCL_STD_VER < 2017
+template <class _ElementType, size_t _ByteAlignment>
+constexpr size_t aligned_accessor<_ElementType, _ByteAlignment>::byte_alignment;
+#  endif // _CCCL_STD_VER < 2017
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_ALIGNED_ACCESSOR_H
@@ -0,0 +1,654 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_H
+#define _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__mdspan/dynamic_extent.h>
+#include <cuda/std/__mdspan/extents.h>
+#include <cuda/std/__mdspan/layout_left.h>
+#include <cuda/std/__mdspan/layout_right.h>
+#include <cuda/std/__mdspan/layout_stride.h>
+#include <cuda/std/__mdspan/macros.h>
+#include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_constructible.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+#if _CCCL_STD_VER > 2011
+
+// The padded layouts of C++26. They behave like layout_left and layout_right,
+// except that the stride of the second (layout_left_padded) respectively the
+// second to last (layout_right_padded) rank is rounded up to a multiple of the
+// padding value. Every row (column) therefore starts at an aligned offset while
+// the innermost rank stays contiguous, so that loops over it can be vectorized.
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_left_padded
+{
+  template <class _Extents>
+  class mapping;
+};
+
+template <size_t _PaddingValue = dynamic_extent>
+struct layout_right_padded
+{
+  template <class _Extents>
+  class mapping;
+};
+
+namespace __detail
+{
+
+// LEAST-MULTIPLE-AT-LEAST(x, y) of [mdspan.layout.leftpad.expo]
+template <class _Tp>
+_CCCL_HOST_DEVICE constexpr _Tp __least_multiple_at_least(_Tp __x, _Tp __y) noexcept
+{
+  return __x == 0 ? __y : __x * ((__y + __x - 1) / __x);
+}
+
+// The stride of the padded rank if it is known at compile time, dynamic_extent otherwise
+template <size_t _PaddingValue, class _Extents, size_t _PaddedRank>
+_CCCL_HOST_DEVICE constexpr size_t __static_padding_stride() noexcept
+{
+  return _Extents::rank() < 2 ? 0
+       : (_PaddingValue == dynamic_extent || _Extents::static_extent(_PaddedRank) == dynamic_extent)
+         ? dynamic_extent
+         : __least_multiple_at_least(_PaddingValue, _Extents::static_extent(_PaddedRank));
+}
+
+template <size_t _PaddingValue, class _Extents, size_t _PaddedRank>
+_CCCL_HOST_DEVICE constexpr bool __padded_is_always_exhaustive() noexcept
+{
+  return _Extents::rank() < 2
+      || (__static_padding_stride<_PaddingValue, _Extents, _PaddedRank>() != dynamic_extent
+          && __static_padding_stride<_PaddingValue, _Extents, _PaddedRank>()
+               == _Extents::static_extent(_PaddedRank));
+}
+
+template <size_t _PaddingValue, size_t _OtherPaddingValue>
+_CCCL_HOST_DEVICE constexpr bool __padding_values_compatible() noexcept
+{
+  return _PaddingValue == dynamic_extent || _OtherPaddingValue == dynamic_extent
+      || _PaddingValue == _OtherPaddingValue;
+}
+
+template <class _Layout>
+struct __is_layout_left_padded : false_type
+{};
+
+template <size_t _PaddingValue>
+struct __is_layout_left_padded<layout_left_padded<_PaddingValue>> : true_type
+{};
+
+template <class _Layout>
+struct __is_layout_right_padded : false_type
+{};
+
+template <size_t _PaddingValue>
+struct __is_layout_right_padded<layout_right_padded<_PaddingValue>> : true_type
+{};
+
+} // namespace __detail
+
+//==============================================================================
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_left_padded<_PaddingValue>::mapping
+{
+public:
+  static constexpr size_t padding_value = _PaddingValue;
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_left_padded<padding_value>;
+
+private:
+  static_assert(__detail::__is_extents_v<extents_type>,
+                "layout_left_padded::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+  static_assert(padding_value == dynamic_extent
+                  || static_cast<size_t>(static_cast<index_type>(padding_value)) == padding_value,
+                "layout_left_padded::mapping: padding_value must be representable as index_type.");
+
+  template <class>
+  friend class mapping;
+
+  using __indices_type = _CUDA_VSTD::array<index_type, extents_type::rank()>;
+
+  // the padded stride is the stride of rank 1
+  _CCCL_HOST_DEVICE static constexpr index_type
+  __padded_stride_for(const extents_type& __exts, index_type __pad) noexcept
+  {
+    return extents_type::rank() < 2 ? index_type(0) : __detail::__least_multiple_at_least(__pad, __exts.extent(0));
+  }
+
+  _CCCL_HOST_DEVICE static constexpr index_type __default_padding() noexcept
+  {
+    return padding_value == dynamic_extent ? index_type(1) : static_cast<index_type>(padding_value);
+  }
+
+  // i0 + S * (i1 + E(1) * (i2 + E(2) * i3))
+  _CCCL_HOST_DEVICE constexpr index_type __offset(const __indices_type& __idx) const noexcept
+  {
+    if (extents_type::rank() == 0)
+    {
+      return 0;
+    }
+    index_type __result = __idx[extents_type::rank() - 1];
+    for (rank_type __r = extents_type::rank() - 1; __r-- > 1;)
+    {
+      __result = __result * __extents.extent(__r) + __idx[__r];
+    }
+    return extents_type::rank() == 1 ? __result : __result * __padded_stride + __idx[0];
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr __indices_type __make_strides(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __indices_type{{__stride(_Idx)...}};
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _CCCL_HOST_DEVICE constexpr mapping() noexcept
+      : mapping(extents_type())
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride(__padded_stride_for(__exts, __default_padding()))
+  {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherIndexType,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherIndexType, index_type)
+                    && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _OtherIndexType)))
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts, _OtherIndexType __pad) noexcept
+      : __extents(__exts)
+      , __padded_stride(__padded_stride_for(__exts, static_cast<index_type>(__pad)))
+  {
+    _LIBCUDACXX_ASSERT(static_cast<index_type>(__pad) > 0, "layout_left_padded::mapping: padding must be positive");
+    _LIBCUDACXX_ASSERT(padding_value == dynamic_extent || static_cast<index_type>(__pad) == __default_padding(),
+                       "layout_left_padded::mapping: padding must match the static padding value");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    layout_left::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(__padded_stride_for(__extents, __default_padding()))
+  {
+    static_assert(_OtherExtents::rank() < 2
+                    || __detail::__static_padding_stride<padding_value, extents_type, 0>() == dynamic_extent
+                    || _OtherExtents::static_extent(0) == dynamic_extent
+                    || __detail::__static_padding_stride<padding_value, extents_type, 0>()
+                         == _OtherExtents::static_extent(0),
+                  "layout_left_padded::mapping: the padded stride does not match the extent of the source mapping");
+    _LIBCUDACXX_ASSERT(extents_type::rank() < 2 || __padded_stride == __extents.extent(0),
+                       "layout_left_padded::mapping: the extent of rank 0 must be a multiple of the padding");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    layout_stride::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(extents_type::rank() < 2 ? index_type(0) : static_cast<index_type>(__other.stride(1)))
+  {
+    _LIBCUDACXX_ASSERT(extents_type::rank() == 0 || __other.stride(0) == 1,
+                       "layout_left_padded::mapping: the stride of rank 0 must be one");
+    _LIBCUDACXX_ASSERT(padding_value == dynamic_extent || extents_type::rank() < 2
+                         || __padded_stride == __padded_stride_for(__extents, __default_padding()),
+                       "layout_left_padded::mapping: the stride of rank 1 does not match the padding value");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherMapping,
+    /* requires */ (__detail::__is_layout_left_padded<typename _OtherMapping::layout_type>::value
+                    && __detail::__is_mapping_of<typename _OtherMapping::layout_type, _OtherMapping>
+                    && _LIBCUDACXX_TRAIT(
+                      _CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type)))
+  __MDSPAN_CONDITIONAL_EXPLICIT(
+    ((extents_type::rank() > 1 && padding_value != dynamic_extent && _OtherMapping::padding_value == dynamic_extent)
+     || !_CUDA_VSTD::is_convertible<typename _OtherMapping::extents_type, extents_type>::value)) // needs two () due to
+                                                                                                // comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    _OtherMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(static_cast<index_type>(__other.__stride(1)))
+  {
+    static_assert(extents_type::rank() < 2
+                    || __detail::__padding_values_compatible<padding_value, _OtherMapping::padding_value>(),
+                  "layout_left_padded::mapping: incompatible padding values");
+  }
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping&
+  operator=(mapping const&) noexcept = default;
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr _CUDA_VSTD::array<index_type, extents_type::rank()> strides() const noexcept
+  {
+    return __make_strides(_CUDA_VSTD::make_index_sequence<extents_type::rank()>());
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept
+  {
+    index_type __last = 0;
+    for (rank_type __r = 0; __r < extents_type::rank(); __r++)
+    {
+      if (__extents.extent(__r) == 0)
+      {
+        return 0;
+      }
+      __last += (__extents.extent(__r) - 1) * __stride(__r);
+    }
+    return __last + 1;
+  }
+
+  //--------------------------------------------------------------------------------
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _Indices,
+    /* requires */ (
+      (sizeof...(_Indices) == extents_type::rank())
+      && __MDSPAN_FOLD_AND((_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+                            && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices)))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __offset(__indices_type{{static_cast<index_type>(__idxs)...}});
+  }
+
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept
+  {
+    return __detail::__padded_is_always_exhaustive<padding_value, extents_type, 0>();
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept
+  {
+    return true;
+  }
+
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept
+  {
+    return extents_type::rank() < 2 || __extents.extent(0) == __padded_stride;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept
+  {
+    return true;
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(class _Ext = _Extents,
+                             /* requires */ (_Ext::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type __r) const noexcept
+  {
+    return __stride(__r);
+  }
+
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents()
+        && (extents_type::rank() < 2 || __lhs.__stride(1) == static_cast<index_type>(__rhs.__stride(1)));
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#  endif
+
+  // Not really public, but needed to convert between mappings with different padding values
+  _CCCL_HOST_DEVICE constexpr index_type __stride(rank_type __r) const noexcept
+  {
+    index_type __value = __r == 0 ? index_type(1) : __padded_stride;
+    for (rank_type __i = 1; __i < __r; __i++)
+    {
+      __value *= __extents.extent(__i);
+    }
+    return __value;
+  }
+
+private:
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+  index_type __padded_stride{};
+};
+
+//==============================================================================
+
+template <size_t _PaddingValue>
+template <class _Extents>
+class layout_right_padded<_PaddingValue>::mapping
+{
+public:
+  static constexpr size_t padding_value = _PaddingValue;
+
+  using extents_type = _Extents;
+  using index_type   = typename extents_type::index_type;
+  using size_type    = typename extents_type::size_type;
+  using rank_type    = typename extents_type::rank_type;
+  using layout_type  = layout_right_padded<padding_value>;
+
+private:
+  static_assert(__detail::__is_extents_v<extents_type>,
+                "layout_right_padded::mapping must be instantiated with a specialization of _CUDA_VSTD::extents.");
+  static_assert(padding_value == dynamic_extent
+                  || static_cast<size_t>(static_cast<index_type>(padding_value)) == padding_value,
+                "layout_right_padded::mapping: padding_value must be representable as index_type.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr size_t __last_rank = extents_type::rank() == 0 ? 0 : extents_type::rank() - 1;
+
+  using __indices_type = _CUDA_VSTD::array<index_type, extents_type::rank()>;
+
+  // the padded stride is the stride of rank rank() - 2
+  _CCCL_HOST_DEVICE static constexpr index_type
+  __padded_stride_for(const extents_type& __exts, index_type __pad) noexcept
+  {
+    return extents_type::rank() < 2
+           ? index_type(0)
+           : __detail::__least_multiple_at_least(__pad, __exts.extent(__last_rank));
+  }
+
+  _CCCL_HOST_DEVICE static constexpr index_type __default_padding() noexcept
+  {
+    return padding_value == dynamic_extent ? index_type(1) : static_cast<index_type>(padding_value);
+  }
+
+  // i3 + S * (i2 + E(2) * (i1 + E(1) * i0))
+  _CCCL_HOST_DEVICE constexpr index_type __offset(const __indices_type& __idx) const noexcept
+  {
+    if (extents_type::rank() == 0)
+    {
+      return 0;
+    }
+    index_type __result = __idx[0];
+    for (rank_type __r = 1; __r + 1 < extents_type::rank(); __r++)
+    {
+      __result = __result * __extents.extent(__r) + __idx[__r];
+    }
+    return extents_type::rank() == 1 ? __result : __result * __padded_stride + __idx[__last_rank];
+  }
+
+  template <size_t... _Idx>
+  _CCCL_HOST_DEVICE constexpr __indices_type __make_strides(_CUDA_VSTD::index_sequence<_Idx...>) const noexcept
+  {
+    return __indices_type{{__stride(_Idx)...}};
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  _CCCL_HOST_DEVICE constexpr mapping() noexcept
+      : mapping(extents_type())
+  {}
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(mapping const&) noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts) noexcept
+      : __extents(__exts)
+      , __padded_stride(__padded_stride_for(__exts, __default_padding()))
+  {}
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherIndexType,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _OtherIndexType, index_type)
+                    && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _OtherIndexType)))
+  _CCCL_HOST_DEVICE constexpr mapping(extents_type const& __exts, _OtherIndexType __pad) noexcept
+      : __extents(__exts)
+      , __padded_stride(__padded_stride_for(__exts, static_cast<index_type>(__pad)))
+  {
+    _LIBCUDACXX_ASSERT(static_cast<index_type>(__pad) > 0, "layout_right_padded::mapping: padding must be positive");
+    _LIBCUDACXX_ASSERT(padding_value == dynamic_extent || static_cast<index_type>(__pad) == __default_padding(),
+                       "layout_right_padded::mapping: padding must match the static padding value");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((!_CUDA_VSTD::is_convertible<_OtherExtents, extents_type>::value)) // needs two () due
+                                                                                                   // to comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    layout_right::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(__padded_stride_for(__extents, __default_padding()))
+  {
+    static_assert(_OtherExtents::rank() < 2
+                    || __detail::__static_padding_stride<padding_value, extents_type, __last_rank>() == dynamic_extent
+                    || _OtherExtents::static_extent(__last_rank) == dynamic_extent
+                    || __detail::__static_padding_stride<padding_value, extents_type, __last_rank>()
+                         == _OtherExtents::static_extent(__last_rank),
+                  "layout_right_padded::mapping: the padded stride does not match the extent of the source mapping");
+    _LIBCUDACXX_ASSERT(extents_type::rank() < 2 || __padded_stride == __extents.extent(__last_rank),
+                       "layout_right_padded::mapping: the extent of the last rank must be a multiple of the padding");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherExtents,
+    /* requires */ (_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_constructible, extents_type, _OtherExtents)))
+  __MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    layout_stride::mapping<_OtherExtents> const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(
+          extents_type::rank() < 2 ? index_type(0) : static_cast<index_type>(__other.stride(__last_rank - 1)))
+  {
+    _LIBCUDACXX_ASSERT(extents_type::rank() == 0 || __other.stride(__last_rank) == 1,
+                       "layout_right_padded::mapping: the stride of the last rank must be one");
+    _LIBCUDACXX_ASSERT(padding_value == dynamic_extent || extents_type::rank() < 2
+                         || __padded_stride == __padded_stride_for(__extents, __default_padding()),
+                       "layout_right_padded::mapping: the stride of rank rank() - 2 does not match the padding value");
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class _OtherMapping,
+    /* requires */ (__detail::__is_layout_right_padded<typename _OtherMapping::layout_type>::value
+                    && __detail::__is_mapping_of<typename _OtherMapping::layout_type, _OtherMapping>
+                    && _LIBCUDACXX_TRAIT(
+                      _CUDA_VSTD::is_constructible, extents_type, typename _OtherMapping::extents_type)))
+  __MDSPAN_CONDITIONAL_EXPLICIT(
+    ((extents_type::rank() > 1 && padding_value != dynamic_extent && _OtherMapping::padding_value == dynamic_extent)
+     || !_CUDA_VSTD::is_convertible<typename _OtherMapping::extents_type, extents_type>::value)) // needs two () due to
+                                                                                                // comma
+  __MDSPAN_INLINE_FUNCTION constexpr mapping(
+    _OtherMapping const& __other) noexcept // NOLINT(google-explicit-constructor)
+      : __extents(__other.extents())
+      , __padded_stride(
+          extents_type::rank() < 2 ? index_type(0) : static_cast<index_type>(__other.__stride(__last_rank - 1)))
+  {
+    static_assert(extents_type::rank() < 2
+                    || __detail::__padding_values_compatible<padding_value, _OtherMapping::padding_value>(),
+                  "layout_right_padded::mapping: incompatible padding values");
+  }
+
+  __MDSPAN_INLINE_FUNCTION_DEFAULTED __MDSPAN_CONSTEXPR_14_DEFAULTED mapping&
+  operator=(mapping const&) noexcept = default;
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type& extents() const noexcept
+  {
+    return __extents;
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr _CUDA_VSTD::array<index_type, extents_type::rank()> strides() const noexcept
+  {
+    return __make_strides(_CUDA_VSTD::make_index_sequence<extents_type::rank()>());
+  }
+
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept
+  {
+    index_type __last = 0;
+    for (rank_type __r = 0; __r < extents_type::rank(); __r++)
+    {
+      if (__extents.extent(__r) == 0)
+      {
+        return 0;
+      }
+      __last += (__extents.extent(__r) - 1) * __stride(__r);
+    }
+    return __last + 1;
+  }
+
+  //--------------------------------------------------------------------------------
+
+  __MDSPAN_TEMPLATE_REQUIRES(
+    class... _Indices,
+    /* requires */ (
+      (sizeof...(_Indices) == extents_type::rank())
+      && __MDSPAN_FOLD_AND((_LIBCUDACXX_TRAIT(_CUDA_VSTD::is_convertible, _Indices, index_type)
+                            && _LIBCUDACXX_TRAIT(_CUDA_VSTD::is_nothrow_constructible, index_type, _Indices)))))
+  _CCCL_HOST_DEVICE constexpr index_type operator()(_Indices... __idxs) const noexcept
+  {
+    return __offset(__indices_type{{static_cast<index_type>(__idxs)...}});
+  }
+
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept
+  {
+    return __detail::__padded_is_always_exhaustive<padding_value, extents_type, __last_rank>();
+  }
+  __MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept
+  {
+    return true;
+  }
+
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept
+  {
+    return true;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept
+  {
+    return extents_type::rank() < 2 || __extents.extent(__last_rank) == __padded_stride;
+  }
+  __MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept
+  {
+    return true;
+  }
+
+  __MDSPAN_TEMPLATE_REQUIRES(class _Ext = _Extents,
+                             /* requires */ (_Ext::rank() > 0))
+  __MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type __r) const noexcept
+  {
+    return __stride(__r);
+  }
+
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator==(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return __lhs.extents() == __rhs.extents()
+        && (extents_type::rank() < 2
+            || __lhs.__stride(__last_rank - 1) == static_cast<index_type>(__rhs.__stride(__last_rank - 1)));
+  }
+
+  // In C++ 20 the not equal exists if equal is found
+#  if !(__MDSPAN_HAS_CXX_20)
+  template <class _OtherExtents>
+  __MDSPAN_INLINE_FUNCTION friend constexpr bool
+  operator!=(mapping const& __lhs, mapping<_OtherExtents> const& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+#  endif
+
+  // Not really public, but needed to convert between mappings with different padding values
+  _CCCL_HOST_DEVICE constexpr index_type __stride(rank_type __r) const noexcept
+  {
+    if (__r >= __last_rank)
+    {
+      return 1;
+    }
+    index_type __value = __padded_stride;
+    for (rank_type __i = __r + 1; __i < __last_rank; __i++)
+    {
+      __value *= __extents.extent(__i);
+    }
+    return __value;
+  }
+
+private:
+  _CCCL_NO_UNIQUE_ADDRESS extents_type __extents{};
+  index_type __padded_stride{};
+};
+
+#  if _CCCL_STD_VER < 2017
+template <size_t _PaddingValue>
+template <class _Extents>
+constexpr size_t layout_left_padded<_PaddingValue>::mapping<_Extents>::padding_value;
+
+template <size_t _PaddingValue>
+template <class _Extents>
+constexpr size_t layout_right_padded<_PaddingValue>::mapping<_Extents>::padding_value;
+
+template <size_t _PaddingValue>
+template <class _Extents>
+constexpr size_t layout_right_padded<_PaddingValue>::mapping<_Extents>::__last_rank;
+#  endif // _CCCL_STD_VER < 2017
+
+#endif // _CCCL_STD_VER > 2011
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MDSPAN_LAYOUT_PADDED_H
@@ -0,0 +1,56 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
+#define _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/is_constant_evaluated.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <size_t _Np, class _Tp>
+_CCCL_NODISCARD inline _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 _Tp* __assume_aligned(_Tp* __ptr) noexcept
+{
+  static_assert(_Np != 0 && (_Np & (_Np - 1)) == 0, "cuda::std::assume_aligned<N>(p) requires N to be a power of two");
+
+  if (__libcpp_is_constant_evaluated())
+  {
+    return __ptr;
+  }
+  _LIBCUDACXX_ASSERT(reinterpret_cast<uintptr_t>(__ptr) % _Np == 0, "Alignment assumption is violated");
+#if defined(_LIBCUDACXX_ASSUME_ALIGNED)
+  return static_cast<_Tp*>(_LIBCUDACXX_ASSUME_ALIGNED(__ptr, _Np));
+#else // ^^^ _LIBCUDACXX_ASSUME_ALIGNED ^^^ / vvv !_LIBCUDACXX_ASSUME_ALIGNED vvv
+  return __ptr;
+#endif // !_LIBCUDACXX_ASSUME_ALIGNED
+}
+
+template <size_t _Np, class _Tp>
+_CCCL_NODISCARD inline _LIBCUDACXX_INLINE_VISIBILITY _CCCL_CONSTEXPR_CXX14 _Tp* assume_aligned(_Tp* __ptr) noexcept
+{
+  return _CUDA_VSTD::__assume_aligned<_Np>(__ptr);
+}
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___MEMORY_ASSUME_ALIGNED_H
@@ -0,0 +1,218 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_DROP_VIEW_H
+#define _LIBCUDACXX___RANGES_DROP_VIEW_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__functional/bind_back.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/next.h>
+#include <cuda/std/__ranges/access.h>
+#include <cuda/std/__ranges/all.h>
+#include <cuda/std/__ranges/concepts.h>
+#include <cuda/std/__ranges/enable_borrowed_range.h>
+#include <cuda/std/__ranges/non_propagating_cache.h>
+#include <cuda/std/__ranges/range_adaptor.h>
+#include <cuda/std/__ranges/size.h>
+#include <cuda/std/__ranges/view_interface.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+// MSVC complains about [[msvc::no_unique_address]] prior to C++20 as a vendor extension
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4848)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES_ABI
+
+#  if _CCCL_STD_VER >= 2020
+template <view _View>
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+template <class _View, enable_if_t<view<_View>, int> = 0>
+#  endif // _CCCL_STD_VER <= 2017
+class drop_view : public view_interface<drop_view<_View>>
+{
+  // We cache begin() whenever ranges::next is not guaranteed O(1) to provide an
+  // amortized O(1) begin() method. If this is an input_range, then we cannot cache
+  // begin because begin is not equality preserving.
+  // Note: drop_view<input-range>::begin() is still trivially amortized O(1) because
+  // one can't call begin() on it more than once.
+  static constexpr bool _UseCache = forward_range<_View> && !(random_access_range<_View> && sized_range<_View>);
+  using _Cache = _If<_UseCache, __non_propagating_cache<iterator_t<_View>>, __empty_cache>;
+  _CCCL_NO_UNIQUE_ADDRESS _Cache __cached_begin_ = _Cache();
+  range_difference_t<_View> __count_             = 0;
+  _CCCL_NO_UNIQUE_ADDRESS _View __base_          = _View();
+
+  template <class _Base>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr auto
+  __size(_Base& __base, range_difference_t<_View> __count)
+  {
+    const auto __s = _CUDA_VRANGES::size(__base);
+    const auto __c = static_cast<decltype(__s)>(__count);
+    return __s < __c ? 0 : __s - __c;
+  }
+
+public:
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI drop_view()
+    requires default_initializable<_View>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(default_initializable<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr drop_view() noexcept(
+    is_nothrow_default_constructible_v<_View2>)
+      : view_interface<drop_view<_View>>()
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr drop_view(
+    _View __base, range_difference_t<_View> __count)
+      : view_interface<drop_view<_View>>()
+      , __count_(__count)
+      , __base_(_CUDA_VSTD::move(__base))
+  {
+    _LIBCUDACXX_ASSERT(__count >= 0, "count must be greater than or equal to zero.");
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(copy_constructible<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() const&
+  {
+    return __base_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() &&
+  {
+    return _CUDA_VSTD::move(__base_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES((!(__simple_view<_View2> && random_access_range<const _View2> && sized_range<const _View2>) ))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin()
+  {
+    if constexpr (_UseCache)
+    {
+      if (__cached_begin_.__has_value())
+      {
+        return *__cached_begin_;
+      }
+    }
+
+    auto __tmp = _CUDA_VRANGES::next(_CUDA_VRANGES::begin(__base_), __count_, _CUDA_VRANGES::end(__base_));
+    if constexpr (_UseCache)
+    {
+      __cached_begin_.__emplace(__tmp);
+    }
+    return __tmp;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(random_access_range<const _View2> _LIBCUDACXX_AND sized_range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin() const
+  {
+    return _CUDA_VRANGES::next(_CUDA_VRANGES::begin(__base_), __count_, _CUDA_VRANGES::end(__base_));
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES((!__simple_view<_View2>) )
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end()
+  {
+    return _CUDA_VRANGES::end(__base_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end() const
+  {
+    return _CUDA_VRANGES::end(__base_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(sized_range<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size()
+  {
+    return __size(__base_, __count_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(sized_range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size() const
+  {
+    return __size(__base_, __count_);
+  }
+};
+
+template <class _Range>
+_CCCL_HOST_DEVICE drop_view(_Range&&, range_difference_t<_Range>) -> drop_view<_CUDA_VIEWS::all_t<_Range>>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES_ABI
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VAR constexpr bool enable_borrowed_range<drop_view<_Tp>> = enable_borrowed_range<_Tp>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+_LIBCUDACXX_BEGIN_NAMESPACE_VIEWS
+_LIBCUDACXX_BEGIN_NAMESPACE_CPO(__drop)
+
+struct __fn
+{
+  _LIBCUDACXX_TEMPLATE(class _Range, class _Np)
+  _LIBCUDACXX_REQUIRES(viewable_range<_Range> _LIBCUDACXX_AND convertible_to<_Np, range_difference_t<_Range>>)
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Range&& __range, _Np&& __n) const
+    noexcept(noexcept(drop_view(_CUDA_VSTD::forward<_Range>(__range),
+                                static_cast<range_difference_t<_Range>>(_CUDA_VSTD::forward<_Np>(__n)))))
+  {
+    return drop_view(_CUDA_VSTD::forward<_Range>(__range),
+                     static_cast<range_difference_t<_Range>>(_CUDA_VSTD::forward<_Np>(__n)));
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Np)
+  _LIBCUDACXX_REQUIRES(constructible_from<decay_t<_Np>, _Np>)
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto operator()(_Np&& __n) const
+    noexcept(is_nothrow_constructible_v<decay_t<_Np>, _Np>)
+  {
+    return __range_adaptor_closure_t(_CUDA_VSTD::__bind_back(*this, _CUDA_VSTD::forward<_Np>(__n)));
+  }
+};
+_LIBCUDACXX_END_NAMESPACE_CPO
+
+inline namespace __cpo
+{
+_LIBCUDACXX_CPO_ACCESSIBILITY auto drop = __drop::__fn{};
+} // namespace __cpo
+
+_LIBCUDACXX_END_NAMESPACE_VIEWS
+
+_CCCL_DIAG_POP
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_DROP_VIEW_H
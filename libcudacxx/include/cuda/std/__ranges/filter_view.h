@@ -0,0 +1,392 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_FILTER_VIEW_H
+#define _LIBCUDACXX___RANGES_FILTER_VIEW_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/copyable.h>
+#include <cuda/std/__concepts/derived_from.h>
+#include <cuda/std/__concepts/equality_comparable.h>
+#include <cuda/std/__functional/bind_back.h>
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/iter_move.h>
+#include <cuda/std/__iterator/iter_swap.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__memory/addressof.h>
+#include <cuda/std/__ranges/access.h>
+#include <cuda/std/__ranges/all.h>
+#include <cuda/std/__ranges/concepts.h>
+#include <cuda/std/__ranges/movable_box.h>
+#include <cuda/std/__ranges/non_propagating_cache.h>
+#include <cuda/std/__ranges/range_adaptor.h>
+#include <cuda/std/__ranges/view_interface.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__type_traits/is_object.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/in_place.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+// MSVC complains about [[msvc::no_unique_address]] prior to C++20 as a vendor extension
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4848)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+
+template <class _View>
+using __filter_view_iterator_concept =
+  _If<bidirectional_range<_View>,
+      bidirectional_iterator_tag,
+      _If<forward_range<_View>, forward_iterator_tag, input_iterator_tag>>;
+
+template <class _View, bool = forward_range<_View>>
+struct __filter_view_iterator_category
+{};
+
+template <class _View>
+struct __filter_view_iterator_category<_View, true>
+{
+  using _BaseCategory = typename iterator_traits<iterator_t<_View>>::iterator_category;
+  using iterator_category =
+    _If<derived_from<_BaseCategory, bidirectional_iterator_tag>,
+        bidirectional_iterator_tag,
+        _If<derived_from<_BaseCategory, forward_iterator_tag>, forward_iterator_tag, _BaseCategory>>;
+};
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES_ABI
+
+#  if _CCCL_STD_VER >= 2020
+template <input_range _View, indirect_unary_predicate<iterator_t<_View>> _Pred>
+  requires view<_View> && is_object_v<_Pred>
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+template <class _View,
+          class _Pred,
+          enable_if_t<input_range<_View>, int>                                    = 0,
+          enable_if_t<indirect_unary_predicate<_Pred, iterator_t<_View>>, int> = 0,
+          enable_if_t<view<_View>, int>                                           = 0,
+          enable_if_t<is_object_v<_Pred>, int>                                    = 0>
+#  endif // _CCCL_STD_VER <= 2017
+class filter_view : public view_interface<filter_view<_View, _Pred>>
+{
+  _CCCL_NO_UNIQUE_ADDRESS _View __base_ = _View();
+  _CCCL_NO_UNIQUE_ADDRESS __movable_box<_Pred> __pred_;
+
+  // We cache the result of begin() to allow providing an amortized O(1) begin() whenever
+  // the underlying range is at least a forward_range.
+  using _Cache = _If<forward_range<_View>, __non_propagating_cache<iterator_t<_View>>, __empty_cache>;
+  _CCCL_NO_UNIQUE_ADDRESS _Cache __cached_begin_ = _Cache();
+
+  // Returns the first element in [__first, end) that satisfies the predicate
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iterator_t<_View>
+  __find_next(iterator_t<_View> __first)
+  {
+    const auto __last = _CUDA_VRANGES::end(__base_);
+    while (__first != __last && !_CUDA_VSTD::invoke(*__pred_, *__first))
+    {
+      ++__first;
+    }
+    return __first;
+  }
+
+public:
+  class __iterator : public __filter_view_iterator_category<_View>
+  {
+  public:
+    iterator_t<_View> __current_ = iterator_t<_View>();
+    filter_view* __parent_       = nullptr;
+
+    using iterator_concept = __filter_view_iterator_concept<_View>;
+    using value_type       = range_value_t<_View>;
+    using difference_type  = range_difference_t<_View>;
+    using reference        = range_reference_t<_View>;
+    using pointer          = void;
+
+#  if _CCCL_STD_VER >= 2020
+    _LIBCUDACXX_HIDE_FROM_ABI __iterator()
+      requires default_initializable<iterator_t<_View>>
+    = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES(default_initializable<iterator_t<_View2>>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator() noexcept(
+      is_nothrow_default_constructible_v<iterator_t<_View2>>)
+    {}
+#  endif // _CCCL_STD_VER <= 2017
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator(
+      filter_view& __parent, iterator_t<_View> __current)
+        : __current_(_CUDA_VSTD::move(__current))
+        , __parent_(_CUDA_VSTD::addressof(__parent))
+    {}
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr const iterator_t<_View>& base() const& noexcept
+    {
+      return __current_;
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iterator_t<_View> base() &&
+    {
+      return _CUDA_VSTD::move(__current_);
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr range_reference_t<_View> operator*() const
+    {
+      return *__current_;
+    }
+
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES(__has_arrow<iterator_t<_View2>> _LIBCUDACXX_AND copyable<iterator_t<_View2>>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iterator_t<_View> operator->() const
+    {
+      return __current_;
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator++()
+    {
+      __current_ = __parent_->__find_next(_CUDA_VSTD::move(++__current_));
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES((!forward_range<_View2>) )
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void operator++(int)
+    {
+      ++*this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES(forward_range<_View2>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator operator++(int)
+    {
+      auto __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES(bidirectional_range<_View2>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator--()
+    {
+      do
+      {
+        --__current_;
+      } while (!_CUDA_VSTD::invoke(*__parent_->__pred_, *__current_));
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+    _LIBCUDACXX_REQUIRES(bidirectional_range<_View2>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator operator--(int)
+    {
+      auto __tmp = *this;
+      --*this;
+      return __tmp;
+    }
+
+    template <class _View2 = _View>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator==(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(equality_comparable<iterator_t<_View2>>)
+    {
+      return __x.__current_ == __y.__current_;
+    }
+#  if _CCCL_STD_VER <= 2017
+    template <class _View2 = _View>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator!=(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(equality_comparable<iterator_t<_View2>>)
+    {
+      return __x.__current_ != __y.__current_;
+    }
+#  endif // _CCCL_STD_VER <= 2017
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr range_rvalue_reference_t<_View>
+    iter_move(const __iterator& __it) noexcept(noexcept(_CUDA_VRANGES::iter_move(__it.__current_)))
+    {
+      return _CUDA_VRANGES::iter_move(__it.__current_);
+    }
+
+    template <class _View2 = _View>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr auto
+    iter_swap(const __iterator& __x,
+              const __iterator& __y) noexcept(noexcept(_CUDA_VRANGES::iter_swap(__x.__current_, __y.__current_)))
+      _LIBCUDACXX_TRAILING_REQUIRES(void)(indirectly_swappable<iterator_t<_View2>>)
+    {
+      return _CUDA_VRANGES::iter_swap(__x.__current_, __y.__current_);
+    }
+  };
+
+  class __sentinel
+  {
+  public:
+    sentinel_t<_View> __end_ = sentinel_t<_View>();
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __sentinel() = default;
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __sentinel(filter_view& __parent)
+        : __end_(_CUDA_VRANGES::end(__parent.__base_))
+    {}
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr sentinel_t<_View> base() const
+    {
+      return __end_;
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const __iterator& __x, const __sentinel& __y)
+    {
+      return __x.__current_ == __y.__end_;
+    }
+#  if _CCCL_STD_VER <= 2017
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const __sentinel& __x, const __iterator& __y)
+    {
+      return __y.__current_ == __x.__end_;
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const __iterator& __x, const __sentinel& __y)
+    {
+      return !(__x.__current_ == __y.__end_);
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const __sentinel& __x, const __iterator& __y)
+    {
+      return !(__y.__current_ == __x.__end_);
+    }
+#  endif // _CCCL_STD_VER <= 2017
+  };
+
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI filter_view()
+    requires default_initializable<_View> && default_initializable<_Pred>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(default_initializable<_View2> _LIBCUDACXX_AND default_initializable<_Pred>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr filter_view() noexcept(
+    is_nothrow_default_constructible_v<_View2> && is_nothrow_default_constructible_v<_Pred>)
+      : view_interface<filter_view<_View, _Pred>>()
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr filter_view(_View __base, _Pred __pred)
+      : view_interface<filter_view<_View, _Pred>>()
+      , __base_(_CUDA_VSTD::move(__base))
+      , __pred_(_CUDA_VSTD::in_place, _CUDA_VSTD::move(__pred))
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(copy_constructible<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() const&
+  {
+    return __base_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() &&
+  {
+    return _CUDA_VSTD::move(__base_);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Pred const& pred() const
+  {
+    return *__pred_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator begin()
+  {
+    _LIBCUDACXX_ASSERT(__pred_.__has_value(),
+                       "Trying to call begin() on a filter_view that does not have a valid predicate.");
+    if constexpr (forward_range<_View>)
+    {
+      if (!__cached_begin_.__has_value())
+      {
+        __cached_begin_.__emplace(__find_next(_CUDA_VRANGES::begin(__base_)));
+      }
+      return {*this, *__cached_begin_};
+    }
+    else
+    {
+      return {*this, __find_next(_CUDA_VRANGES::begin(__base_))};
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end()
+  {
+    if constexpr (common_range<_View>)
+    {
+      return __iterator{*this, _CUDA_VRANGES::end(__base_)};
+    }
+    else
+    {
+      return __sentinel{*this};
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+};
+
+template <class _Range, class _Pred>
+_CCCL_HOST_DEVICE filter_view(_Range&&, _Pred) -> filter_view<_CUDA_VIEWS::all_t<_Range>, _Pred>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES_ABI
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+_LIBCUDACXX_BEGIN_NAMESPACE_VIEWS
+_LIBCUDACXX_BEGIN_NAMESPACE_CPO(__filter)
+
+struct __fn
+{
+  template <class _Range, class _Pred>
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Range&& __range, _Pred&& __pred) const
+    noexcept(noexcept(filter_view(_CUDA_VSTD::forward<_Range>(__range), _CUDA_VSTD::forward<_Pred>(__pred))))
+      -> decltype(filter_view(_CUDA_VSTD::forward<_Range>(__range), _CUDA_VSTD::forward<_Pred>(__pred)))
+  {
+    return filter_view(_CUDA_VSTD::forward<_Range>(__range), _CUDA_VSTD::forward<_Pred>(__pred));
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Pred)
+  _LIBCUDACXX_REQUIRES(constructible_from<decay_t<_Pred>, _Pred>)
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Pred&& __pred) const noexcept(is_nothrow_constructible_v<decay_t<_Pred>, _Pred>)
+  {
+    return __range_adaptor_closure_t(_CUDA_VSTD::__bind_back(*this, _CUDA_VSTD::forward<_Pred>(__pred)));
+  }
+};
+_LIBCUDACXX_END_NAMESPACE_CPO
+
+inline namespace __cpo
+{
+_LIBCUDACXX_CPO_ACCESSIBILITY auto filter = __filter::__fn{};
+} // namespace __cpo
+
+_LIBCUDACXX_END_NAMESPACE_VIEWS
+
+_CCCL_DIAG_POP
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_FILTER_VIEW_H
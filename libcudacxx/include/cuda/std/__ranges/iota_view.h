@@ -0,0 +1,584 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_IOTA_VIEW_H
+#define _LIBCUDACXX___RANGES_IOTA_VIEW_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/arithmetic.h>
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__concepts/copyable.h>
+#include <cuda/std/__concepts/equality_comparable.h>
+#include <cuda/std/__concepts/invocable.h>
+#include <cuda/std/__concepts/same_as.h>
+#include <cuda/std/__concepts/semiregular.h>
+#include <cuda/std/__concepts/totally_ordered.h>
+#include <cuda/std/__functional/ranges_operations.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__iterator/unreachable_sentinel.h>
+#include <cuda/std/__ranges/enable_borrowed_range.h>
+#include <cuda/std/__ranges/view_interface.h>
+#include <cuda/std/__type_traits/common_type.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_copy_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/type_identity.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+// MSVC complains about [[msvc::no_unique_address]] prior to C++20 as a vendor extension
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4848)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+
+template <class _Int>
+struct __get_wider_signed
+{
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static auto __call()
+  {
+    if constexpr (sizeof(_Int) < sizeof(short))
+    {
+      return type_identity<short>{};
+    }
+    else if constexpr (sizeof(_Int) < sizeof(int))
+    {
+      return type_identity<int>{};
+    }
+    else if constexpr (sizeof(_Int) < sizeof(long))
+    {
+      return type_identity<long>{};
+    }
+    else
+    {
+      return type_identity<long long>{};
+    }
+
+    static_assert(sizeof(_Int) <= sizeof(long long),
+                  "Found integer-like type that is bigger than largest integer like type.");
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  using type = typename decltype(__call())::type;
+};
+
+template <class _Start>
+using _IotaDiffT = typename _If<(!integral<_Start> || sizeof(iter_difference_t<_Start>) > sizeof(_Start)),
+                                type_identity<iter_difference_t<_Start>>,
+                                __get_wider_signed<_Start>>::type;
+
+template <class _Iter>
+_LIBCUDACXX_CONCEPT_FRAGMENT(
+  __decrementable_,
+  requires(_Iter __i)(requires(incrementable<_Iter>),
+                      requires(same_as<decltype(--__i), _Iter&>),
+                      requires(same_as<decltype(__i--), _Iter>)));
+
+template <class _Iter>
+_LIBCUDACXX_CONCEPT __decrementable = _LIBCUDACXX_FRAGMENT(__decrementable_, _Iter);
+
+template <class _Iter>
+_LIBCUDACXX_CONCEPT_FRAGMENT(
+  __advanceable_,
+  requires(_Iter __i, const _Iter __j, const _IotaDiffT<_Iter> __n)(
+    requires(__decrementable<_Iter>),
+    requires(totally_ordered<_Iter>),
+    requires(same_as<decltype(__i += __n), _Iter&>),
+    requires(same_as<decltype(__i -= __n), _Iter&>),
+    (_Iter(__j + __n)),
+    (_Iter(__n + __j)),
+    (_Iter(__j - __n)),
+    requires(convertible_to<decltype(__j - __j), _IotaDiffT<_Iter>>)));
+
+template <class _Iter>
+_LIBCUDACXX_CONCEPT __advanceable = _LIBCUDACXX_FRAGMENT(__advanceable_, _Iter);
+
+template <class _Start>
+using __iota_iterator_concept =
+  _If<__advanceable<_Start>,
+      random_access_iterator_tag,
+      _If<__decrementable<_Start>,
+          bidirectional_iterator_tag,
+          _If<incrementable<_Start>, forward_iterator_tag, input_iterator_tag>>>;
+
+template <class _Start, class _BoundSentinel>
+_LIBCUDACXX_CONCEPT __iota_sized = (same_as<_Start, _BoundSentinel> && __advanceable<_Start>)
+                                || (integral<_Start> && integral<_BoundSentinel>)
+                                || sized_sentinel_for<_BoundSentinel, _Start>;
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES_ABI
+
+template <class _Start>
+struct __iota_view_iterator
+{
+  _Start __value_ = _Start();
+
+  using iterator_concept  = __iota_iterator_concept<_Start>;
+  using iterator_category = input_iterator_tag;
+  using value_type        = _Start;
+  using difference_type   = _IotaDiffT<_Start>;
+  using reference         = _Start;
+  using pointer           = void;
+
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI __iota_view_iterator()
+    requires default_initializable<_Start>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(default_initializable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator() noexcept(
+    is_nothrow_default_constructible_v<_Start2>)
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __iota_view_iterator(_Start __value)
+      : __value_(_CUDA_VSTD::move(__value))
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Start operator*() const
+    noexcept(is_nothrow_copy_constructible_v<_Start>)
+  {
+    return __value_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator& operator++()
+  {
+    ++__value_;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES((!incrementable<_Start2>) )
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void operator++(int)
+  {
+    ++*this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(incrementable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator operator++(int)
+  {
+    auto __tmp = *this;
+    ++*this;
+    return __tmp;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__decrementable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator& operator--()
+  {
+    --__value_;
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__decrementable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator operator--(int)
+  {
+    auto __tmp = *this;
+    --*this;
+    return __tmp;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__advanceable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator&
+  operator+=(difference_type __n)
+  {
+    if constexpr (__integer_like<_Start> && !__signed_integer_like<_Start>)
+    {
+      if (__n >= difference_type(0))
+      {
+        __value_ += static_cast<_Start>(__n);
+      }
+      else
+      {
+        __value_ -= static_cast<_Start>(-__n);
+      }
+    }
+    else
+    {
+      __value_ += __n;
+    }
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__advanceable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_iterator&
+  operator-=(difference_type __n)
+  {
+    if constexpr (__integer_like<_Start> && !__signed_integer_like<_Start>)
+    {
+      if (__n >= difference_type(0))
+      {
+        __value_ -= static_cast<_Start>(__n);
+      }
+      else
+      {
+        __value_ += static_cast<_Start>(-__n);
+      }
+    }
+    else
+    {
+      __value_ -= __n;
+    }
+    return *this;
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__advanceable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Start operator[](difference_type __n) const
+  {
+    return _Start(__value_ + __n);
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator==(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(equality_comparable<_Start2>)
+  {
+    return __x.__value_ == __y.__value_;
+  }
+#  if _CCCL_STD_VER <= 2017
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator!=(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(equality_comparable<_Start2>)
+  {
+    return __x.__value_ != __y.__value_;
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator<(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(totally_ordered<_Start2>)
+  {
+    return __x.__value_ < __y.__value_;
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator>(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(totally_ordered<_Start2>)
+  {
+    return __y < __x;
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator<=(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(totally_ordered<_Start2>)
+  {
+    return !(__y < __x);
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator>=(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(totally_ordered<_Start2>)
+  {
+    return !(__x < __y);
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator+(__iota_view_iterator __i, difference_type __n)
+    _LIBCUDACXX_TRAILING_REQUIRES(__iota_view_iterator)(__advanceable<_Start2>)
+  {
+    __i += __n;
+    return __i;
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator+(difference_type __n, __iota_view_iterator __i)
+    _LIBCUDACXX_TRAILING_REQUIRES(__iota_view_iterator)(__advanceable<_Start2>)
+  {
+    return __i + __n;
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator-(__iota_view_iterator __i, difference_type __n)
+    _LIBCUDACXX_TRAILING_REQUIRES(__iota_view_iterator)(__advanceable<_Start2>)
+  {
+    __i -= __n;
+    return __i;
+  }
+
+  template <class _Start2 = _Start>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator-(const __iota_view_iterator& __x, const __iota_view_iterator& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(difference_type)(__advanceable<_Start2>)
+  {
+    if constexpr (__integer_like<_Start>)
+    {
+      if constexpr (__signed_integer_like<_Start>)
+      {
+        return difference_type(difference_type(__x.__value_) - difference_type(__y.__value_));
+      }
+      else if (__y.__value_ > __x.__value_)
+      {
+        return difference_type(-difference_type(__y.__value_ - __x.__value_));
+      }
+      else
+      {
+        return difference_type(__x.__value_ - __y.__value_);
+      }
+    }
+    else
+    {
+      return __x.__value_ - __y.__value_;
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+};
+
+template <class _Start, class _BoundSentinel>
+struct __iota_view_sentinel
+{
+  _BoundSentinel __bound_sentinel_ = _BoundSentinel();
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iota_view_sentinel() = default;
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __iota_view_sentinel(
+    _BoundSentinel __bound_sentinel)
+      : __bound_sentinel_(_CUDA_VSTD::move(__bound_sentinel))
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator==(const __iota_view_iterator<_Start>& __x, const __iota_view_sentinel& __y)
+  {
+    return __x.__value_ == __y.__bound_sentinel_;
+  }
+#  if _CCCL_STD_VER <= 2017
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator==(const __iota_view_sentinel& __x, const __iota_view_iterator<_Start>& __y)
+  {
+    return __y.__value_ == __x.__bound_sentinel_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator!=(const __iota_view_iterator<_Start>& __x, const __iota_view_sentinel& __y)
+  {
+    return !(__x.__value_ == __y.__bound_sentinel_);
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+  operator!=(const __iota_view_sentinel& __x, const __iota_view_iterator<_Start>& __y)
+  {
+    return !(__y.__value_ == __x.__bound_sentinel_);
+  }
+#  endif // _CCCL_STD_VER <= 2017
+
+  template <class _BoundSentinel2 = _BoundSentinel>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator-(const __iota_view_iterator<_Start>& __x, const __iota_view_sentinel& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(iter_difference_t<_Start>)(sized_sentinel_for<_BoundSentinel2, _Start>)
+  {
+    return __x.__value_ - __y.__bound_sentinel_;
+  }
+
+  template <class _BoundSentinel2 = _BoundSentinel>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+  operator-(const __iota_view_sentinel& __x, const __iota_view_iterator<_Start>& __y)
+    _LIBCUDACXX_TRAILING_REQUIRES(iter_difference_t<_Start>)(sized_sentinel_for<_BoundSentinel2, _Start>)
+  {
+    return -(__y - __x);
+  }
+};
+
+#  if _CCCL_STD_VER >= 2020
+template <weakly_incrementable _Start, semiregular _BoundSentinel = unreachable_sentinel_t>
+  requires __weakly_equality_comparable_with<_Start, _BoundSentinel> && copyable<_Start>
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+template <class _Start,
+          class _BoundSentinel                                                           = unreachable_sentinel_t,
+          enable_if_t<weakly_incrementable<_Start>, int>                                 = 0,
+          enable_if_t<semiregular<_BoundSentinel>, int>                                  = 0,
+          enable_if_t<__weakly_equality_comparable_with<_Start, _BoundSentinel>, int> = 0,
+          enable_if_t<copyable<_Start>, int>                                             = 0>
+#  endif // _CCCL_STD_VER <= 2017
+class iota_view : public view_interface<iota_view<_Start, _BoundSentinel>>
+{
+  using __iterator = __iota_view_iterator<_Start>;
+  using __sentinel = __iota_view_sentinel<_Start, _BoundSentinel>;
+
+  _Start __value_                                  = _Start();
+  _CCCL_NO_UNIQUE_ADDRESS _BoundSentinel __bound_sentinel_ = _BoundSentinel();
+
+public:
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI iota_view()
+    requires default_initializable<_Start>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(default_initializable<_Start2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iota_view() noexcept(
+    is_nothrow_default_constructible_v<_Start2>)
+      : view_interface<iota_view<_Start, _BoundSentinel>>()
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit iota_view(_Start __value)
+      : view_interface<iota_view<_Start, _BoundSentinel>>()
+      , __value_(_CUDA_VSTD::move(__value))
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iota_view(
+    type_identity_t<_Start> __value, type_identity_t<_BoundSentinel> __bound_sentinel)
+      : view_interface<iota_view<_Start, _BoundSentinel>>()
+      , __value_(_CUDA_VSTD::move(__value))
+      , __bound_sentinel_(_CUDA_VSTD::move(__bound_sentinel))
+  {
+    // Validate the precondition if possible.
+    if constexpr (totally_ordered_with<_Start, _BoundSentinel>)
+    {
+      _LIBCUDACXX_ASSERT(_CUDA_VRANGES::less_equal()(__value_, __bound_sentinel_),
+                         "Precondition violated: value is greater than bound.");
+    }
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _BoundSentinel2 = _BoundSentinel)
+  _LIBCUDACXX_REQUIRES(same_as<_Start, _BoundSentinel2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iota_view(__iterator __first, __iterator __last)
+      : iota_view(_CUDA_VSTD::move(__first.__value_), _CUDA_VSTD::move(__last.__value_))
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _BoundSentinel2 = _BoundSentinel)
+  _LIBCUDACXX_REQUIRES(same_as<_BoundSentinel2, unreachable_sentinel_t>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iota_view(__iterator __first, _BoundSentinel __last)
+      : iota_view(_CUDA_VSTD::move(__first.__value_), _CUDA_VSTD::move(__last))
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _BoundSentinel2 = _BoundSentinel)
+  _LIBCUDACXX_REQUIRES((!same_as<_Start, _BoundSentinel2>) _LIBCUDACXX_AND(
+    !same_as<_BoundSentinel2, unreachable_sentinel_t>))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr iota_view(__iterator __first, __sentinel __last)
+      : iota_view(_CUDA_VSTD::move(__first.__value_), _CUDA_VSTD::move(__last.__bound_sentinel_))
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator begin() const
+  {
+    return __iterator{__value_};
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end() const
+  {
+    if constexpr (same_as<_BoundSentinel, unreachable_sentinel_t>)
+    {
+      return unreachable_sentinel;
+    }
+    else if constexpr (same_as<_Start, _BoundSentinel>)
+    {
+      return __iterator{__bound_sentinel_};
+    }
+    else
+    {
+      return __sentinel{__bound_sentinel_};
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Start2 = _Start)
+  _LIBCUDACXX_REQUIRES(__iota_sized<_Start2, _BoundSentinel>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size() const
+  {
+    if constexpr (__integer_like<_Start> && __integer_like<_BoundSentinel>)
+    {
+      using _Up = make_unsigned_t<common_type_t<_Start, _BoundSentinel>>;
+      if (__value_ < 0)
+      {
+        if (__bound_sentinel_ < 0)
+        {
+          return static_cast<_Up>(
+            _CUDA_VSTD::__to_unsigned_like(-__value_) - _CUDA_VSTD::__to_unsigned_like(-__bound_sentinel_));
+        }
+        return static_cast<_Up>(
+          _CUDA_VSTD::__to_unsigned_like(__bound_sentinel_) + _CUDA_VSTD::__to_unsigned_like(-__value_));
+      }
+      return static_cast<_Up>(
+        _CUDA_VSTD::__to_unsigned_like(__bound_sentinel_) - _CUDA_VSTD::__to_unsigned_like(__value_));
+    }
+    else
+    {
+      return _CUDA_VSTD::__to_unsigned_like(__bound_sentinel_ - __value_);
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+};
+
+template <class _Start, class _BoundSentinel>
+_CCCL_HOST_DEVICE iota_view(_Start, _BoundSentinel) -> iota_view<_Start, _BoundSentinel>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES_ABI
+
+template <class _Start, class _BoundSentinel>
+_LIBCUDACXX_INLINE_VAR constexpr bool enable_borrowed_range<iota_view<_Start, _BoundSentinel>> = true;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+_LIBCUDACXX_BEGIN_NAMESPACE_VIEWS
+_LIBCUDACXX_BEGIN_NAMESPACE_CPO(__iota)
+
+struct __fn
+{
+  template <class _Start>
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Start&& __start) const
+    noexcept(noexcept(_CUDA_VRANGES::iota_view(_CUDA_VSTD::forward<_Start>(__start))))
+      -> decltype(_CUDA_VRANGES::iota_view(_CUDA_VSTD::forward<_Start>(__start)))
+  {
+    return _CUDA_VRANGES::iota_view(_CUDA_VSTD::forward<_Start>(__start));
+  }
+
+  template <class _Start, class _BoundSentinel>
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Start&& __start, _BoundSentinel&& __bound_sentinel) const
+    noexcept(noexcept(_CUDA_VRANGES::iota_view(_CUDA_VSTD::forward<_Start>(__start),
+                                               _CUDA_VSTD::forward<_BoundSentinel>(__bound_sentinel))))
+      -> decltype(_CUDA_VRANGES::iota_view(_CUDA_VSTD::forward<_Start>(__start),
+                                           _CUDA_VSTD::forward<_BoundSentinel>(__bound_sentinel)))
+  {
+    return _CUDA_VRANGES::iota_view(
+      _CUDA_VSTD::forward<_Start>(__start), _CUDA_VSTD::forward<_BoundSentinel>(__bound_sentinel));
+  }
+};
+_LIBCUDACXX_END_NAMESPACE_CPO
+
+inline namespace __cpo
+{
+_LIBCUDACXX_CPO_ACCESSIBILITY auto iota = __iota::__fn{};
+} // namespace __cpo
+
+_LIBCUDACXX_END_NAMESPACE_VIEWS
+
+_CCCL_DIAG_POP
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_IOTA_VIEW_H
@@ -0,0 +1,190 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_MOVABLE_BOX_H
+#define _LIBCUDACXX___RANGES_MOVABLE_BOX_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/copyable.h>
+#include <cuda/std/__concepts/movable.h>
+#include <cuda/std/__memory/addressof.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_copy_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_move_constructible.h>
+#include <cuda/std/__type_traits/is_object.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/in_place.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/optional>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+
+// __movable_box allows turning a type that is move-constructible (but maybe not move-assignable) into
+// a type that is both move-constructible and move-assignable. It also allows making a type that is
+// copy-constructible (but maybe not copy-assignable) into a type that is both copy-constructible and
+// copy-assignable. This is used by the views to store function objects, e.g. lambdas, which are only
+// required to be constructible, while the views themselves must be assignable.
+
+template <class _Tp>
+_LIBCUDACXX_CONCEPT __movable_box_object = move_constructible<_Tp> && is_object_v<_Tp>;
+
+// Types that are already assignable do not need the empty state that `optional` provides.
+template <class _Tp>
+_LIBCUDACXX_CONCEPT __doesnt_need_empty_state =
+  (copy_constructible<_Tp> && copyable<_Tp>) || (!copy_constructible<_Tp> && movable<_Tp>);
+
+template <class _Tp, bool = __doesnt_need_empty_state<_Tp>>
+class __movable_box
+{
+  static_assert(__movable_box_object<_Tp>, "__movable_box requires a move constructible object type");
+
+  _CUDA_VSTD::optional<_Tp> __val_;
+
+public:
+  _LIBCUDACXX_TEMPLATE(class... _Args)
+  _LIBCUDACXX_REQUIRES(is_constructible_v<_Tp, _Args...>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __movable_box(
+    in_place_t, _Args&&... __args) noexcept(is_nothrow_constructible_v<_Tp, _Args...>)
+      : __val_(in_place, _CUDA_VSTD::forward<_Args>(__args)...)
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _Tp2 = _Tp)
+  _LIBCUDACXX_REQUIRES(default_initializable<_Tp2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __movable_box() noexcept(
+    is_nothrow_default_constructible_v<_Tp2>)
+      : __val_(in_place)
+  {}
+
+  __movable_box(__movable_box const&) = default;
+  __movable_box(__movable_box&&)      = default;
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __movable_box&
+  operator=(__movable_box const& __other) noexcept(is_nothrow_copy_constructible_v<_Tp>)
+  {
+    if (this != _CUDA_VSTD::addressof(__other))
+    {
+      if (__other.__has_value())
+      {
+        __val_.emplace(*__other);
+      }
+      else
+      {
+        __val_.reset();
+      }
+    }
+    return *this;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __movable_box&
+  operator=(__movable_box&& __other) noexcept(is_nothrow_move_constructible_v<_Tp>)
+  {
+    if (this != _CUDA_VSTD::addressof(__other))
+    {
+      if (__other.__has_value())
+      {
+        __val_.emplace(_CUDA_VSTD::move(*__other));
+      }
+      else
+      {
+        __val_.reset();
+      }
+    }
+    return *this;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp const& operator*() const noexcept
+  {
+    return *__val_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp& operator*() noexcept
+  {
+    return *__val_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr const _Tp* operator->() const noexcept
+  {
+    return __val_.operator->();
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp* operator->() noexcept
+  {
+    return __val_.operator->();
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr bool __has_value() const noexcept
+  {
+    return __val_.has_value();
+  }
+};
+
+// Optimization: if the type is already assignable we can store it directly and never be empty.
+template <class _Tp>
+class __movable_box<_Tp, true>
+{
+  static_assert(__movable_box_object<_Tp>, "__movable_box requires a move constructible object type");
+
+  _CCCL_NO_UNIQUE_ADDRESS _Tp __val_;
+
+public:
+  _LIBCUDACXX_TEMPLATE(class... _Args)
+  _LIBCUDACXX_REQUIRES(is_constructible_v<_Tp, _Args...>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __movable_box(
+    in_place_t, _Args&&... __args) noexcept(is_nothrow_constructible_v<_Tp, _Args...>)
+      : __val_(_CUDA_VSTD::forward<_Args>(__args)...)
+  {}
+
+  _LIBCUDACXX_TEMPLATE(class _Tp2 = _Tp)
+  _LIBCUDACXX_REQUIRES(default_initializable<_Tp2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __movable_box() noexcept(
+    is_nothrow_default_constructible_v<_Tp2>)
+      : __val_()
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp const& operator*() const noexcept
+  {
+    return __val_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp& operator*() noexcept
+  {
+    return __val_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr const _Tp* operator->() const noexcept
+  {
+    return _CUDA_VSTD::addressof(__val_);
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp* operator->() noexcept
+  {
+    return _CUDA_VSTD::addressof(__val_);
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr bool __has_value() const noexcept
+  {
+    return true;
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_MOVABLE_BOX_H
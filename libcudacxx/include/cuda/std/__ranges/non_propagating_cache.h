@@ -0,0 +1,110 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_NON_PROPAGATING_CACHE_H
+#define _LIBCUDACXX___RANGES_NON_PROPAGATING_CACHE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__memory/addressof.h>
+#include <cuda/std/__type_traits/is_object.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/detail/libcxx/include/optional>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+
+// __non_propagating_cache is a helper type that allows storing an optional value in it,
+// but which does not copy the source's value when it is copy constructed/assigned to,
+// and which resets the source's value when it is moved-from.
+//
+// This type is used as an implementation detail of some views that need to cache the
+// result of `begin()` in order to provide an amortized O(1) begin() method. Typically,
+// we don't want to propagate the value of the cache upon copy because the cached iterator
+// may refer to internal details of the source view.
+template <class _Tp>
+class __non_propagating_cache
+{
+  static_assert(is_object_v<_Tp>, "__non_propagating_cache requires an object type");
+
+  _CUDA_VSTD::optional<_Tp> __value_;
+
+public:
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __non_propagating_cache() noexcept
+      : __value_()
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __non_propagating_cache(
+    __non_propagating_cache const&) noexcept
+      : __value_()
+  {}
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __non_propagating_cache(
+    __non_propagating_cache&& __other) noexcept
+      : __value_()
+  {
+    __other.__value_.reset();
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __non_propagating_cache&
+  operator=(__non_propagating_cache const& __other) noexcept
+  {
+    if (this != _CUDA_VSTD::addressof(__other))
+    {
+      __value_.reset();
+    }
+    return *this;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __non_propagating_cache&
+  operator=(__non_propagating_cache&& __other) noexcept
+  {
+    __value_.reset();
+    __other.__value_.reset();
+    return *this;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp& operator*()
+  {
+    return *__value_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp const& operator*() const
+  {
+    return *__value_;
+  }
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr bool __has_value() const
+  {
+    return __value_.has_value();
+  }
+
+  template <class... _Args>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp& __emplace(_Args&&... __args)
+  {
+    return __value_.emplace(_CUDA_VSTD::forward<_Args>(__args)...);
+  }
+};
+
+struct __empty_cache
+{};
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_NON_PROPAGATING_CACHE_H
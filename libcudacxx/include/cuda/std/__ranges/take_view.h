@@ -0,0 +1,304 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_TAKE_VIEW_H
+#define _LIBCUDACXX___RANGES_TAKE_VIEW_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__functional/bind_back.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/counted_iterator.h>
+#include <cuda/std/__iterator/default_sentinel.h>
+#include <cuda/std/__ranges/access.h>
+#include <cuda/std/__ranges/all.h>
+#include <cuda/std/__ranges/concepts.h>
+#include <cuda/std/__ranges/enable_borrowed_range.h>
+#include <cuda/std/__ranges/range_adaptor.h>
+#include <cuda/std/__ranges/size.h>
+#include <cuda/std/__ranges/view_interface.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_nothrow_constructible.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__type_traits/maybe_const.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/__assert>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+// MSVC complains about [[msvc::no_unique_address]] prior to C++20 as a vendor extension
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4848)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES_ABI
+
+#  if _CCCL_STD_VER >= 2020
+template <view _View>
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+template <class _View, enable_if_t<view<_View>, int> = 0>
+#  endif // _CCCL_STD_VER <= 2017
+class take_view : public view_interface<take_view<_View>>
+{
+  _CCCL_NO_UNIQUE_ADDRESS _View __base_ = _View();
+  range_difference_t<_View> __count_    = 0;
+
+  // Sized random access ranges are truncated directly and keep their own iterators, so that
+  // `views::take` does not add any indirection on the common case of contiguous memory.
+  template <class _Base>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr auto
+  __begin(_Base& __base, range_difference_t<_Base> __count)
+  {
+    if constexpr (sized_range<_Base>)
+    {
+      if constexpr (random_access_range<_Base>)
+      {
+        return _CUDA_VRANGES::begin(__base);
+      }
+      else
+      {
+        return counted_iterator(_CUDA_VRANGES::begin(__base), __min_size(__base, __count));
+      }
+    }
+    else
+    {
+      return counted_iterator(_CUDA_VRANGES::begin(__base), __count);
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  template <class _Base>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr range_difference_t<_Base>
+  __min_size(_Base& __base, range_difference_t<_Base> __count)
+  {
+    const auto __size = static_cast<range_difference_t<_Base>>(_CUDA_VRANGES::size(__base));
+    return __size < __count ? __size : __count;
+  }
+
+public:
+  template <bool _Const>
+  class __sentinel
+  {
+    using _Base = __maybe_const<_Const, _View>;
+    using _Iter = counted_iterator<iterator_t<_Base>>;
+
+  public:
+    _CCCL_NO_UNIQUE_ADDRESS sentinel_t<_Base> __end_ = sentinel_t<_Base>();
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __sentinel() = default;
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __sentinel(sentinel_t<_Base> __end)
+        : __end_(_CUDA_VSTD::move(__end))
+    {}
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = !_Const)
+    _LIBCUDACXX_REQUIRES((_Const && !_OtherConst) _LIBCUDACXX_AND convertible_to<sentinel_t<_View>, sentinel_t<_Base>>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __sentinel(__sentinel<_OtherConst> __s)
+        : __end_(_CUDA_VSTD::move(__s.__end_))
+    {}
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr sentinel_t<_Base> base() const
+    {
+      return __end_;
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const _Iter& __lhs, const __sentinel& __rhs)
+    {
+      return __lhs.count() == 0 || __lhs.base() == __rhs.__end_;
+    }
+#  if _CCCL_STD_VER <= 2017
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const __sentinel& __lhs, const _Iter& __rhs)
+    {
+      return __rhs.count() == 0 || __rhs.base() == __lhs.__end_;
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const _Iter& __lhs, const __sentinel& __rhs)
+    {
+      return !(__lhs == __rhs);
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const __sentinel& __lhs, const _Iter& __rhs)
+    {
+      return !(__rhs == __lhs);
+    }
+#  endif // _CCCL_STD_VER <= 2017
+  };
+
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI take_view()
+    requires default_initializable<_View>
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(default_initializable<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr take_view() noexcept(
+    is_nothrow_default_constructible_v<_View2>)
+      : view_interface<take_view<_View>>()
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr take_view(
+    _View __base, range_difference_t<_View> __count)
+      : view_interface<take_view<_View>>()
+      , __base_(_CUDA_VSTD::move(__base))
+      , __count_(__count)
+  {
+    _LIBCUDACXX_ASSERT(__count >= 0, "count has to be greater than or equal to zero");
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(copy_constructible<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() const&
+  {
+    return __base_;
+  }
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _View base() &&
+  {
+    return _CUDA_VSTD::move(__base_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES((!__simple_view<_View2>) )
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin()
+  {
+    return __begin(__base_, __count_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin() const
+  {
+    return __begin(__base_, __count_);
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES((!__simple_view<_View2>) )
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end()
+  {
+    if constexpr (sized_range<_View>)
+    {
+      if constexpr (random_access_range<_View>)
+      {
+        return _CUDA_VRANGES::begin(__base_) + __min_size(__base_, __count_);
+      }
+      else
+      {
+        return default_sentinel;
+      }
+    }
+    else
+    {
+      return __sentinel<false>{_CUDA_VRANGES::end(__base_)};
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end() const
+  {
+    if constexpr (sized_range<const _View>)
+    {
+      if constexpr (random_access_range<const _View>)
+      {
+        return _CUDA_VRANGES::begin(__base_) + __min_size(__base_, __count_);
+      }
+      else
+      {
+        return default_sentinel;
+      }
+    }
+    else
+    {
+      return __sentinel<true>{_CUDA_VRANGES::end(__base_)};
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(sized_range<_View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size()
+  {
+    const auto __size = _CUDA_VRANGES::size(__base_);
+    return (_CUDA_VSTD::min)(__size, static_cast<decltype(__size)>(__count_));
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _View2 = _View)
+  _LIBCUDACXX_REQUIRES(sized_range<const _View2>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size() const
+  {
+    const auto __size = _CUDA_VRANGES::size(__base_);
+    return (_CUDA_VSTD::min)(__size, static_cast<decltype(__size)>(__count_));
+  }
+};
+
+template <class _Range>
+_CCCL_HOST_DEVICE take_view(_Range&&, range_difference_t<_Range>) -> take_view<_CUDA_VIEWS::all_t<_Range>>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES_ABI
+
+template <class _Tp>
+_LIBCUDACXX_INLINE_VAR constexpr bool enable_borrowed_range<take_view<_Tp>> = enable_borrowed_range<_Tp>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+_LIBCUDACXX_BEGIN_NAMESPACE_VIEWS
+_LIBCUDACXX_BEGIN_NAMESPACE_CPO(__take)
+
+struct __fn
+{
+  _LIBCUDACXX_TEMPLATE(class _Range, class _Np)
+  _LIBCUDACXX_REQUIRES(viewable_range<_Range> _LIBCUDACXX_AND convertible_to<_Np, range_difference_t<_Range>>)
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Range&& __range, _Np&& __n) const
+    noexcept(noexcept(take_view(_CUDA_VSTD::forward<_Range>(__range),
+                                static_cast<range_difference_t<_Range>>(_CUDA_VSTD::forward<_Np>(__n)))))
+  {
+    return take_view(_CUDA_VSTD::forward<_Range>(__range),
+                     static_cast<range_difference_t<_Range>>(_CUDA_VSTD::forward<_Np>(__n)));
+  }
+
+  _LIBCUDACXX_TEMPLATE(class _Np)
+  _LIBCUDACXX_REQUIRES(constructible_from<decay_t<_Np>, _Np>)
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto operator()(_Np&& __n) const
+    noexcept(is_nothrow_constructible_v<decay_t<_Np>, _Np>)
+  {
+    return __range_adaptor_closure_t(_CUDA_VSTD::__bind_back(*this, _CUDA_VSTD::forward<_Np>(__n)));
+  }
+};
+_LIBCUDACXX_END_NAMESPACE_CPO
+
+inline namespace __cpo
+{
+_LIBCUDACXX_CPO_ACCESSIBILITY auto take = __take::__fn{};
+} // namespace __cpo
+
+_LIBCUDACXX_END_NAMESPACE_VIEWS
+
+_CCCL_DIAG_POP
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_TAKE_VIEW_H
@@ -0,0 +1,608 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+#ifndef _LIBCUDACXX___RANGES_ZIP_VIEW_H
+#define _LIBCUDACXX___RANGES_ZIP_VIEW_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/constructible.h>
+#include <cuda/std/__concepts/convertible_to.h>
+#include <cuda/std/__concepts/equality_comparable.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__iterator/iter_move.h>
+#include <cuda/std/__iterator/iter_swap.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__ranges/access.h>
+#include <cuda/std/__ranges/all.h>
+#include <cuda/std/__ranges/concepts.h>
+#include <cuda/std/__ranges/enable_borrowed_range.h>
+#include <cuda/std/__ranges/size.h>
+#include <cuda/std/__ranges/view_interface.h>
+#include <cuda/std/__type_traits/common_type.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_nothrow_default_constructible.h>
+#include <cuda/std/__type_traits/make_unsigned.h>
+#include <cuda/std/__type_traits/maybe_const.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/__utility/integer_sequence.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/detail/libcxx/include/tuple>
+
+#if _CCCL_STD_VER >= 2017 && !defined(_CCCL_COMPILER_MSVC_2017)
+
+// MSVC complains about [[msvc::no_unique_address]] prior to C++20 as a vendor extension
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4848)
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_all_forward = (forward_range<__maybe_const<_Const, _Views>> && ...);
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_all_bidirectional = (bidirectional_range<__maybe_const<_Const, _Views>> && ...);
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_all_random_access = (random_access_range<__maybe_const<_Const, _Views>> && ...);
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_all_sized = (sized_range<__maybe_const<_Const, _Views>> && ...);
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_all_common = (common_range<__maybe_const<_Const, _Views>> && ...);
+
+template <bool _Const, class... _Views>
+_LIBCUDACXX_CONCEPT __zip_is_common =
+  (sizeof...(_Views) == 1 && __zip_all_common<_Const, _Views...>)
+  || (!__zip_all_bidirectional<_Const, _Views...> && __zip_all_common<_Const, _Views...>)
+  || (__zip_all_random_access<_Const, _Views...> && __zip_all_sized<_Const, _Views...>);
+
+template <bool _Const, class... _Views>
+using __zip_view_iterator_concept =
+  _If<__zip_all_random_access<_Const, _Views...>,
+      random_access_iterator_tag,
+      _If<__zip_all_bidirectional<_Const, _Views...>,
+          bidirectional_iterator_tag,
+          _If<__zip_all_forward<_Const, _Views...>, forward_iterator_tag, input_iterator_tag>>>;
+
+template <class _Tp>
+_LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr _Tp __zip_abs(_Tp __t)
+{
+  return __t < 0 ? -__t : __t;
+}
+
+_LIBCUDACXX_BEGIN_NAMESPACE_RANGES_ABI
+
+template <class... _Views>
+class zip_view : public view_interface<zip_view<_Views...>>
+{
+  static_assert(sizeof...(_Views) > 0, "zip_view requires at least one view");
+  static_assert((view<_Views> && ...), "zip_view requires views");
+  static_assert((input_range<_Views> && ...), "zip_view requires input ranges");
+
+  using _Indices = index_sequence_for<_Views...>;
+
+  _CCCL_NO_UNIQUE_ADDRESS tuple<_Views...> __views_;
+
+  template <class _Self, size_t... _Idx>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr auto
+  __begins(_Self& __self, index_sequence<_Idx...>)
+  {
+    return tuple<decltype(_CUDA_VRANGES::begin(_CUDA_VSTD::get<_Idx>(__self.__views_)))...>{
+      _CUDA_VRANGES::begin(_CUDA_VSTD::get<_Idx>(__self.__views_))...};
+  }
+
+  template <class _Self, size_t... _Idx>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr auto
+  __ends(_Self& __self, index_sequence<_Idx...>)
+  {
+    return tuple<decltype(_CUDA_VRANGES::end(_CUDA_VSTD::get<_Idx>(__self.__views_)))...>{
+      _CUDA_VRANGES::end(_CUDA_VSTD::get<_Idx>(__self.__views_))...};
+  }
+
+  template <class _Self, size_t... _Idx>
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY static constexpr auto
+  __size(_Self& __self, index_sequence<_Idx...>)
+  {
+    using _CT =
+      make_unsigned_t<common_type_t<decltype(_CUDA_VRANGES::size(_CUDA_VSTD::get<_Idx>(__self.__views_)))...>>;
+    _CT __result = static_cast<_CT>(_CUDA_VRANGES::size(_CUDA_VSTD::get<0>(__self.__views_)));
+    _CT __sizes[] = {static_cast<_CT>(_CUDA_VRANGES::size(_CUDA_VSTD::get<_Idx>(__self.__views_)))...};
+    for (const _CT __s : __sizes)
+    {
+      __result = __s < __result ? __s : __result;
+    }
+    return __result;
+  }
+
+public:
+  template <bool _Const>
+  class __iterator
+  {
+    using _Tuple = tuple<iterator_t<__maybe_const<_Const, _Views>>...>;
+
+  public:
+    _Tuple __current_;
+
+    using iterator_concept  = __zip_view_iterator_concept<_Const, _Views...>;
+    using iterator_category = input_iterator_tag;
+    using value_type        = tuple<range_value_t<__maybe_const<_Const, _Views>>...>;
+    using difference_type   = common_type_t<range_difference_t<__maybe_const<_Const, _Views>>...>;
+    using reference         = tuple<range_reference_t<__maybe_const<_Const, _Views>>...>;
+    using pointer           = void;
+
+  private:
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto __deref(index_sequence<_Idx...>) const
+    {
+      return reference{*_CUDA_VSTD::get<_Idx>(__current_)...};
+    }
+
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+    __subscript(index_sequence<_Idx...>, difference_type __n) const
+    {
+      return reference{
+        _CUDA_VSTD::get<_Idx>(__current_)[static_cast<iter_difference_t<__tuple_element_t<_Idx, _Tuple>>>(__n)]...};
+    }
+
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void __increment(index_sequence<_Idx...>)
+    {
+      (++_CUDA_VSTD::get<_Idx>(__current_), ...);
+    }
+
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void __decrement(index_sequence<_Idx...>)
+    {
+      (--_CUDA_VSTD::get<_Idx>(__current_), ...);
+    }
+
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void
+    __advance(index_sequence<_Idx...>, difference_type __n)
+    {
+      ((_CUDA_VSTD::get<_Idx>(__current_) += static_cast<iter_difference_t<__tuple_element_t<_Idx, _Tuple>>>(__n)),
+       ...);
+    }
+
+  public:
+    template <class _OtherTuple, size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr bool
+    __any_equal(const _OtherTuple& __other, index_sequence<_Idx...>) const
+    {
+      return ((_CUDA_VSTD::get<_Idx>(__current_) == _CUDA_VSTD::get<_Idx>(__other)) || ...);
+    }
+
+    // Returns the difference with the smallest magnitude, so that the zipped range ends with its shortest member
+    template <class _OtherTuple, size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr difference_type
+    __min_distance(const _OtherTuple& __other, index_sequence<_Idx...>) const
+    {
+      difference_type __result =
+        static_cast<difference_type>(_CUDA_VSTD::get<0>(__current_) - _CUDA_VSTD::get<0>(__other));
+      difference_type __distances[] = {
+        static_cast<difference_type>(_CUDA_VSTD::get<_Idx>(__current_) - _CUDA_VSTD::get<_Idx>(__other))...};
+      for (const difference_type __d : __distances)
+      {
+        __result = _CUDA_VRANGES::__zip_abs(__d) < _CUDA_VRANGES::__zip_abs(__result) ? __d : __result;
+      }
+      return __result;
+    }
+
+  private:
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto __iter_move(index_sequence<_Idx...>) const
+    {
+      return tuple<range_rvalue_reference_t<__maybe_const<_Const, _Views>>...>{
+        _CUDA_VRANGES::iter_move(_CUDA_VSTD::get<_Idx>(__current_))...};
+    }
+
+    template <size_t... _Idx>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void
+    __iter_swap(const __iterator& __other, index_sequence<_Idx...>) const
+    {
+      (_CUDA_VRANGES::iter_swap(_CUDA_VSTD::get<_Idx>(__current_), _CUDA_VSTD::get<_Idx>(__other.__current_)), ...);
+    }
+
+  public:
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator() = default;
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __iterator(
+      tuple<iterator_t<__maybe_const<_Const, _Views>>...> __current)
+        : __current_(_CUDA_VSTD::move(__current))
+    {}
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = !_Const)
+    _LIBCUDACXX_REQUIRES((_Const && !_OtherConst)
+                           _LIBCUDACXX_AND(convertible_to<iterator_t<_Views>, iterator_t<const _Views>>&&...))
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator(__iterator<_OtherConst> __i)
+        : __current_(_CUDA_VSTD::move(__i.__current_))
+    {}
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr reference operator*() const
+    {
+      return __deref(_Indices{});
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator++()
+    {
+      __increment(_Indices{});
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES((!__zip_all_forward<_OtherConst, _Views...>) )
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr void operator++(int)
+    {
+      ++*this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_forward<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator operator++(int)
+    {
+      auto __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_bidirectional<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator--()
+    {
+      __decrement(_Indices{});
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_bidirectional<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator operator--(int)
+    {
+      auto __tmp = *this;
+      --*this;
+      return __tmp;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_random_access<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator+=(difference_type __n)
+    {
+      __advance(_Indices{}, __n);
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_random_access<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __iterator& operator-=(difference_type __n)
+    {
+      __advance(_Indices{}, -__n);
+      return *this;
+    }
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = _Const)
+    _LIBCUDACXX_REQUIRES(__zip_all_random_access<_OtherConst, _Views...>)
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr reference operator[](difference_type __n) const
+    {
+      return __subscript(_Indices{}, __n);
+    }
+
+    // If all underlying iterators are bidirectional they are advanced in lockstep and comparing the whole tuple
+    // is exact. Otherwise the zipped range ends as soon as any of its members does.
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator==(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)((equality_comparable<iterator_t<__maybe_const<_OtherConst, _Views>>> && ...))
+    {
+      if constexpr (__zip_all_bidirectional<_Const, _Views...>)
+      {
+        return __x.__current_ == __y.__current_;
+      }
+      else
+      {
+        return __x.__any_equal(__y.__current_, _Indices{});
+      }
+      _LIBCUDACXX_UNREACHABLE();
+    }
+#  if _CCCL_STD_VER <= 2017
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator!=(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)((equality_comparable<iterator_t<__maybe_const<_OtherConst, _Views>>> && ...))
+    {
+      return !(__x == __y);
+    }
+#  endif // _CCCL_STD_VER <= 2017
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator<(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      return __x.__current_ < __y.__current_;
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator>(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      return __y < __x;
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator<=(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      return !(__y < __x);
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator>=(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(bool)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      return !(__x < __y);
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator+(const __iterator& __i, difference_type __n)
+      _LIBCUDACXX_TRAILING_REQUIRES(__iterator)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      auto __r = __i;
+      __r += __n;
+      return __r;
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator+(difference_type __n, const __iterator& __i)
+      _LIBCUDACXX_TRAILING_REQUIRES(__iterator)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      return __i + __n;
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator-(const __iterator& __i, difference_type __n)
+      _LIBCUDACXX_TRAILING_REQUIRES(__iterator)(__zip_all_random_access<_OtherConst, _Views...>)
+    {
+      auto __r = __i;
+      __r -= __n;
+      return __r;
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator-(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(difference_type)(
+        (sized_sentinel_for<iterator_t<__maybe_const<_OtherConst, _Views>>,
+                            iterator_t<__maybe_const<_OtherConst, _Views>>>
+         && ...))
+    {
+      return __x.__min_distance(__y.__current_, _Indices{});
+    }
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr auto iter_move(const __iterator& __i)
+    {
+      return __i.__iter_move(_Indices{});
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY friend constexpr auto
+    iter_swap(const __iterator& __x, const __iterator& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(void)((indirectly_swappable<iterator_t<__maybe_const<_OtherConst, _Views>>> && ...))
+    {
+      __x.__iter_swap(__y, _Indices{});
+    }
+  };
+
+  template <bool _Const>
+  class __sentinel
+  {
+  public:
+    tuple<sentinel_t<__maybe_const<_Const, _Views>>...> __end_;
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __sentinel() = default;
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit __sentinel(
+      tuple<sentinel_t<__maybe_const<_Const, _Views>>...> __end)
+        : __end_(_CUDA_VSTD::move(__end))
+    {}
+
+    _LIBCUDACXX_TEMPLATE(bool _OtherConst = !_Const)
+    _LIBCUDACXX_REQUIRES((_Const && !_OtherConst)
+                           _LIBCUDACXX_AND(convertible_to<sentinel_t<_Views>, sentinel_t<const _Views>>&&...))
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr __sentinel(__sentinel<_OtherConst> __s)
+        : __end_(_CUDA_VSTD::move(__s.__end_))
+    {}
+
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const __iterator<_Const>& __x, const __sentinel& __y)
+    {
+      return __x.__any_equal(__y.__end_, _Indices{});
+    }
+#  if _CCCL_STD_VER <= 2017
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator==(const __sentinel& __x, const __iterator<_Const>& __y)
+    {
+      return __y.__any_equal(__x.__end_, _Indices{});
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const __iterator<_Const>& __x, const __sentinel& __y)
+    {
+      return !__x.__any_equal(__y.__end_, _Indices{});
+    }
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr bool
+    operator!=(const __sentinel& __x, const __iterator<_Const>& __y)
+    {
+      return !__y.__any_equal(__x.__end_, _Indices{});
+    }
+#  endif // _CCCL_STD_VER <= 2017
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator-(const __iterator<_Const>& __x, const __sentinel& __y)
+      _LIBCUDACXX_TRAILING_REQUIRES(common_type_t<range_difference_t<__maybe_const<_OtherConst, _Views>>...>)(
+        (sized_sentinel_for<sentinel_t<__maybe_const<_OtherConst, _Views>>,
+                            iterator_t<__maybe_const<_OtherConst, _Views>>>
+         && ...))
+    {
+      return __x.__min_distance(__y.__end_, _Indices{});
+    }
+
+    template <bool _OtherConst = _Const>
+    _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY _CCCL_NODISCARD_FRIEND constexpr auto
+    operator-(const __sentinel& __y, const __iterator<_Const>& __x)
+      _LIBCUDACXX_TRAILING_REQUIRES(common_type_t<range_difference_t<__maybe_const<_OtherConst, _Views>>...>)(
+        (sized_sentinel_for<sentinel_t<__maybe_const<_OtherConst, _Views>>,
+                            iterator_t<__maybe_const<_OtherConst, _Views>>>
+         && ...))
+    {
+      return -(__x - __y);
+    }
+  };
+
+#  if _CCCL_STD_VER >= 2020
+  _LIBCUDACXX_HIDE_FROM_ABI zip_view()
+    requires(default_initializable<_Views> && ...)
+  = default;
+#  else // ^^^ C++20 ^^^ / vvv C++17 vvv
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND(default_initializable<_Views>&&...))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr zip_view() noexcept(
+    (is_nothrow_default_constructible_v<_Views> && ...))
+      : view_interface<zip_view<_Views...>>()
+      , __views_()
+  {}
+#  endif // _CCCL_STD_VER <= 2017
+
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr explicit zip_view(_Views... __views)
+      : view_interface<zip_view<_Views...>>()
+      , __views_(_CUDA_VSTD::move(__views)...)
+  {}
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND(!(__simple_view<_Views> && ...)))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin()
+  {
+    return __iterator<false>(__begins(*this, _Indices{}));
+  }
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND(range<const _Views>&&...))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto begin() const
+  {
+    return __iterator<true>(__begins(*this, _Indices{}));
+  }
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND(!(__simple_view<_Views> && ...)))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end()
+  {
+    if constexpr (!__zip_is_common<false, _Views...>)
+    {
+      return __sentinel<false>(__ends(*this, _Indices{}));
+    }
+    else if constexpr (__zip_all_random_access<false, _Views...>)
+    {
+      return begin() + static_cast<iter_difference_t<__iterator<false>>>(size());
+    }
+    else
+    {
+      return __iterator<false>(__ends(*this, _Indices{}));
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND(range<const _Views>&&...))
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto end() const
+  {
+    if constexpr (!__zip_is_common<true, _Views...>)
+    {
+      return __sentinel<true>(__ends(*this, _Indices{}));
+    }
+    else if constexpr (__zip_all_random_access<true, _Views...>)
+    {
+      return begin() + static_cast<iter_difference_t<__iterator<true>>>(size());
+    }
+    else
+    {
+      return __iterator<true>(__ends(*this, _Indices{}));
+    }
+    _LIBCUDACXX_UNREACHABLE();
+  }
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND __zip_all_sized<false, _Views...>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size()
+  {
+    return __size(*this, _Indices{});
+  }
+
+  _LIBCUDACXX_TEMPLATE(bool _Dummy = true)
+  _LIBCUDACXX_REQUIRES(_Dummy _LIBCUDACXX_AND __zip_all_sized<true, _Views...>)
+  _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto size() const
+  {
+    return __size(*this, _Indices{});
+  }
+};
+
+template <class... _Ranges>
+_CCCL_HOST_DEVICE zip_view(_Ranges&&...) -> zip_view<_CUDA_VIEWS::all_t<_Ranges>...>;
+
+_LIBCUDACXX_END_NAMESPACE_RANGES_ABI
+
+template <class... _Views>
+_LIBCUDACXX_INLINE_VAR constexpr bool enable_borrowed_range<zip_view<_Views...>> =
+  (enable_borrowed_range<_Views> && ...);
+
+_LIBCUDACXX_END_NAMESPACE_RANGES
+
+_LIBCUDACXX_BEGIN_NAMESPACE_VIEWS
+_LIBCUDACXX_BEGIN_NAMESPACE_CPO(__zip)
+
+struct __fn
+{
+  _LIBCUDACXX_TEMPLATE(class... _Ranges)
+  _LIBCUDACXX_REQUIRES((sizeof...(_Ranges) > 0) _LIBCUDACXX_AND(viewable_range<_Ranges>&&...))
+  _CCCL_NODISCARD _LIBCUDACXX_HIDE_FROM_ABI _LIBCUDACXX_INLINE_VISIBILITY constexpr auto
+  operator()(_Ranges&&... __rs) const
+    noexcept(noexcept(zip_view<all_t<_Ranges&&>...>(_CUDA_VSTD::forward<_Ranges>(__rs)...)))
+  {
+    return zip_view<all_t<_Ranges>...>(_CUDA_VSTD::forward<_Ranges>(__rs)...);
+  }
+};
+_LIBCUDACXX_END_NAMESPACE_CPO
+
+inline namespace __cpo
+{
+_LIBCUDACXX_CPO_ACCESSIBILITY auto zip = __zip::__fn{};
+} // namespace __cpo
+
+_LIBCUDACXX_END_NAMESPACE_VIEWS
+
+_CCCL_DIAG_POP
+
+#endif // _CCCL_STD_VER >= 2017 && !_CCCL_COMPILER_MSVC_2017
+
+#endif // _LIBCUDACXX___RANGES_ZIP_VIEW_H
@@ -47,6 +47,102 @@ _LIBCUDACXX_INLINE_VISIBILITY inline constexpr int __cxx_atomic_failure_order_to
                         : (__order == memory_order_acq_rel ? __ATOMIC_ACQUIRE : __ATOMIC_CONSUME))));
 }
 
+#if defined(_LIBCUDACXX_HAS_HOST_CMPXCHG16B)
+
+// The builtins implement 16 byte atomics with the lock table of libatomic,
+// so these use cmpxchg16b, which all but the earliest x86-64 processors have.
+// On those few they fall back to a lock table of their own, so every operation
+// on 16 bytes has to go through __cxx_atomic_wide_cas.
+
+template <typename _Tp>
+struct __cxx_atomic_is_wide
+{
+  enum
+  {
+    __value = sizeof(__cxx_atomic_underlying_t<_Tp>) == 16
+  };
+};
+
+struct __cxx_atomic_wide_t
+{
+  uint64_t __lo;
+  uint64_t __hi;
+};
+
+inline bool __cxx_atomic_has_cmpxchg16b() noexcept
+{
+#  if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+  return true;
+#  else
+  static bool const __has_cmpxchg16b = []() {
+    unsigned __eax = 1, __ebx, __ecx = 0, __edx;
+    __asm__("cpuid" : "+a"(__eax), "=b"(__ebx), "+c"(__ecx), "=d"(__edx));
+    return ((__ecx >> 13) & 1) != 0;
+  }();
+  return __has_cmpxchg16b;
+#  endif
+}
+
+inline int* __cxx_atomic_wide_lock(void const volatile* __ptr) noexcept
+{
+  static int __locks[64] = {};
+  return &__locks[(reinterpret_cast<uintptr_t>(__ptr) >> 4) % 64];
+}
+
+// replaces the 16 bytes at __ptr with __desired if they equal *__expected,
+// else loads them into *__expected. Either way this is a full barrier.
+inline bool __cxx_atomic_wide_cas(
+  void const volatile* __ptr, __cxx_atomic_wide_t* __expected, __cxx_atomic_wide_t const& __desired) noexcept
+{
+  auto* const __target =
+    const_cast<__cxx_atomic_wide_t volatile*>(static_cast<__cxx_atomic_wide_t const volatile*>(__ptr));
+  if (__cxx_atomic_has_cmpxchg16b())
+  {
+    bool __result;
+    __asm__ __volatile__("lock cmpxchg16b %1\n\tsete %0"
+                         : "=q"(__result), "+m"(*__target), "+a"(__expected->__lo), "+d"(__expected->__hi)
+                         : "b"(__desired.__lo), "c"(__desired.__hi)
+                         : "cc", "memory");
+    return __result;
+  }
+
+  int* const __lock = __cxx_atomic_wide_lock(__ptr);
+  while (__atomic_exchange_n(__lock, 1, __ATOMIC_ACQUIRE) != 0)
+  {
+  }
+  __cxx_atomic_wide_t const __old = {__target->__lo, __target->__hi};
+  bool const __result             = __old.__lo == __expected->__lo && __old.__hi == __expected->__hi;
+  if (__result)
+  {
+    __target->__lo = __desired.__lo;
+    __target->__hi = __desired.__hi;
+  }
+  else
+  {
+    *__expected = __old;
+  }
+  __atomic_store_n(__lock, 0, __ATOMIC_RELEASE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  return __result;
+}
+
+template <typename _Tp>
+inline __cxx_atomic_wide_t __cxx_atomic_to_wide(_Tp const& __val) noexcept
+{
+  __cxx_atomic_wide_t __wide;
+  __builtin_memcpy(&__wide, &__val, sizeof(__wide));
+  return __wide;
+}
+
+// keeps the builtins below away from 16 byte types
+#  define _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp) , __enable_if_t<!__cxx_atomic_is_wide<_Tp>::__value, int> = 0
+
+#else
+
+#  define _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)
+
+#endif // _LIBCUDACXX_HAS_HOST_CMPXCHG16B
+
 template <typename _Tp, typename _Up>
 inline void __cxx_atomic_init(volatile _Tp* __a, _Up __val)
 {
@@ -71,14 +167,16 @@ inline void __cxx_atomic_signal_fence(memory_order __order)
   __atomic_signal_fence(__cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Up>
+// The locked atomics of <atomic> have no underlying type, which keeps these
+// away from them, as the return type does for the others.
+template <typename _Tp, typename _Up, typename = __cxx_atomic_underlying_t<_Tp> _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline void __cxx_atomic_store(_Tp* __a, _Up __val, memory_order __order)
 {
   auto __v_temp = __cxx_atomic_wrap_to_base(__a, __val);
   __atomic_store(__cxx_atomic_unwrap(__a), &__v_temp, __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp>
+template <typename _Tp _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_load(const _Tp* __a, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   auto __ret = __cxx_atomic_base_temporary(__a);
@@ -86,7 +184,7 @@ inline auto __cxx_atomic_load(const _Tp* __a, memory_order __order) -> __cxx_ato
   return *__cxx_get_underlying_atomic(&__ret);
 }
 
-template <typename _Tp, typename _Up>
+template <typename _Tp, typename _Up _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_exchange(_Tp* __a, _Up __val, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   auto __v_temp = __cxx_atomic_wrap_to_base(__a, __val);
@@ -95,7 +193,7 @@ inline auto __cxx_atomic_exchange(_Tp* __a, _Up __val, memory_order __order) ->
   return *__cxx_get_underlying_atomic(&__ret);
 }
 
-template <typename _Tp, typename _Up>
+template <typename _Tp, typename _Up, typename = __cxx_atomic_underlying_t<_Tp> _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline bool __cxx_atomic_compare_exchange_strong(
   _Tp* __a, _Up* __expected, _Up __value, memory_order __success, memory_order __failure)
 {
@@ -109,7 +207,7 @@ inline bool __cxx_atomic_compare_exchange_strong(
     __cxx_atomic_failure_order_to_int(__failure));
 }
 
-template <typename _Tp, typename _Up>
+template <typename _Tp, typename _Up, typename = __cxx_atomic_underlying_t<_Tp> _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline bool __cxx_atomic_compare_exchange_weak(
   _Tp* __a, _Up* __expected, _Up __value, memory_order __success, memory_order __failure)
 {
@@ -123,6 +221,63 @@ inline bool __cxx_atomic_compare_exchange_weak(
     __cxx_atomic_failure_order_to_int(__failure));
 }
 
+#if defined(_LIBCUDACXX_HAS_HOST_CMPXCHG16B)
+
+template <typename _Tp, typename _Up, __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value, int> = 0>
+inline bool __cxx_atomic_compare_exchange_strong(_Tp* __a, _Up* __expected, _Up __value, memory_order, memory_order)
+{
+  auto* const __ptr          = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
+  __cxx_atomic_wide_t __old = __cxx_atomic_to_wide(*__expected);
+  if (__cxx_atomic_wide_cas(__ptr, &__old, __cxx_atomic_to_wide(__value)))
+  {
+    return true;
+  }
+  __builtin_memcpy(__expected, &__old, sizeof(__old));
+  return false;
+}
+
+template <typename _Tp, typename _Up, __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value, int> = 0>
+inline bool __cxx_atomic_compare_exchange_weak(
+  _Tp* __a, _Up* __expected, _Up __value, memory_order __success, memory_order __failure)
+{
+  return __cxx_atomic_compare_exchange_strong(__a, __expected, __value, __success, __failure);
+}
+
+template <typename _Tp, __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value, int> = 0>
+inline auto __cxx_atomic_load(const _Tp* __a, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  // a failing compare exchange loads the value. It writes the value back when
+  // it succeeds, though, so even a load of a const atomic takes its cache line
+  // for writing, and faults if the atomic is in read only memory.
+  __cxx_atomic_wide_t __old = {0, 0};
+  __cxx_atomic_wide_cas(__cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a)), &__old, __old);
+  auto __ret = __cxx_atomic_base_temporary(__a);
+  __builtin_memcpy(__cxx_get_underlying_atomic(&__ret), &__old, sizeof(__old));
+  return *__cxx_get_underlying_atomic(&__ret);
+}
+
+template <typename _Tp, typename _Up, __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value, int> = 0>
+inline auto __cxx_atomic_exchange(_Tp* __a, _Up __val, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  auto* const __ptr                 = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
+  __cxx_atomic_wide_t const __value = __cxx_atomic_to_wide(__val);
+  __cxx_atomic_wide_t __old         = {0, 0};
+  while (!__cxx_atomic_wide_cas(__ptr, &__old, __value))
+  {
+  }
+  auto __ret = __cxx_atomic_base_temporary(__a);
+  __builtin_memcpy(__cxx_get_underlying_atomic(&__ret), &__old, sizeof(__old));
+  return *__cxx_get_underlying_atomic(&__ret);
+}
+
+template <typename _Tp, typename _Up, __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value, int> = 0>
+inline void __cxx_atomic_store(_Tp* __a, _Up __val, memory_order __order)
+{
+  (void) __cxx_atomic_exchange(__a, __val, __order);
+}
+
+#endif // _LIBCUDACXX_HAS_HOST_CMPXCHG16B
+
 template <typename _Tp>
 struct __atomic_ptr_inc
 {
@@ -150,7 +305,10 @@ template <typename _Tp, int n>
 struct __atomic_ptr_inc<_Tp[n]>
 {};
 
-template <typename _Tp, typename _Td, __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+template <typename _Tp,
+          typename _Td,
+          __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0
+            _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   constexpr auto __skip_v = __atomic_ptr_inc<__cxx_atomic_underlying_t<_Tp>>::value;
@@ -172,7 +330,10 @@ inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta, memory_order __order)
   return __expected;
 }
 
-template <typename _Tp, typename _Td, __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0>
+template <typename _Tp,
+          typename _Td,
+          __enable_if_t<!is_floating_point<__cxx_atomic_underlying_t<_Tp>>::value, int> = 0
+            _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   constexpr auto __skip_v = __atomic_ptr_inc<__cxx_atomic_underlying_t<_Tp>>::value;
@@ -194,27 +355,96 @@ inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta, memory_order __order)
   return __expected;
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_fetch_and(_Tp* __a, _Td __pattern, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
   return __atomic_fetch_and(__a_tmp, __pattern, __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_fetch_or(_Tp* __a, _Td __pattern, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
   return __atomic_fetch_or(__a_tmp, __pattern, __cxx_atomic_order_to_int(__order));
 }
 
-template <typename _Tp, typename _Td>
+template <typename _Tp, typename _Td _LIBCUDACXX_ATOMIC_NOT_WIDE(_Tp)>
 inline auto __cxx_atomic_fetch_xor(_Tp* __a, _Td __pattern, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
   auto __a_tmp = __cxx_get_underlying_atomic(__cxx_atomic_unwrap(__a));
   return __atomic_fetch_xor(__a_tmp, __pattern, __cxx_atomic_order_to_int(__order));
 }
 
+#if defined(_LIBCUDACXX_HAS_HOST_CMPXCHG16B)
+
+// The builtins would take the locks of libatomic for 16 byte integers, which
+// don't exclude the compare exchanges above, so these loop on those instead.
+template <typename _Tp, typename _Fn>
+inline auto __cxx_atomic_wide_fetch(_Tp* __a, _Fn __op) -> __cxx_atomic_underlying_t<_Tp>
+{
+  // the first compare exchange loads the value, unless it happens to be zero
+  __cxx_atomic_underlying_t<_Tp> __expected = 0;
+  while (!__cxx_atomic_compare_exchange_strong(
+    __a, &__expected, __op(__expected), memory_order_seq_cst, memory_order_seq_cst))
+  {
+  }
+  return __expected;
+}
+
+template <typename _Tp>
+using __cxx_atomic_wide_integral =
+  __enable_if_t<__cxx_atomic_is_wide<_Tp>::__value && is_integral<__cxx_atomic_underlying_t<_Tp>>::value, int>;
+
+template <typename _Tp, typename _Td, __cxx_atomic_wide_integral<_Tp> = 0>
+inline auto __cxx_atomic_fetch_add(_Tp* __a, _Td __delta, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  using _Up = __cxx_atomic_underlying_t<_Tp>;
+  using _Uu = __make_unsigned_t<_Up>;
+  return __cxx_atomic_wide_fetch(__a, [__delta](_Up __v) {
+    return static_cast<_Up>(static_cast<_Uu>(__v) + static_cast<_Uu>(__delta));
+  });
+}
+
+template <typename _Tp, typename _Td, __cxx_atomic_wide_integral<_Tp> = 0>
+inline auto __cxx_atomic_fetch_sub(_Tp* __a, _Td __delta, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  using _Up = __cxx_atomic_underlying_t<_Tp>;
+  using _Uu = __make_unsigned_t<_Up>;
+  return __cxx_atomic_wide_fetch(__a, [__delta](_Up __v) {
+    return static_cast<_Up>(static_cast<_Uu>(__v) - static_cast<_Uu>(__delta));
+  });
+}
+
+template <typename _Tp, typename _Td, __cxx_atomic_wide_integral<_Tp> = 0>
+inline auto __cxx_atomic_fetch_and(_Tp* __a, _Td __pattern, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  using _Up = __cxx_atomic_underlying_t<_Tp>;
+  return __cxx_atomic_wide_fetch(__a, [__pattern](_Up __v) {
+    return static_cast<_Up>(__v & __pattern);
+  });
+}
+
+template <typename _Tp, typename _Td, __cxx_atomic_wide_integral<_Tp> = 0>
+inline auto __cxx_atomic_fetch_or(_Tp* __a, _Td __pattern, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  using _Up = __cxx_atomic_underlying_t<_Tp>;
+  return __cxx_atomic_wide_fetch(__a, [__pattern](_Up __v) {
+    return static_cast<_Up>(__v | __pattern);
+  });
+}
+
+template <typename _Tp, typename _Td, __cxx_atomic_wide_integral<_Tp> = 0>
+inline auto __cxx_atomic_fetch_xor(_Tp* __a, _Td __pattern, memory_order) -> __cxx_atomic_underlying_t<_Tp>
+{
+  using _Up = __cxx_atomic_underlying_t<_Tp>;
+  return __cxx_atomic_wide_fetch(__a, [__pattern](_Up __v) {
+    return static_cast<_Up>(__v ^ __pattern);
+  });
+}
+
+#endif // _LIBCUDACXX_HAS_HOST_CMPXCHG16B
+
 template <typename _Tp, typename _Td>
 inline auto __cxx_atomic_fetch_max(_Tp* __a, _Td __val, memory_order __order) -> __cxx_atomic_underlying_t<_Tp>
 {
@@ -0,0 +1,197 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// Atomics of 16 byte types, e.g. the tagged pointers of ABA safe stacks.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+struct tagged
+{
+  cuda::std::uint64_t value;
+  cuda::std::uint64_t tag;
+};
+
+template <class Atomic>
+void increment(Atomic& a, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    tagged expected = a.load();
+    tagged desired;
+    do
+    {
+      desired = tagged{expected.value + 1, expected.tag + 2};
+    } while (!a.compare_exchange_weak(expected, desired));
+  }
+}
+
+template <class Atomic>
+void test_operations(Atomic& a)
+{
+  a.store(tagged{1, 2});
+  tagged t = a.load();
+  assert(t.value == 1 && t.tag == 2);
+
+  t = a.exchange(tagged{3, 4});
+  assert(t.value == 1 && t.tag == 2);
+
+  tagged expected{0, 0};
+  assert(!a.compare_exchange_strong(expected, tagged{5, 6}));
+  assert(expected.value == 3 && expected.tag == 4);
+  assert(a.compare_exchange_strong(expected, tagged{5, 6}));
+  t = a.load();
+  assert(t.value == 5 && t.tag == 6);
+}
+
+template <class Atomic>
+void test_concurrent(Atomic& a)
+{
+  constexpr int threads = 4;
+  constexpr int n       = 10000;
+
+  a.store(tagged{0, 0});
+
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; ++i)
+  {
+    workers.emplace_back([&]() {
+      increment(a, n);
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  tagged const t = a.load();
+  assert(t.value == threads * n);
+  assert(t.tag == 2 * threads * n);
+}
+
+// loads from const atomics, which may write to them
+template <class Atomic>
+void test_const_loads(Atomic& a)
+{
+  static const cuda::std::atomic<tagged> s(tagged{7, 8});
+  const cuda::std::atomic<tagged> c(tagged{9, 10});
+  assert(s.load().value == 7 && s.load().tag == 8);
+  assert(c.load().value == 9 && c.load(cuda::std::memory_order_relaxed).tag == 10);
+
+  constexpr int n = 10000;
+  a.store(tagged{0, 0});
+  const Atomic& r = a;
+
+  std::thread writer([&]() {
+    increment(a, n);
+  });
+  // the two halves are never torn and the values never go back; the reader
+  // does not wait for the writer, which it may starve when both take a lock
+  tagged last = r.load();
+  for (int i = 0; i < n; ++i)
+  {
+    tagged const t = r.load();
+    assert(t.tag == 2 * t.value);
+    assert(t.value >= last.value && t.value <= n);
+    last = t;
+  }
+  writer.join();
+  assert(r.load().tag == 2 * n);
+}
+
+#if !defined(_LIBCUDACXX_HAS_NO_INT128)
+void test_int128()
+{
+  using int128 = __int128_t;
+
+  int128 const high = int128(1) << 64;
+  cuda::std::atomic<int128> a(high - 1);
+
+  // the carries and borrows cross the halves
+  assert(a.fetch_add(1) == high - 1);
+  assert(a.load() == high);
+  assert(a.fetch_sub(2) == high);
+  assert(a.load() == high - 2);
+  assert((a += high) == 2 * high - 2);
+  assert(a.fetch_and(high | 1) == 2 * high - 2);
+  assert(a.load() == high);
+  assert(a.fetch_or(3) == high);
+  assert(a.fetch_xor(high | 1) == (high | 3));
+  assert(a.load() == 2);
+  assert(a.fetch_sub(3) == 2);
+  assert(a.load() == -1);
+
+  constexpr int threads = 4;
+  constexpr int n       = 10000;
+
+  a.store(0);
+  std::vector<std::thread> workers;
+  for (int i = 0; i < threads; ++i)
+  {
+    workers.emplace_back([&]() {
+      for (int j = 0; j < n; ++j)
+      {
+        a.fetch_add(high + 1);
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  assert(a.load() == threads * n * (high + 1));
+}
+#endif // !_LIBCUDACXX_HAS_NO_INT128
+
+void test()
+{
+  cuda::std::atomic<tagged> a(tagged{0, 0});
+  test_operations(a);
+  test_concurrent(a);
+  test_const_loads(a);
+
+#if !defined(_LIBCUDACXX_HAS_NO_INT128)
+  test_int128();
+#endif // !_LIBCUDACXX_HAS_NO_INT128
+
+#if defined(_LIBCUDACXX_HAS_HOST_CMPXCHG16B)
+#  if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+  static_assert(cuda::std::atomic<tagged>::is_always_lock_free, "");
+  static_assert(cuda::std::atomic_ref<tagged>::is_always_lock_free, "");
+  assert(a.is_lock_free());
+#  endif // __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+
+  alignas(16) tagged value{0, 0};
+  cuda::std::atomic_ref<tagged> ref(value);
+  static_assert(cuda::std::atomic_ref<tagged>::required_alignment == 16, "");
+  assert(ref.is_lock_free() == a.is_lock_free());
+  test_operations(ref);
+  test_concurrent(ref);
+  test_const_loads(ref);
+#endif // _LIBCUDACXX_HAS_HOST_CMPXCHG16B
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+
+  return 0;
+}
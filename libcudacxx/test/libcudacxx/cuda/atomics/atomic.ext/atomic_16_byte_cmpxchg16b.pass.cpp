@@ -0,0 +1,21 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvcc, nvrtc, nvc++
+
+// <cuda/std/atomic>
+
+// The 16 byte atomics of host only builds, with cmpxchg16b on x86-64.
+
+#if !defined(__CUDACC__)
+#  define LIBCUDACXX_ENABLE_HOST_CMPXCHG16B
+#endif
+#include "atomic_16_byte.pass.cpp"
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/atomic>
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+static_assert(alignof(cuda::sharded_counter<int, 4>) >= 64, "");
+static_assert(sizeof(cuda::sharded_counter<int, 4>) >= 4 * 64, "");
+static_assert(cuda::sharded_counter<int, 4>::shards() == 4, "");
+
+void test_reduce_add()
+{
+  cuda::std::atomic<int> a(1);
+  cuda::atomic_reduce_add(a, 2);
+  assert(a.load() == 3);
+
+  cuda::atomic<double, cuda::thread_scope_device> d(0.5);
+  cuda::atomic_reduce_add(d, 1.0, cuda::memory_order_release);
+  assert(d.load() == 1.5);
+
+  long l = 7;
+  cuda::atomic_ref<long> r(l);
+  cuda::atomic_reduce_add(r, -10);
+  assert(l == -3);
+}
+
+template <class T>
+void test_single_thread()
+{
+  cuda::sharded_counter<T, 8> c;
+  assert(c.load() == T(0));
+
+  c.add(T(5));
+  c.add(T(2));
+  c.sub(T(3));
+  assert(c.load() == T(4));
+
+  assert(c.reset() == T(4));
+  assert(c.load() == T(0));
+
+  cuda::sharded_counter<T, 8> initialized(T(9));
+  initialized.add(T(1));
+  assert(initialized.load() == T(10));
+}
+
+void test_concurrent()
+{
+  constexpr int threads   = 8;
+  constexpr int additions = 20000;
+
+  cuda::sharded_counter<cuda::std::uint64_t> c;
+  cuda::std::uint64_t drained = 0;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&c]() {
+      for (int i = 0; i < additions; ++i)
+      {
+        c.add(1);
+      }
+    });
+  }
+  // resets concurrent with the additions neither lose nor repeat any of them
+  for (int i = 0; i < 100; ++i)
+  {
+    drained += c.reset();
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  assert(drained + c.load() == cuda::std::uint64_t(threads) * additions);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_reduce_add(); test_single_thread<int>(); test_single_thread<unsigned char>();
+                test_single_thread<double>(); test_concurrent();))
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// Measures the throughput of host threads which count events with a single
+// cuda::std::atomic and with a cuda::sharded_counter against the number of
+// threads.
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+struct single_counter
+{
+  cuda::std::atomic<cuda::std::uint64_t> value{0};
+
+  void add(cuda::std::uint64_t op)
+  {
+    value.fetch_add(op);
+  }
+  cuda::std::uint64_t load() const
+  {
+    return value.load();
+  }
+};
+
+template <class Counter>
+double additions_per_us(int threads, int additions)
+{
+  Counter c;
+
+  std::vector<std::thread> workers;
+  auto const start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&]() {
+      for (int i = 0; i < additions; ++i)
+      {
+        c.add(1);
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  auto const stop = std::chrono::steady_clock::now();
+
+  assert(c.load() == cuda::std::uint64_t(threads) * additions);
+  return threads * additions / std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+void bench()
+{
+  constexpr int additions = 1000000;
+
+  unsigned const hardware_threads = std::thread::hardware_concurrency();
+
+  printf("%8s %20s %20s\n", "threads", "atomic (adds/us)", "sharded (adds/us)");
+  for (int threads = 1; threads <= 64; threads *= 2)
+  {
+    // oversubscribing measures the scheduler rather than the counter
+    if (hardware_threads != 0 && static_cast<unsigned>(threads) > hardware_threads)
+    {
+      break;
+    }
+    double const single  = additions_per_us<single_counter>(threads, additions);
+    double const sharded = additions_per_us<cuda::sharded_counter<cuda::std::uint64_t>>(threads, additions);
+    printf("%8d %20.1f %20.1f\n", threads, single, sharded);
+  }
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/atomic>
+
+#include <cuda/atomic>
+#include <cuda/barrier>
+#include <cuda/latch>
+#include <cuda/semaphore>
+#include <cuda/std/cassert>
+#include <cuda/std/chrono>
+
+#include <thread>
+
+#include "test_macros.h"
+
+void test_policy_is_per_thread()
+{
+  cuda::wait_policy const initial = cuda::get_wait_policy();
+  assert(initial.kind == cuda::wait_kind::spin_then_park);
+  assert(initial.spin_count > 0);
+
+  cuda::wait_policy const previous = cuda::set_wait_policy(cuda::wait_policy(cuda::wait_kind::spin, 100));
+  assert(previous.kind == initial.kind && previous.spin_count == initial.spin_count);
+  assert(cuda::get_wait_policy().kind == cuda::wait_kind::spin);
+  assert(cuda::get_wait_policy().spin_count == 100);
+
+  std::thread([]() {
+    assert(cuda::get_wait_policy().kind == cuda::wait_kind::spin_then_park);
+  }).join();
+
+  // negative spin counts mean no spinning
+  cuda::set_wait_policy(cuda::wait_policy(cuda::wait_kind::spin_then_park, -1));
+  assert(cuda::get_wait_policy().spin_count == 0);
+
+  cuda::set_wait_policy(initial);
+}
+
+// all waits return once their condition holds, whatever the policy
+void test_waits(cuda::wait_policy policy)
+{
+  cuda::std::atomic<int> flag(0);
+  cuda::std::barrier<> barrier(2);
+  cuda::std::latch latch(2);
+  cuda::std::counting_semaphore<> semaphore(0);
+  cuda::std::binary_semaphore binary(0);
+
+  std::thread other([&]() {
+    cuda::set_wait_policy(policy);
+    for (int i = 0; i < 100; ++i)
+    {
+      barrier.arrive_and_wait();
+    }
+    flag.store(1);
+    flag.notify_all();
+    latch.arrive_and_wait();
+    semaphore.release();
+    binary.release();
+  });
+
+  cuda::set_wait_policy(policy);
+  for (int i = 0; i < 100; ++i)
+  {
+    barrier.arrive_and_wait();
+  }
+  flag.wait(0);
+  assert(flag.load() == 1);
+  latch.arrive_and_wait();
+  semaphore.acquire();
+  assert(binary.try_acquire_for(cuda::std::chrono::seconds(10)));
+
+  // timed waits still give up
+  assert(!semaphore.try_acquire_for(cuda::std::chrono::milliseconds(1)));
+  assert(!binary.try_acquire_for(cuda::std::chrono::milliseconds(0)));
+
+  other.join();
+  cuda::set_wait_policy(cuda::wait_policy());
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_policy_is_per_thread();
+
+                test_waits(cuda::wait_policy());
+                test_waits(cuda::wait_policy(cuda::wait_kind::spin_then_park, 1000));
+                test_waits(cuda::wait_policy(cuda::wait_kind::spin));
+                test_waits(cuda::wait_policy(cuda::wait_kind::park));
+                test_waits(cuda::wait_policy(cuda::wait_kind::adaptive, 1000));))
+
+  return 0;
+}
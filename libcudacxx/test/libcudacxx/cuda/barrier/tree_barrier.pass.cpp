@@ -0,0 +1,166 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+#include <cuda/std/cassert>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+struct completion
+{
+  int* phases;
+
+  void operator()() noexcept
+  {
+    ++*phases;
+  }
+};
+
+// every thread checks that no other thread is ahead of it by a phase
+void test_arrive_and_wait(int threads)
+{
+  constexpr int rounds = 50;
+
+  int phases = 0;
+  cuda::tree_barrier<completion> b(threads, completion{&phases});
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&]() {
+      for (int i = 0; i < rounds; ++i)
+      {
+        b.arrive_and_wait();
+        assert(phases == 2 * i + 1);
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  assert(phases == 2 * rounds);
+}
+
+// half of the threads drop out, one after every phase
+void test_arrive_and_drop(int threads)
+{
+  int phases = 0;
+  cuda::tree_barrier<completion> b(threads, completion{&phases});
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&, t]() {
+      for (int i = 0; i < threads; ++i)
+      {
+        if (t < threads / 2 && i == t)
+        {
+          b.arrive_and_drop();
+          return;
+        }
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  assert(phases == threads);
+}
+
+// the completing thread drops out while the others already run the next
+// phases, which must not lose the release of a later phase
+void test_completer_drops(int threads)
+{
+  constexpr int rounds = 20;
+
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    int phases = 0;
+    std::atomic<int> arriving{0};
+    cuda::tree_barrier<completion> b(threads, completion{&phases});
+
+    std::vector<std::thread> workers;
+    workers.emplace_back([&]() {
+      while (arriving.load() != threads - 1)
+      {
+        std::this_thread::yield();
+      }
+      std::this_thread::yield();
+      b.arrive_and_drop();
+    });
+    for (int t = 1; t < threads; ++t)
+    {
+      workers.emplace_back([&]() {
+        ++arriving;
+        for (int i = 0; i < rounds; ++i)
+        {
+          b.arrive_and_wait();
+        }
+      });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    assert(phases == (threads == 1 ? 1 : rounds));
+  }
+}
+
+void test_arrive_update(int threads)
+{
+  int phases = 0;
+  cuda::tree_barrier<completion> b(2 * threads, completion{&phases});
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&]() {
+      for (int i = 0; i < 10; ++i)
+      {
+        b.wait(b.arrive(2));
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  assert(phases == 10);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (for (int threads : {1, 2, 17, 64}) {
+                 test_arrive_and_wait(threads);
+                 test_arrive_and_drop(threads);
+                 test_completer_drops(threads);
+                 test_arrive_update(threads);
+               }))
+
+  return 0;
+}
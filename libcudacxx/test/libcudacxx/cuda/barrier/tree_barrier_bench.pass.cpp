@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// Measures the latency of a phase of cuda::std::barrier and cuda::tree_barrier
+// for host threads against the number of threads.
+
+#include <cuda/barrier>
+#include <cuda/std/cassert>
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class Barrier>
+double phase_latency(int threads, int phases)
+{
+  Barrier b(threads);
+
+  std::vector<std::thread> workers;
+  auto const start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&]() {
+      for (int i = 0; i < phases; ++i)
+      {
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+  auto const stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::micro>(stop - start).count() / phases;
+}
+
+void bench()
+{
+  constexpr int phases = 1000;
+
+  unsigned const hardware_threads = std::thread::hardware_concurrency();
+
+  printf("%8s %20s %20s\n", "threads", "barrier (us/phase)", "tree_barrier (us/phase)");
+  for (int threads = 1; threads <= 64; threads *= 2)
+  {
+    // oversubscribing measures the scheduler rather than the barrier
+    if (hardware_threads != 0 && static_cast<unsigned>(threads) > hardware_threads)
+    {
+      break;
+    }
+    double const central = phase_latency<cuda::std::barrier<>>(threads, phases);
+    double const tree    = phase_latency<cuda::tree_barrier<>>(threads, phases);
+    printf("%8d %20.2f %20.2f\n", threads, central, tree);
+  }
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench();))
+
+  return 0;
+}
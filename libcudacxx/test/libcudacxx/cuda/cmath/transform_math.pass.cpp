@@ -0,0 +1,246 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: nvrtc
+
+// <cuda/cmath>
+
+#include <cuda/cmath>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class T>
+using int_of = typename cuda::std::conditional<sizeof(T) == 4, cuda::std::int32_t, cuda::std::int64_t>::type;
+
+// the number of representable numbers between x and y
+template <class T>
+long long ulp_distance(T x, T y)
+{
+  if (cuda::std::isnan(x) || cuda::std::isnan(y))
+  {
+    return cuda::std::isnan(x) && cuda::std::isnan(y) ? 0 : cuda::std::numeric_limits<long long>::max();
+  }
+  if (x == y)
+  {
+    return 0;
+  }
+  int_of<T> ix, iy;
+  memcpy(&ix, &x, sizeof(T));
+  memcpy(&iy, &y, sizeof(T));
+  // orders the representations of the negative numbers below the positive ones
+  ix = ix < 0 ? cuda::std::numeric_limits<int_of<T>>::min() - ix : ix;
+  iy = iy < 0 ? cuda::std::numeric_limits<int_of<T>>::min() - iy : iy;
+  return ix < iy ? static_cast<long long>(iy) - ix : static_cast<long long>(ix) - iy;
+}
+
+// the distance of complex numbers relative to the magnitude of the expected one
+template <class T>
+bool close(cuda::std::complex<T> x, cuda::std::complex<T> expected)
+{
+  if (!cuda::std::isfinite(expected.real()) || !cuda::std::isfinite(expected.imag()))
+  {
+    return ulp_distance(x.real(), expected.real()) == 0 && ulp_distance(x.imag(), expected.imag()) == 0;
+  }
+  return cuda::std::abs(x - expected) <= 8 * cuda::std::numeric_limits<T>::epsilon() * cuda::std::abs(expected);
+}
+
+template <class T, class Batched, class Scalar>
+void check_real(const std::vector<T>& in, Batched batched, Scalar scalar, long long max_ulp)
+{
+  std::vector<T> out(in.size());
+  batched(cuda::std::span<const T>(in.data(), in.size()), cuda::std::span<T>(out.data(), out.size()));
+  for (size_t i = 0; i < in.size(); ++i)
+  {
+    const T expected = scalar(in[i]);
+    assert(ulp_distance(out[i], expected) <= max_ulp);
+    // ulp_distance doesn't tell the zeros apart
+    assert(expected != T(0) || cuda::std::signbit(out[i]) == cuda::std::signbit(expected));
+  }
+
+  // in place
+  std::vector<T> inout(in);
+  batched(cuda::std::span<const T>(inout.data(), inout.size()), cuda::std::span<T>(inout.data(), inout.size()));
+  for (size_t i = 0; i < in.size(); ++i)
+  {
+    assert(ulp_distance(inout[i], out[i]) == 0);
+  }
+}
+
+template <class T, class Batched, class Scalar>
+void check_complex(const std::vector<cuda::std::complex<T>>& in, Batched batched, Scalar scalar)
+{
+  using C = cuda::std::complex<T>;
+  std::vector<C> out(in.size());
+  batched(cuda::std::span<const C>(in.data(), in.size()), cuda::std::span<C>(out.data(), out.size()));
+  for (size_t i = 0; i < in.size(); ++i)
+  {
+    assert(close(out[i], scalar(in[i])));
+  }
+}
+
+// uniformly distributed numbers in [lo, hi], with the special values at the
+// front and a count which is not a multiple of the block size
+template <class T>
+std::vector<T> inputs(T lo, T hi, std::initializer_list<T> special)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<T> v(special);
+  while (v.size() < 10007)
+  {
+    v.push_back(dist(gen));
+  }
+  return v;
+}
+
+template <class T>
+std::vector<cuda::std::complex<T>> complex_inputs(T lo, T hi, std::initializer_list<cuda::std::complex<T>> special)
+{
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<T> dist(lo, hi);
+  std::vector<cuda::std::complex<T>> v(special);
+  while (v.size() < 10007)
+  {
+    v.emplace_back(dist(gen), dist(gen));
+  }
+  return v;
+}
+
+template <class T>
+void test_real()
+{
+  const T inf  = cuda::std::numeric_limits<T>::infinity();
+  const T nan  = cuda::std::numeric_limits<T>::quiet_NaN();
+  const T max  = cuda::std::numeric_limits<T>::max();
+  const T tiny = cuda::std::numeric_limits<T>::denorm_min();
+
+  check_real(
+    inputs<T>(T(-100), T(100), {T(0), T(-0.0), inf, -inf, nan, max, -max, T(1000), T(-1000), tiny}),
+    [](cuda::std::span<const T> in, cuda::std::span<T> out) {
+      cuda::transform_exp(in, out);
+    },
+    [](T x) {
+      return cuda::std::exp(x);
+    },
+    2);
+
+  check_real(
+    inputs<T>(T(0), T(1000), {T(0), T(-0.0), T(1), T(-1), inf, -inf, nan, max, tiny, T(16) * tiny}),
+    [](cuda::std::span<const T> in, cuda::std::span<T> out) {
+      cuda::transform_log(in, out);
+    },
+    [](T x) {
+      return cuda::std::log(x);
+    },
+    2);
+
+  for (T range : {T(10), T(5000)})
+  {
+    // includes multiples of pi, where the results are close to zero
+    std::initializer_list<T> special = {
+      T(0), T(-0.0), -tiny, inf, -inf, nan, max, T(1e7), T(-1e7), T(3.14159265358979324), T(75.398223686155037)};
+    check_real(
+      inputs<T>(-range, range, special),
+      [](cuda::std::span<const T> in, cuda::std::span<T> out) {
+        cuda::transform_sin(in, out);
+      },
+      [](T x) {
+        return cuda::std::sin(x);
+      },
+      4);
+    check_real(
+      inputs<T>(-range, range, special),
+      [](cuda::std::span<const T> in, cuda::std::span<T> out) {
+        cuda::transform_cos(in, out);
+      },
+      [](T x) {
+        return cuda::std::cos(x);
+      },
+      4);
+  }
+
+  check_real(
+    inputs<T>(T(0), T(1000), {T(0), T(-0.0), T(-1), inf, nan, tiny}),
+    [](cuda::std::span<const T> in, cuda::std::span<T> out) {
+      cuda::transform_sqrt(in, out);
+    },
+    [](T x) {
+      return cuda::std::sqrt(x);
+    },
+    0);
+}
+
+template <class T>
+void test_complex()
+{
+  using C     = cuda::std::complex<T>;
+  const T inf = cuda::std::numeric_limits<T>::infinity();
+  const T nan = cuda::std::numeric_limits<T>::quiet_NaN();
+  const T max = cuda::std::numeric_limits<T>::max();
+
+  std::initializer_list<C> special = {
+    C(0, 0), C(-0.0, 0), C(inf, 0), C(-inf, 1), C(1, inf), C(nan, 1), C(1, nan), C(max, max), C(1000, 1), C(-1, 0)};
+
+  check_complex(
+    complex_inputs<T>(T(-20), T(20), special),
+    [](cuda::std::span<const C> in, cuda::std::span<C> out) {
+      cuda::transform_exp(in, out);
+    },
+    [](C z) {
+      return cuda::std::exp(z);
+    });
+  check_complex(
+    complex_inputs<T>(T(-100), T(100), special),
+    [](cuda::std::span<const C> in, cuda::std::span<C> out) {
+      cuda::transform_log(in, out);
+    },
+    [](C z) {
+      return cuda::std::log(z);
+    });
+  check_complex(
+    complex_inputs<T>(T(-100), T(100), special),
+    [](cuda::std::span<const C> in, cuda::std::span<C> out) {
+      cuda::transform_sqrt(in, out);
+    },
+    [](C z) {
+      return cuda::std::sqrt(z);
+    });
+}
+
+void test_empty_and_longer_output()
+{
+  std::vector<float> in = {0.0f, 1.0f};
+  std::vector<float> out(4, -1.0f);
+  cuda::transform_exp(cuda::std::span<const float>(in.data(), size_t(0)),
+                      cuda::std::span<float>(out.data(), out.size()));
+  assert(out[0] == -1.0f);
+
+  cuda::transform_exp(cuda::std::span<const float>(in.data(), in.size()),
+                      cuda::std::span<float>(out.data(), out.size()));
+  assert(out[0] == 1.0f);
+  assert(out[2] == -1.0f && out[3] == -1.0f);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_real<float>(); test_real<double>(); test_complex<float>(); test_complex<double>();
+                test_empty_and_longer_output();))
+
+  return 0;
+}
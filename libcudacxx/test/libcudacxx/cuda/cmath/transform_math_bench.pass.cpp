@@ -0,0 +1,131 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: nvrtc
+
+// Measures the throughput of the batched math functions of <cuda/cmath>
+// against loops which call the scalar functions of cuda::std.
+
+#include <cuda/cmath>
+#include <cuda/std/cassert>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "test_macros.h"
+
+template <class T, class F>
+double elements_per_ns(std::vector<T>& out, F f)
+{
+  constexpr int repetitions = 20;
+
+  auto const start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; ++r)
+  {
+    f();
+  }
+  auto const stop = std::chrono::steady_clock::now();
+
+  return repetitions * out.size() / std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+template <class T, class Batched, class Scalar>
+void bench(const char* name, const std::vector<T>& in, Batched batched, Scalar scalar)
+{
+  std::vector<T> out(in.size());
+  std::vector<T> expected(in.size());
+
+  double const loop = elements_per_ns(expected, [&]() {
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+      expected[i] = scalar(in[i]);
+    }
+  });
+  double const batch = elements_per_ns(out, [&]() {
+    batched(cuda::std::span<const T>(in.data(), in.size()), cuda::std::span<T>(out.data(), out.size()));
+  });
+  printf("%-24s %16.3f %16.3f %8.2fx\n", name, loop, batch, batch / loop);
+}
+
+template <class T>
+std::vector<T> ramp(size_t n, T lo, T hi)
+{
+  std::vector<T> v(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    v[i] = lo + (hi - lo) * T(i) / T(n);
+  }
+  return v;
+}
+
+// points on a spiral, so that the complex functions see all quadrants
+template <class T>
+std::vector<cuda::std::complex<T>> spiral(size_t n, T radius)
+{
+  std::vector<cuda::std::complex<T>> v(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    v[i] = cuda::std::polar(radius * T(i + 1) / T(n), T(i) * T(0.01));
+  }
+  return v;
+}
+
+#define BENCH(name, type, in)                                    \
+  bench<type>(                                                   \
+    #name " " #type,                                             \
+    in,                                                          \
+    [](cuda::std::span<const type> i, cuda::std::span<type> o) { \
+      cuda::transform_##name(i, o);                              \
+    },                                                           \
+    [](type x) {                                                 \
+      return cuda::std::name(x);                                 \
+    })
+
+void bench_all()
+{
+  constexpr size_t n = 1 << 16;
+
+  using cfloat  = cuda::std::complex<float>;
+  using cdouble = cuda::std::complex<double>;
+
+  std::vector<float> const f     = ramp<float>(n, -20.0f, 20.0f);
+  std::vector<float> const fpos  = ramp<float>(n, 0.001f, 1000.0f);
+  std::vector<double> const d    = ramp<double>(n, -20.0, 20.0);
+  std::vector<double> const dpos = ramp<double>(n, 0.001, 1000.0);
+  std::vector<cfloat> const cf   = spiral<float>(n, 20.0f);
+  std::vector<cdouble> const cd  = spiral<double>(n, 20.0);
+
+  printf("%-24s %16s %16s %9s\n", "function", "scalar (el/ns)", "batched (el/ns)", "speedup");
+  BENCH(exp, float, f);
+  BENCH(exp, double, d);
+  BENCH(log, float, fpos);
+  BENCH(log, double, dpos);
+  BENCH(sin, float, f);
+  BENCH(sin, double, d);
+  BENCH(cos, float, f);
+  BENCH(cos, double, d);
+  BENCH(sqrt, float, fpos);
+  BENCH(sqrt, double, dpos);
+  BENCH(exp, cfloat, cf);
+  BENCH(exp, cdouble, cd);
+  BENCH(log, cfloat, cf);
+  BENCH(log, cdouble, cd);
+  BENCH(sqrt, cfloat, cf);
+  BENCH(sqrt, cdouble, cd);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench_all();))
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/complex>
+
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+static_assert(sizeof(cuda::fast_complex<float>) == sizeof(cuda::std::complex<float>), "");
+static_assert(alignof(cuda::fast_complex<double>) == alignof(cuda::std::complex<double>), "");
+static_assert(cuda::std::is_trivially_copyable<cuda::fast_complex<double>>::value, "");
+
+template <class T>
+__host__ __device__ bool close(cuda::fast_complex<T> x, cuda::std::complex<T> y)
+{
+  cuda::std::complex<T> const d = cuda::std::complex<T>(x) - y;
+  return cuda::std::abs(d) <= T(1e-5) * cuda::std::abs(y);
+}
+
+template <class T>
+__host__ __device__ void test_arithmetic()
+{
+  typedef cuda::fast_complex<T> F;
+  typedef cuda::std::complex<T> C;
+
+  C const values[] = {C(1, 2), C(-3, 0.5), C(0, -4), C(2.5, 0), C(1e3, -1e-3), C(-7, -7)};
+
+  for (C const& z : values)
+  {
+    for (C const& w : values)
+    {
+      assert(close(F(z) * F(w), z * w));
+      assert(close(F(z) / F(w), z / w));
+      assert(close(F(z) + F(w), z + w));
+      assert(close(F(z) - F(w), z - w));
+
+      F x(z);
+      x *= F(w);
+      assert(close(x, z * w));
+      x /= F(w);
+      assert(close(x, z));
+    }
+    assert(close(F(z) * T(3), z * T(3)));
+    assert(close(T(3) * F(z), T(3) * z));
+    assert(close(F(z) / T(4), z / T(4)));
+    assert(close(T(4) / F(z), T(4) / z));
+  }
+
+  // mixes with cuda::std::complex through the implicit conversions
+  F const f(1, 1);
+  C const c(2, -1);
+  C const product = f * c;
+  assert(product == C(3, 1));
+  assert(c * f == F(3, 1));
+  assert(f != c);
+
+  assert(cuda::real(f) == T(1) && cuda::imag(f) == T(1));
+  assert(cuda::conj(f) == F(1, -1));
+  assert(cuda::norm(F(3, 4)) == T(25));
+  assert(-f == F(-1, -1) && +f == f);
+}
+
+#if TEST_STD_VER >= 2014
+static_assert(cuda::fast_complex<double>(1, 2) * cuda::fast_complex<double>(3, 4)
+                == cuda::fast_complex<double>(-5, 10),
+              "");
+static_assert(cuda::fast_complex<double>(-5, 10) / cuda::fast_complex<double>(3, 4)
+                == cuda::fast_complex<double>(1, 2),
+              "");
+#endif // TEST_STD_VER >= 2014
+
+int main(int, char**)
+{
+  test_arithmetic<float>();
+  test_arithmetic<double>();
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// Measures elementwise multiplication and division of arrays of
+// cuda::std::complex and of cuda::fast_complex on the host. The loops over
+// fast_complex have no branches on special values, so the compiler can
+// vectorize them.
+
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "test_macros.h"
+
+struct multiplies
+{
+  template <class Complex>
+  Complex operator()(Complex const& a, Complex const& b) const
+  {
+    return a * b;
+  }
+};
+
+struct divides
+{
+  template <class Complex>
+  Complex operator()(Complex const& a, Complex const& b) const
+  {
+    return a / b;
+  }
+};
+
+template <class Complex, class Op>
+double ns_per_element(std::vector<Complex> const& x, std::vector<Complex> const& y, std::vector<Complex>& z, Op op)
+{
+  constexpr int repetitions = 20;
+
+  size_t const n    = x.size();
+  auto const start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repetitions; ++r)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      z[i] = op(x[i], y[i]);
+    }
+  }
+  auto const stop = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(stop - start).count() / (repetitions * n);
+}
+
+template <class T>
+void bench(char const* name)
+{
+  constexpr size_t n = 1 << 16;
+
+  std::vector<cuda::std::complex<T>> x(n), y(n), z(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    x[i] = cuda::std::complex<T>(T(i % 17) + T(1), T(i % 5) - T(2));
+    y[i] = cuda::std::complex<T>(T(i % 11) - T(5), T(i % 3) + T(1));
+  }
+  std::vector<cuda::fast_complex<T>> fx(x.begin(), x.end()), fy(y.begin(), y.end()), fz(n);
+
+  multiplies const mul;
+  divides const div;
+
+  printf("%8s %10s %22s %22s\n", name, "op", "complex (ns/element)", "fast_complex (ns/element)");
+  printf("%8s %10s %22.3f %22.3f\n", name, "multiply", ns_per_element(x, y, z, mul), ns_per_element(fx, fy, fz, mul));
+  printf("%8s %10s %22.3f %22.3f\n", name, "divide", ns_per_element(x, y, z, div), ns_per_element(fx, fy, fz, div));
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (bench<float>("float"); bench<double>("double");))
+
+  return 0;
+}
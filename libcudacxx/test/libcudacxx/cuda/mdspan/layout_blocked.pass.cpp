@@ -0,0 +1,119 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+template <class Mapping>
+__host__ __device__ bool is_bijective_onto_span(const Mapping& m)
+{
+  bool seen[64] = {};
+  for (int i = 0; i != m.extents().extent(0); ++i)
+  {
+    for (int j = 0; j != m.extents().extent(1); ++j)
+    {
+      const int offset = m(i, j);
+      if (offset < 0 || offset >= m.required_span_size() || seen[offset])
+      {
+        return false;
+      }
+      seen[offset] = true;
+    }
+  }
+  return true;
+}
+
+int main(int, char**)
+{
+  {
+    // 4x4 matrix split into 2x2 tiles
+    using mapping_t = cuda::layout_blocked<2, 2>::mapping<cuda::std::extents<int, 4, 4>>;
+    constexpr mapping_t m{};
+
+    static_assert(m.required_span_size() == 16, "");
+    static_assert(m(0, 0) == 0, "");
+    static_assert(m(0, 1) == 1, "");
+    static_assert(m(1, 0) == 2, "");
+    static_assert(m(1, 1) == 3, "");
+    static_assert(m(0, 2) == 4, "");
+    static_assert(m(1, 3) == 7, "");
+    static_assert(m(2, 0) == 8, "");
+    static_assert(m(3, 3) == 15, "");
+    static_assert(mapping_t::tile_size() == 4, "");
+    static_assert(m.tile_stride(0) == 8, "");
+    static_assert(m.tile_stride(1) == 4, "");
+
+    static_assert(mapping_t::is_always_unique(), "");
+    static_assert(!mapping_t::is_always_exhaustive(), "");
+    static_assert(!mapping_t::is_always_strided(), "");
+    static_assert(m.is_exhaustive(), "");
+    static_assert(!m.is_strided(), "");
+
+    assert(is_bijective_onto_span(m));
+  }
+
+  {
+    // extents which are not a multiple of the tile extents are padded
+    using ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::layout_blocked<2, 4>::mapping<ext_t> m{ext_t{3, 5}};
+
+    assert(m.required_span_size() == 4 * 8);
+    assert(!m.is_exhaustive());
+    assert(m(2, 4) == 3 * 8);
+    assert(is_bijective_onto_span(m));
+  }
+
+  {
+    // a single tile behaves like layout_right
+    using ext_t = cuda::std::extents<int, 4, 8>;
+    cuda::layout_blocked<4, 8>::mapping<ext_t> m{};
+    cuda::std::layout_right::mapping<ext_t> r{};
+
+    assert(m.is_strided());
+    assert(m.stride(0) == r.stride(0));
+    assert(m.stride(1) == r.stride(1));
+    for (int i = 0; i != 4; ++i)
+    {
+      for (int j = 0; j != 8; ++j)
+      {
+        assert(m(i, j) == r(i, j));
+      }
+    }
+  }
+
+  {
+    // conversion and comparison
+    using static_ext_t  = cuda::std::extents<int, 4, 6>;
+    using dynamic_ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::layout_blocked<2, 2>::mapping<static_ext_t> m0{};
+    cuda::layout_blocked<2, 2>::mapping<dynamic_ext_t> m1{m0};
+    cuda::layout_blocked<2, 2>::mapping<dynamic_ext_t> m2{dynamic_ext_t{4, 8}};
+
+    assert(m1 == m0);
+    assert(m1 != m2);
+    assert(m1(3, 5) == m0(3, 5));
+  }
+
+  {
+    int data[32] = {};
+    cuda::std::mdspan<int, cuda::std::extents<int, 4, 8>, cuda::layout_blocked<2, 4>> md(data);
+    md(3, 5) = 42;
+
+    assert(data[md.mapping()(3, 5)] == 42);
+    assert(md.mapping()(3, 5) == 3 * 8 + 1 * 4 + 1);
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+  {
+    using mapping_t = cuda::layout_morton::mapping<cuda::std::extents<int, 4, 4>>;
+    constexpr mapping_t m{};
+
+    static_assert(m.required_span_size() == 16, "");
+    static_assert(m(0, 0) == 0, "");
+    static_assert(m(0, 1) == 1, "");
+    static_assert(m(1, 0) == 2, "");
+    static_assert(m(1, 1) == 3, "");
+    static_assert(m(0, 2) == 4, "");
+    static_assert(m(2, 0) == 8, "");
+    static_assert(m(2, 2) == 12, "");
+    static_assert(m(3, 3) == 15, "");
+    static_assert(m.is_exhaustive(), "");
+    static_assert(!m.is_strided(), "");
+  }
+
+  {
+    // once the first rank runs out of bits the second one is stored contiguously
+    using ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::layout_morton::mapping<ext_t> m{ext_t{2, 8}};
+
+    assert(m.required_span_size() == 16);
+    assert(m.is_exhaustive());
+    assert(m(0, 0) == 0);
+    assert(m(1, 0) == 2);
+    assert(m(0, 2) == 4);
+    assert(m(1, 7) == 15);
+
+    bool seen[16] = {};
+    for (int i = 0; i != 2; ++i)
+    {
+      for (int j = 0; j != 8; ++j)
+      {
+        assert(!seen[m(i, j)]);
+        seen[m(i, j)] = true;
+      }
+    }
+  }
+
+  {
+    // the rank two fast path and the generic encoding agree
+    using ext2_t = cuda::std::extents<int, dyn, dyn>;
+    using ext3_t = cuda::std::extents<int, 1, dyn, dyn>;
+    cuda::layout_morton::mapping<ext2_t> m2{ext2_t{5, 12}};
+    cuda::layout_morton::mapping<ext3_t> m3{ext3_t{5, 12}};
+
+    assert(m2.required_span_size() == m3.required_span_size());
+    assert(!m2.is_exhaustive());
+    for (int i = 0; i != 5; ++i)
+    {
+      for (int j = 0; j != 12; ++j)
+      {
+        assert(m2(i, j) == m3(0, i, j));
+      }
+    }
+  }
+
+  {
+    // rank three interleaves the bits of all indices
+    cuda::layout_morton::mapping<cuda::std::extents<int, 2, 2, 2>> m{};
+    assert(m(0, 0, 1) == 1);
+    assert(m(0, 1, 0) == 2);
+    assert(m(1, 0, 0) == 4);
+    assert(m(1, 1, 1) == 7);
+  }
+
+  {
+    // rank one is the identity
+    using mapping_t = cuda::layout_morton::mapping<cuda::std::extents<int, 7>>;
+    static_assert(mapping_t::is_always_exhaustive(), "");
+    static_assert(mapping_t::is_always_strided(), "");
+    mapping_t m{};
+    assert(m(5) == 5);
+    assert(m.stride(0) == 1);
+  }
+
+  {
+    int data[16] = {};
+    cuda::std::mdspan<int, cuda::std::extents<int, 4, 4>, cuda::layout_morton> md(data);
+    md(2, 3) = 42;
+    assert(data[13] == 42);
+  }
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/mdspan>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+  int data[8 * 12] = {};
+  cuda::std::mdspan<int, cuda::std::extents<int, 8, 12>, cuda::layout_blocked<2, 4>> md(data);
+  for (int i = 0; i != 8; ++i)
+  {
+    for (int j = 0; j != 12; ++j)
+    {
+      md(i, j) = i * 100 + j;
+    }
+  }
+
+  {
+    auto sub = cuda::submdspan(md, cuda::std::pair<int, int>{2, 6}, cuda::std::pair<int, int>{4, 11});
+
+    static_assert(cuda::std::is_same<decltype(sub)::layout_type, cuda::layout_blocked<2, 4>>::value, "");
+    static_assert(decltype(sub)::rank_dynamic() == 2, "");
+    assert(sub.extent(0) == 4);
+    assert(sub.extent(1) == 7);
+    for (int i = 0; i != 4; ++i)
+    {
+      for (int j = 0; j != 7; ++j)
+      {
+        assert(sub(i, j) == (i + 2) * 100 + (j + 4));
+      }
+    }
+  }
+
+  {
+    // full_extent keeps the static extent
+    auto sub = cuda::submdspan(md, cuda::std::full_extent, cuda::std::pair<int, int>{8, 12});
+
+    static_assert(decltype(sub)::static_extent(0) == 8, "");
+    static_assert(decltype(sub)::static_extent(1) == dyn, "");
+    assert(sub.extent(1) == 4);
+    assert(sub(5, 3) == 5 * 100 + 11);
+    assert(!sub.is_exhaustive());
+  }
+
+  {
+    // unqualified calls find the overload through ADL
+    auto sub = submdspan(md, cuda::std::pair<int, int>{0, 2}, cuda::std::pair<int, int>{0, 4});
+    assert(sub.is_exhaustive());
+    assert(sub.data_handle() == data);
+  }
+
+  return 0;
+}
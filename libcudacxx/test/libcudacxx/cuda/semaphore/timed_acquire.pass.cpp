@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/semaphore>
+
+#include <cuda/semaphore>
+#include <cuda/std/cassert>
+#include <cuda/std/chrono>
+
+#include <chrono>
+#include <thread>
+
+#include "test_macros.h"
+
+// the timed waits keep no state in the semaphores
+static_assert(sizeof(cuda::std::counting_semaphore<>) == sizeof(cuda::std::ptrdiff_t), "");
+static_assert(sizeof(cuda::std::binary_semaphore) == sizeof(int), "");
+static_assert(sizeof(cuda::counting_semaphore<cuda::thread_scope_device>) == sizeof(cuda::std::ptrdiff_t), "");
+static_assert(sizeof(cuda::binary_semaphore<cuda::thread_scope_device>) == sizeof(int), "");
+
+template <class Semaphore>
+void test_zero_and_negative_timeouts()
+{
+  Semaphore s(0);
+  auto const start = std::chrono::steady_clock::now();
+
+  assert(!s.try_acquire_for(cuda::std::chrono::milliseconds(0)));
+  assert(!s.try_acquire_for(cuda::std::chrono::milliseconds(-100)));
+  assert(!s.try_acquire_until(cuda::std::chrono::system_clock::now()));
+  assert(!s.try_acquire_until(cuda::std::chrono::system_clock::now() - cuda::std::chrono::seconds(1)));
+
+  // a count that is there is still taken
+  s.release();
+  assert(s.try_acquire_for(cuda::std::chrono::milliseconds(0)));
+  s.release();
+  assert(s.try_acquire_for(cuda::std::chrono::milliseconds(-100)));
+  assert(!s.try_acquire());
+
+  // none of these waited for anything
+  assert(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+}
+
+// a release wakes a blocked timed acquire long before its timeout
+template <class Semaphore>
+void test_release_wakes_timed_acquire()
+{
+  for (int round = 0; round < 5; ++round)
+  {
+    Semaphore s(0);
+    std::chrono::steady_clock::time_point acquired;
+
+    std::thread waiter([&]() {
+      assert(s.try_acquire_for(cuda::std::chrono::seconds(30)));
+      acquired = std::chrono::steady_clock::now();
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto const released = std::chrono::steady_clock::now();
+    s.release();
+    waiter.join();
+
+    assert(acquired - released < std::chrono::seconds(5));
+  }
+}
+
+template <class Semaphore>
+void test()
+{
+  test_zero_and_negative_timeouts<Semaphore>();
+  test_release_wakes_timed_acquire<Semaphore>();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test<cuda::std::counting_semaphore<>>(); test<cuda::std::binary_semaphore>();
+                test<cuda::counting_semaphore<cuda::thread_scope_device>>();
+                test<cuda::binary_semaphore<cuda::thread_scope_device>>();))
+
+  return 0;
+}
@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/semaphore>
+
+// The timed acquires with the platform waits turned off, which poll.
+
+#define _LIBCUDACXX_HAS_NO_PLATFORM_WAIT
+#include "timed_acquire.pass.cpp"
+
+#if defined(_LIBCUDACXX_HAS_PLATFORM_TIMED_WAIT)
+#  error "the platform waits were turned off"
+#endif
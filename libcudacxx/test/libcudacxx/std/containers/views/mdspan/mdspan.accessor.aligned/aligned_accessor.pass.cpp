@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/cassert>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+int main(int, char**)
+{
+  using accessor_t = cuda::std::aligned_accessor<float, 16>;
+  static_assert(accessor_t::byte_alignment == 16, "");
+  static_assert(cuda::std::is_same<accessor_t::offset_policy, cuda::std::default_accessor<float>>::value, "");
+  static_assert(cuda::std::is_same<accessor_t::data_handle_type, float*>::value, "");
+  static_assert(cuda::std::is_same<accessor_t::reference, float&>::value, "");
+
+  // conversions
+  static_assert(cuda::std::is_convertible<cuda::std::aligned_accessor<float, 32>, accessor_t>::value, "");
+  static_assert(!cuda::std::is_constructible<accessor_t, cuda::std::aligned_accessor<float, 8>>::value, "");
+  static_assert(cuda::std::is_constructible<cuda::std::aligned_accessor<const float, 16>, accessor_t>::value, "");
+  static_assert(!cuda::std::is_constructible<accessor_t, cuda::std::aligned_accessor<const float, 16>>::value, "");
+  static_assert(cuda::std::is_constructible<accessor_t, cuda::std::default_accessor<float>>::value, "");
+  static_assert(!cuda::std::is_convertible<cuda::std::default_accessor<float>, accessor_t>::value, "");
+  static_assert(cuda::std::is_convertible<accessor_t, cuda::std::default_accessor<const float>>::value, "");
+
+  {
+    alignas(16) float data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    accessor_t a{};
+
+    assert(a.access(data, 0) == 0.0f);
+    assert(a.access(data, 5) == 5.0f);
+    assert(a.offset(data, 3) == data + 3);
+
+    cuda::std::default_accessor<const float> d = a;
+    assert(d.access(data, 7) == 7.0f);
+  }
+
+  // mdspan over a padded layout whose rows are aligned
+  {
+    alignas(16) float data[3 * 4] = {};
+    using ext_t = cuda::std::extents<int, 3, 3>;
+    cuda::std::mdspan<float, ext_t, cuda::std::layout_right_padded<4>, accessor_t> md(data);
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        md(i, j) = static_cast<float>(i * 3 + j);
+      }
+    }
+    assert(data[4] == 3.0f && data[10] == 8.0f && data[11] == 0.0f);
+
+    cuda::std::mdspan<const float, ext_t, cuda::std::layout_right_padded<4>> view = md;
+    assert(view(2, 1) == 7.0f);
+  }
+
+  return 0;
+}
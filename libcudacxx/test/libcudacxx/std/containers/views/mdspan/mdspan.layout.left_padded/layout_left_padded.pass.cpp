@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++11
+// UNSUPPORTED: msvc && c++14, msvc && c++17
+
+#include <cuda/std/cassert>
+#include <cuda/std/mdspan>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto dyn = cuda::std::dynamic_extent;
+
+int main(int, char**)
+{
+  // default padding: equivalent to layout_left
+  {
+    using ext_t = cuda::std::extents<int, 3, 4>;
+    cuda::std::layout_left_padded<>::mapping<ext_t> m{ext_t{}};
+
+    assert(m.stride(0) == 1);
+    assert(m.stride(1) == 3);
+    assert(m.required_span_size() == 12);
+    assert(m.is_exhaustive());
+  }
+
+  // static padding
+  {
+    using ext_t   = cuda::std::extents<int, 5, dyn, 3>;
+    using map_t   = cuda::std::layout_left_padded<4>::mapping<ext_t>;
+    constexpr map_t m{ext_t{2}};
+
+    static_assert(map_t::padding_value == 4, "");
+    static_assert(m.stride(0) == 1, "");
+    static_assert(m.stride(1) == 8, "");
+    static_assert(m.stride(2) == 16, "");
+    static_assert(m(4, 1, 2) == 4 + 8 + 32, "");
+    static_assert(m.required_span_size() == 4 + 8 + 32 + 1, "");
+    static_assert(!map_t::is_always_exhaustive(), "");
+    static_assert(!m.is_exhaustive(), "");
+    static_assert(map_t::is_always_unique() && map_t::is_always_strided(), "");
+
+    const auto strides = m.strides();
+    assert(strides[0] == 1 && strides[1] == 8 && strides[2] == 16);
+  }
+
+  // static padding which is already a divisor of the extent
+  {
+    using map_t = cuda::std::layout_left_padded<4>::mapping<cuda::std::extents<int, 8, 3>>;
+    static_assert(map_t::is_always_exhaustive(), "");
+    static_assert(map_t{}.stride(1) == 8, "");
+  }
+
+  // dynamic padding
+  {
+    using ext_t = cuda::std::extents<size_t, dyn, dyn>;
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> m{ext_t{7, 3}, 16};
+
+    assert(m.stride(1) == 16);
+    assert(m(6, 2) == 6 + 32);
+    assert(m.required_span_size() == 39);
+    assert(!m.is_exhaustive());
+  }
+
+  // rank 0 and 1
+  {
+    cuda::std::layout_left_padded<8>::mapping<cuda::std::extents<int>> m0;
+    assert(m0.required_span_size() == 1);
+    assert(m0() == 0);
+
+    cuda::std::layout_left_padded<8>::mapping<cuda::std::extents<int, 5>> m1;
+    assert(m1.required_span_size() == 5);
+    assert(m1(3) == 3);
+    assert(m1.stride(0) == 1);
+    static_assert(decltype(m1)::is_always_exhaustive(), "");
+  }
+
+  // empty extents
+  {
+    using ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::std::layout_left_padded<4>::mapping<ext_t> m{ext_t{3, 0}};
+    assert(m.required_span_size() == 0);
+  }
+
+  // conversions
+  {
+    using ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::std::layout_left::mapping<ext_t> left{ext_t{8, 3}};
+    cuda::std::layout_left_padded<4>::mapping<ext_t> from_left = left;
+    assert(from_left.stride(1) == 8);
+    assert(from_left.is_exhaustive());
+
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> dyn_padded{ext_t{5, 3}, 4};
+    cuda::std::layout_left_padded<4>::mapping<ext_t> static_padded{dyn_padded};
+    assert(static_padded.stride(1) == 8);
+    assert(static_padded == dyn_padded);
+
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> back = static_padded;
+    assert(back == static_padded);
+
+#if TEST_STD_VER > 2017
+    static_assert(!cuda::std::is_convertible<cuda::std::layout_left_padded<dyn>::mapping<ext_t>,
+                                             cuda::std::layout_left_padded<4>::mapping<ext_t>>::value,
+                  "");
+#endif // TEST_STD_VER > 2017
+
+    cuda::std::layout_stride::mapping<ext_t> stride{static_padded};
+    assert(stride.stride(0) == 1);
+    assert(stride.stride(1) == 8);
+    assert(stride(4, 2) == static_padded(4, 2));
+
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> from_stride{stride};
+    assert(from_stride == static_padded);
+  }
+
+  // comparison
+  {
+    using ext_t = cuda::std::extents<int, dyn, dyn>;
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> a{ext_t{5, 3}, 4};
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> b{ext_t{5, 3}, 16};
+    cuda::std::layout_left_padded<dyn>::mapping<ext_t> c{ext_t{5, 3}, 8};
+    assert(a != b);
+    assert(a == c);
+  }
+
+  // mdspan with padded columns
+  {
+    int data[4 * 3] = {};
+    using ext_t     = cuda::std::extents<int, 3, 3>;
+    cuda::std::mdspan<int, ext_t, cuda::std::layout_left_padded<4>> md(data);
+    for (int j = 0; j < 3; ++j)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        md(i, j) = 1 + i + 10 * j;
+      }
+    }
+    assert(data[0] == 1 && data[2] == 3 && data[3] == 0);
+    assert(data[4] == 11 && data[8] == 21 && data[10] == 23);
+  }
+
+  return 0;
+}
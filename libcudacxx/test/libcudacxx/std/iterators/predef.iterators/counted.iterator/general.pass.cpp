@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::counted_iterator
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/iterator>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  int buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  {
+    using Counted = cuda::std::counted_iterator<int*>;
+    static_assert(cuda::std::contiguous_iterator<Counted>);
+    static_assert(cuda::std::sized_sentinel_for<cuda::std::default_sentinel_t, Counted>);
+    static_assert(cuda::std::same_as<cuda::std::iter_value_t<Counted>, int>);
+    static_assert(cuda::std::same_as<cuda::std::iter_reference_t<Counted>, int&>);
+
+    Counted iter(buffer, 3);
+    assert(iter.count() == 3);
+    assert(iter.base() == buffer);
+    assert(iter[2] == 3);
+    assert(cuda::std::default_sentinel - iter == 3);
+    assert(iter - cuda::std::default_sentinel == -3);
+
+    int sum = 0;
+    for (; iter != cuda::std::default_sentinel; ++iter)
+    {
+      sum += *iter;
+    }
+    assert(sum == 1 + 2 + 3);
+    assert(iter.count() == 0);
+    assert(iter == cuda::std::default_sentinel);
+  }
+
+  // arithmetic and comparisons
+  {
+    cuda::std::counted_iterator<int*> first(buffer, 8);
+    auto second = first + 5;
+    assert(second.count() == 3);
+    assert(*second == 6);
+    assert(second - first == 5);
+    assert(first < second);
+    assert(second >= first);
+    second -= 2;
+    assert(*second-- == 4);
+    assert(*second == 3);
+    assert((2 + first).count() == 6);
+  }
+
+  // input iterators
+  {
+    cuda::std::counted_iterator<cpp20_input_iterator<int*>> iter(cpp20_input_iterator<int*>(buffer), 2);
+    static_assert(cuda::std::input_iterator<decltype(iter)>);
+    static_assert(!cuda::std::forward_iterator<decltype(iter)>);
+    assert(*iter == 1);
+    ++iter;
+    assert(*iter == 2);
+    assert(iter.count() == 1);
+  }
+
+  // conversions
+  {
+    cuda::std::counted_iterator<int*> iter(buffer, 4);
+    cuda::std::counted_iterator<const int*> citer = iter;
+    assert(citer.base() == buffer);
+    assert(citer.count() == 4);
+    assert(citer == iter);
+  }
+
+  // iter_move and iter_swap
+  {
+    int other[2] = {10, 20};
+    cuda::std::counted_iterator<int*> lhs(buffer, 1);
+    cuda::std::counted_iterator<int*> rhs(other, 1);
+    cuda::std::ranges::iter_swap(lhs, rhs);
+    assert(buffer[0] == 10 && other[0] == 1);
+    assert(cuda::std::ranges::iter_move(lhs) == 10);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
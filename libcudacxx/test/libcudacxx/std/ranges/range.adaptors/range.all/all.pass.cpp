@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+
+// cuda::std::views::all
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+#include <cuda/std/span>
+
+#include "test_macros.h"
+
+struct MoveOnlyRange
+{
+  int buff_[4] = {1, 2, 3, 4};
+
+  MoveOnlyRange()                                = default;
+  MoveOnlyRange(MoveOnlyRange&&)                 = default;
+  MoveOnlyRange& operator=(MoveOnlyRange&&)      = default;
+  MoveOnlyRange(const MoveOnlyRange&)            = delete;
+  MoveOnlyRange& operator=(const MoveOnlyRange&) = delete;
+
+  __host__ __device__ constexpr int* begin()
+  {
+    return buff_;
+  }
+  __host__ __device__ constexpr int* end()
+  {
+    return buff_ + 4;
+  }
+};
+
+__host__ __device__ constexpr bool test()
+{
+  int arr[4] = {1, 2, 3, 4};
+
+  // lvalue ranges are wrapped in a ref_view
+  {
+    auto v = cuda::std::views::all(arr);
+    static_assert(cuda::std::same_as<decltype(v), cuda::std::ranges::ref_view<int[4]>>);
+    assert(v.size() == 4);
+    assert(v.data() == arr);
+    assert(&v.base() == &arr);
+  }
+
+  // views are returned unchanged
+  {
+    cuda::std::span<int> s{arr};
+    auto v = cuda::std::views::all(s);
+    static_assert(cuda::std::same_as<decltype(v), cuda::std::span<int>>);
+    assert(v.data() == arr);
+  }
+
+  // rvalue ranges are owned by the resulting view
+  {
+    auto v = cuda::std::views::all(MoveOnlyRange{});
+    static_assert(cuda::std::same_as<decltype(v), cuda::std::ranges::owning_view<MoveOnlyRange>>);
+    assert(*v.begin() == 1);
+    assert(v.end() - v.begin() == 4);
+  }
+
+  // pipe syntax
+  {
+    auto v = arr | cuda::std::views::all;
+    static_assert(cuda::std::same_as<decltype(v), cuda::std::ranges::ref_view<int[4]>>);
+    static_assert(cuda::std::same_as<cuda::std::views::all_t<int (&)[4]>, cuda::std::ranges::ref_view<int[4]>>);
+    assert(v[2] == 3);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
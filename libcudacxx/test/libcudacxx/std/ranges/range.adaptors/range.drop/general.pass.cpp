@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::drop_view, cuda::std::views::drop
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  {
+    auto v = cuda::std::views::iota(0, 10) | cuda::std::views::drop(7);
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::random_access_range<View>);
+    static_assert(cuda::std::ranges::common_range<View>);
+    static_assert(cuda::std::ranges::borrowed_range<View>);
+    assert(v.size() == 3);
+    assert(*v.begin() == 7);
+    assert(v.back() == 9);
+  }
+
+  // dropping more elements than available
+  {
+    auto v = cuda::std::views::iota(0, 3) | cuda::std::views::drop(7);
+    assert(v.size() == 0);
+    assert(v.empty());
+  }
+
+  // arrays
+  {
+    int arr[4] = {1, 2, 3, 4};
+    auto v     = cuda::std::views::drop(arr, 1);
+    assert(v.size() == 3);
+    assert(v.data() == arr + 1);
+    assert(v.base().data() == arr);
+  }
+
+  // composition with take
+  {
+    auto v  = cuda::std::views::iota(0, 10) | cuda::std::views::drop(2) | cuda::std::views::take(3);
+    int sum = 0;
+    for (int x : v)
+    {
+      sum = sum * 10 + x;
+    }
+    assert(sum == 234);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
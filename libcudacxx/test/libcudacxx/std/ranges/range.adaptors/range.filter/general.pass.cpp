@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::filter_view, cuda::std::views::filter
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_macros.h"
+
+struct IsEven
+{
+  __host__ __device__ constexpr bool operator()(int x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+struct GreaterThanSix
+{
+  __host__ __device__ constexpr bool operator()(int x) const
+  {
+    return x > 6;
+  }
+};
+
+struct Square
+{
+  __host__ __device__ constexpr int operator()(int x) const
+  {
+    return x * x;
+  }
+};
+
+__host__ __device__ constexpr bool test()
+{
+  {
+    auto v = cuda::std::views::iota(0, 10) | cuda::std::views::filter(IsEven{});
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::view<View>);
+    static_assert(cuda::std::ranges::bidirectional_range<View>);
+    static_assert(!cuda::std::ranges::random_access_range<View>);
+    static_assert(!cuda::std::ranges::sized_range<View>);
+    static_assert(cuda::std::ranges::common_range<View>);
+
+    int sum = 0;
+    for (int x : v)
+    {
+      sum += x;
+    }
+    assert(sum == 0 + 2 + 4 + 6 + 8);
+  }
+
+  // begin is found lazily and iteration works backwards
+  {
+    auto v = cuda::std::views::iota(0, 10) | cuda::std::views::filter(GreaterThanSix{});
+    assert(*v.begin() == 7);
+    assert(*v.begin() == 7);
+    auto last = v.end();
+    --last;
+    assert(*last == 9);
+    assert(v.pred()(8));
+  }
+
+  // composed adaptor closures
+  {
+    int arr[5]   = {1, 2, 3, 4, 5};
+    auto closure = cuda::std::views::filter(IsEven{}) | cuda::std::views::transform(Square{});
+    int sum      = 0;
+    for (int x : arr | closure)
+    {
+      sum += x;
+    }
+    assert(sum == 4 + 16);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if TEST_STD_VER >= 2020
+  // The begin cache relies on optional::emplace, which is only constexpr in C++20
+  static_assert(test(), "");
+#endif // TEST_STD_VER >= 2020
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::iota_view, cuda::std::views::iota
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  // bounded
+  {
+    auto v = cuda::std::views::iota(2, 7);
+    static_assert(cuda::std::same_as<decltype(v), cuda::std::ranges::iota_view<int, int>>);
+    static_assert(cuda::std::ranges::random_access_range<decltype(v)>);
+    static_assert(cuda::std::ranges::common_range<decltype(v)>);
+    static_assert(cuda::std::ranges::sized_range<decltype(v)>);
+    static_assert(cuda::std::ranges::borrowed_range<decltype(v)>);
+    assert(v.size() == 5);
+    assert(*v.begin() == 2);
+    assert(v[4] == 6);
+    assert(v.back() == 6);
+
+    int sum = 0;
+    for (int i : v)
+    {
+      sum += i;
+    }
+    assert(sum == 2 + 3 + 4 + 5 + 6);
+
+    auto it = v.begin();
+    it += 3;
+    assert(*it == 5);
+    assert(v.end() - it == 2);
+    --it;
+    assert(*it-- == 4);
+    assert(*it == 3);
+  }
+
+  // unbounded
+  {
+    auto v = cuda::std::views::iota(10);
+    static_assert(!cuda::std::ranges::common_range<decltype(v)>);
+    static_assert(!cuda::std::ranges::sized_range<decltype(v)>);
+    static_assert(cuda::std::same_as<cuda::std::ranges::sentinel_t<decltype(v)>, cuda::std::unreachable_sentinel_t>);
+    assert(v[100] == 110);
+    assert(v.begin() != v.end());
+  }
+
+  // non-integral bound
+  {
+    long long arr[3] = {};
+    auto v           = cuda::std::ranges::iota_view<long long*, long long*>(arr, arr + 3);
+    assert(v.size() == 3);
+    assert(*v.begin() == arr);
+  }
+
+  // empty
+  {
+    auto v = cuda::std::views::iota(4, 4);
+    assert(v.empty());
+    assert(v.size() == 0);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
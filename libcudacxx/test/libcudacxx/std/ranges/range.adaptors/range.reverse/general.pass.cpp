@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::reverse_view, cuda::std::views::reverse
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  {
+    auto v = cuda::std::views::iota(0, 4) | cuda::std::views::reverse;
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::random_access_range<View>);
+    static_assert(cuda::std::ranges::sized_range<View>);
+    assert(v.size() == 4);
+    assert(v[0] == 3);
+
+    int digits = 0;
+    for (int x : v)
+    {
+      digits = digits * 10 + x;
+    }
+    assert(digits == 3210);
+  }
+
+  // reversing twice yields the original view
+  {
+    auto base = cuda::std::views::iota(0, 4);
+    auto v    = base | cuda::std::views::reverse | cuda::std::views::reverse;
+    static_assert(cuda::std::same_as<decltype(v), decltype(base)>);
+    assert(*v.begin() == 0);
+  }
+
+  // arrays and composition
+  {
+    int arr[4] = {1, 2, 3, 4};
+    auto v     = arr | cuda::std::views::drop(1) | cuda::std::views::reverse;
+    assert(*v.begin() == 4);
+    assert(v.size() == 3);
+    *v.begin() = 40;
+    assert(arr[3] == 40);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
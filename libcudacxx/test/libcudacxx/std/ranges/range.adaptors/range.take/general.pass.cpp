@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::take_view, cuda::std::views::take
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  // sized random access ranges keep their own iterators
+  {
+    auto v = cuda::std::views::iota(0, 10) | cuda::std::views::take(3);
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::random_access_range<View>);
+    static_assert(cuda::std::ranges::common_range<View>);
+    static_assert(cuda::std::same_as<cuda::std::ranges::iterator_t<View>,
+                                     cuda::std::ranges::iterator_t<cuda::std::ranges::iota_view<int, int>>>);
+    assert(v.size() == 3);
+    assert(*(v.end() - 1) == 2);
+  }
+
+  // count larger than the range
+  {
+    auto v = cuda::std::views::iota(0, 2) | cuda::std::views::take(5);
+    assert(v.size() == 2);
+  }
+
+  // unsized ranges are wrapped in a counted_iterator
+  {
+    auto v = cuda::std::views::iota(0) | cuda::std::views::take(4);
+    using View = decltype(v);
+    using BaseIter = cuda::std::ranges::iterator_t<cuda::std::ranges::iota_view<int>>;
+    static_assert(cuda::std::same_as<cuda::std::ranges::iterator_t<View>, cuda::std::counted_iterator<BaseIter>>);
+    static_assert(!cuda::std::ranges::common_range<View>);
+    int sum = 0;
+    for (int x : v)
+    {
+      sum += x;
+    }
+    assert(sum == 0 + 1 + 2 + 3);
+  }
+
+#if TEST_STD_VER >= 2020 // forward_iterator does not satisfy common_with in C++17
+  // non-common forward range
+  {
+    int arr[5] = {1, 2, 3, 4, 5};
+    auto base  = cuda::std::ranges::subrange<forward_iterator<int*>, sentinel_wrapper<forward_iterator<int*>>>(
+      forward_iterator<int*>(arr), sentinel_wrapper<forward_iterator<int*>>(forward_iterator<int*>(arr + 5)));
+    auto v = base | cuda::std::views::take(2);
+    static_assert(cuda::std::ranges::forward_range<decltype(v)>);
+    int sum = 0;
+    for (int x : v)
+    {
+      sum += x;
+    }
+    assert(sum == 3);
+  }
+#endif // TEST_STD_VER >= 2020
+
+  // arrays
+  {
+    int arr[5] = {1, 2, 3, 4, 5};
+    auto v     = cuda::std::views::take(arr, 2);
+    assert(v.size() == 2);
+    assert(v[1] == 2);
+    assert(v.base().data() == arr);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
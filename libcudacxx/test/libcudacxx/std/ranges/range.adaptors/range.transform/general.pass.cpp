@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::transform_view, cuda::std::views::transform
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+
+#include "test_macros.h"
+
+struct Square
+{
+  __host__ __device__ constexpr int operator()(int x) const
+  {
+    return x * x;
+  }
+};
+
+struct Identity
+{
+  __host__ __device__ constexpr int& operator()(int& x) const
+  {
+    return x;
+  }
+};
+
+__host__ __device__ constexpr bool test()
+{
+  // prvalue results
+  {
+    auto v = cuda::std::views::iota(0, 5) | cuda::std::views::transform(Square{});
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::view<View>);
+    static_assert(cuda::std::ranges::random_access_range<View>);
+    static_assert(cuda::std::ranges::common_range<View>);
+    static_assert(cuda::std::ranges::sized_range<View>);
+    static_assert(cuda::std::same_as<cuda::std::ranges::range_reference_t<View>, int>);
+    using Iter = cuda::std::ranges::iterator_t<View>;
+    static_assert(cuda::std::same_as<typename Iter::iterator_concept, cuda::std::random_access_iterator_tag>);
+    static_assert(cuda::std::same_as<typename Iter::iterator_category, cuda::std::input_iterator_tag>);
+    assert(v.size() == 5);
+    assert(v[3] == 9);
+    assert(*(v.end() - 1) == 16);
+
+    int sum = 0;
+    for (int x : v)
+    {
+      sum += x;
+    }
+    assert(sum == 0 + 1 + 4 + 9 + 16);
+  }
+
+  // lvalue results can be written through
+  {
+    int arr[4] = {1, 2, 3, 4};
+    auto v     = cuda::std::views::transform(arr, Identity{});
+    static_assert(cuda::std::same_as<cuda::std::ranges::range_reference_t<decltype(v)>, int&>);
+    static_assert(cuda::std::same_as<typename cuda::std::ranges::iterator_t<decltype(v)>::iterator_category,
+                                     cuda::std::random_access_iterator_tag>);
+    for (int& x : v)
+    {
+      x *= 2;
+    }
+    assert(arr[0] == 2);
+    assert(arr[3] == 8);
+
+    // iterator converts to const iterator
+    const auto& cv                 = v;
+    decltype(cv.begin()) const_it = v.begin();
+    assert(*const_it == 2);
+    assert(cv.end() - const_it == 4);
+  }
+
+  // base() and iterator::base()
+  {
+    int arr[3] = {1, 2, 3};
+    auto v     = arr | cuda::std::views::transform(Square{});
+    assert(v.base().data() == arr);
+    assert(v.begin().base() == arr);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11, c++14
+// UNSUPPORTED: msvc-19.16
+// cuda::std::ranges::zip_view, cuda::std::views::zip
+
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/ranges>
+#include <cuda/std/tuple>
+
+#include "test_macros.h"
+
+__host__ __device__ constexpr bool test()
+{
+  int ints[5]       = {1, 2, 3, 4, 5};
+  double doubles[3] = {10., 20., 30.};
+
+  // the zipped range is as long as its shortest member
+  {
+    auto v = cuda::std::views::zip(ints, doubles);
+    using View = decltype(v);
+    static_assert(cuda::std::ranges::random_access_range<View>);
+    static_assert(cuda::std::ranges::common_range<View>);
+    static_assert(cuda::std::ranges::sized_range<View>);
+    static_assert(cuda::std::same_as<cuda::std::ranges::range_reference_t<View>, cuda::std::tuple<int&, double&>>);
+    static_assert(cuda::std::same_as<cuda::std::ranges::range_value_t<View>, cuda::std::tuple<int, double>>);
+    assert(v.size() == 3);
+    assert(v.end() - v.begin() == 3);
+    assert(cuda::std::get<1>(v[2]) == 30.);
+
+    // references write through to the underlying ranges
+    cuda::std::get<0>(*v.begin()) = 42;
+    assert(ints[0] == 42);
+
+    int sum = 0;
+    for (auto&& t : v)
+    {
+      sum += cuda::std::get<0>(t);
+    }
+    assert(sum == 42 + 2 + 3);
+
+    const auto& cv = v;
+    assert(cuda::std::get<0>(*cv.begin()) == 42);
+  }
+
+  // unbounded members produce a non-common range
+  {
+    auto v = cuda::std::views::zip(cuda::std::views::iota(0), ints);
+    static_assert(!cuda::std::ranges::common_range<decltype(v)>);
+    int count = 0;
+    for (auto t : v)
+    {
+      assert(cuda::std::get<0>(t) == count);
+      ++count;
+    }
+    assert(count == 5);
+  }
+
+  // iter_swap swaps every member
+  {
+    int keys[3]   = {3, 1, 2};
+    int values[3] = {30, 10, 20};
+    auto v        = cuda::std::views::zip(keys, values);
+    cuda::std::ranges::iter_swap(v.begin(), v.begin() + 1);
+    assert(keys[0] == 1 && values[0] == 10);
+    assert(keys[1] == 3 && values[1] == 30);
+  }
+
+  // zip_view can be reversed
+  {
+    auto v = cuda::std::views::zip(ints, doubles) | cuda::std::views::reverse;
+    assert(cuda::std::get<1>(*v.begin()) == 30.);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(), "");
+
+  return 0;
+}
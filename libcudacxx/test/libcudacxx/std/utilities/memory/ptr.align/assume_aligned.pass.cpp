@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template <size_t N, class T>
+// constexpr T* assume_aligned(T* ptr);
+
+#include <cuda/std/__memory_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+template <class T>
+__host__ __device__ TEST_CONSTEXPR_CXX14 bool test()
+{
+  alignas(64) T data[4] = {};
+
+  static_assert(cuda::std::is_same<decltype(cuda::std::assume_aligned<1>(data)), T*>::value, "");
+  static_assert(noexcept(cuda::std::assume_aligned<1>(data)), "");
+
+  assert(cuda::std::assume_aligned<1>(data) == data);
+  assert(cuda::std::assume_aligned<alignof(T)>(data) == data);
+  assert(cuda::std::assume_aligned<64>(data) == data);
+  assert(cuda::std::assume_aligned<alignof(T)>(data + 1) == data + 1);
+
+  const T* cdata = data;
+  static_assert(cuda::std::is_same<decltype(cuda::std::assume_aligned<64>(cdata)), const T*>::value, "");
+  assert(cuda::std::assume_aligned<64>(cdata) == cdata);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test<char>();
+  test<int>();
+  test<double>();
+  test<cuda::std::uint64_t>();
+#if TEST_STD_VER > 2011 && defined(_LIBCUDACXX_IS_CONSTANT_EVALUATED)
+  static_assert(test<int>(), "");
+  static_assert(test<double>(), "");
+#endif // TEST_STD_VER > 2011 && _LIBCUDACXX_IS_CONSTANT_EVALUATED
+
+  return 0;
+}
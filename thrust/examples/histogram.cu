@@ -2,6 +2,7 @@
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/device_vector.h>
+#include <thrust/histogram.h>
 #include <thrust/host_vector.h>
 #include <thrust/inner_product.h>
 #include <thrust/iterator/constant_iterator.h>
@@ -36,9 +37,11 @@
 // of structures" layout.
 //
 // The best histogramming methods depends on the application.
-// If the number of bins is relatively small compared to the
-// input size, then the binary search-based dense histogram
-// method is probably best.  If the number of bins is comparable
+// If the bins are known in advance, thrust::histogram_even and
+// thrust::histogram_range count the samples directly without
+// sorting or copying the data. Otherwise, if the number of bins
+// is relatively small compared to the input size, then the
+// binary search-based dense histogram method is probably best.  If the number of bins is comparable
 // to the input size, then the reduce_by_key-based sparse method
 // ought to be faster.  When in doubt, try both and see which
 // is fastest.
@@ -94,6 +97,29 @@ void dense_histogram(const Vector1& input, Vector2& histogram)
   print_vector("histogram", histogram);
 }
 
+// dense histogram using histogram_even
+template <typename Vector1, typename Vector2>
+void even_histogram(const Vector1& input, Vector2& histogram)
+{
+  typedef typename Vector1::value_type ValueType; // input value type
+
+  // print the initial data
+  print_vector("initial data", input);
+
+  // one bin for every value in [0, 9)
+  const int num_bins = 9;
+
+  // resize histogram storage
+  histogram.resize(num_bins);
+
+  // count the values in each bin, the bins are given by num_bins + 1 evenly spaced levels
+  thrust::histogram_even(
+    input.begin(), input.end(), histogram.begin(), num_bins + 1, ValueType(0), ValueType(num_bins));
+
+  // print the histogram
+  print_vector("histogram", histogram);
+}
+
 // sparse histogram using reduce_by_key
 template <typename Vector1, typename Vector2, typename Vector3>
 void sparse_histogram(const Vector1& input, Vector2& histogram_values, Vector3& histogram_counts)
@@ -166,6 +192,14 @@ int main(void)
     dense_histogram(input, histogram);
   }
 
+  // demonstrate histogram_even
+  {
+    std::cout << "Even Histogram" << std::endl;
+    thrust::device_vector<int> data(input);
+    thrust::device_vector<int> histogram;
+    even_histogram(data, histogram);
+  }
+
   // demonstrate sparse histogram method
   {
     std::cout << "Sparse Histogram" << std::endl;
@@ -1,7 +1,9 @@
 // Occasionally, it is advantageous to avoid initializing the individual
 // elements of a device_vector. For example, the default behavior of
 // zero-initializing numeric data may introduce undesirable overhead.
-// This example demonstrates how to avoid default construction of a
+// The constructors and resize overload which take thrust::default_init
+// leave trivially constructible elements uninitialized. This example also
+// demonstrates how to avoid default construction of all of a
 // device_vector's data by using a custom allocator.
 
 #include <thrust/device_allocator.h>
@@ -53,6 +55,10 @@ typedef thrust::device_vector<float, uninitialized_allocator<float>> uninitializ
 
 int main()
 {
+  // default_init leaves the elements uninitialized in the calls which take it
+  thrust::device_vector<float> default_init_vec(10, thrust::default_init);
+  default_init_vec.resize(20, thrust::default_init);
+
   uninitialized_vector vec(10);
 
   // the initial value of vec's 10 elements is undefined
@@ -0,0 +1,142 @@
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/retag.h>
+
+#include <unittest/unittest.h>
+
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void copy_batched(my_system& system, InputBufferIterator, OutputBufferIterator, SizeIterator, Size)
+{
+  system.validate_dispatch();
+}
+
+void TestCopyBatchedDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::copy_batched(sys, vec.begin(), vec.begin(), vec.begin(), 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestCopyBatchedDispatchExplicit);
+
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void copy_batched(my_tag, InputBufferIterator, OutputBufferIterator output_buffers, SizeIterator, Size)
+{
+  *output_buffers = 13;
+}
+
+void TestCopyBatchedDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::copy_batched(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.begin()), 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestCopyBatchedDispatchImplicit);
+
+void TestCopyBatchedSimple()
+{
+  const int a[2] = {1, 2};
+  const int b[3] = {3, 4, 5};
+  const int c[1] = {6};
+  int x[2]       = {0, 0};
+  int y[3]       = {0, 0, 0};
+  int z[1]       = {0};
+
+  // empty buffers may be null
+  const int* input_buffers[4] = {a, b, nullptr, c};
+  int* output_buffers[4]      = {x, y, nullptr, z};
+  const int sizes[4]          = {2, 3, 0, 1};
+
+  thrust::copy_batched(thrust::host, input_buffers, output_buffers, sizes, 4);
+
+  ASSERT_EQUAL(x[0], 1);
+  ASSERT_EQUAL(x[1], 2);
+  ASSERT_EQUAL(y[0], 3);
+  ASSERT_EQUAL(y[1], 4);
+  ASSERT_EQUAL(y[2], 5);
+  ASSERT_EQUAL(z[0], 6);
+
+  // no buffers at all
+  thrust::copy_batched(thrust::host, input_buffers, output_buffers, sizes, 0);
+}
+DECLARE_UNITTEST(TestCopyBatchedSimple);
+
+// splits n elements into buffers of mostly small sizes, some of them empty,
+// and one which holds about half of all elements
+inline thrust::host_vector<size_t> copy_batched_sizes(const size_t n)
+{
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(2 * n);
+  thrust::host_vector<size_t> sizes;
+
+  for (size_t i = 0, total = 0; total < n; i++)
+  {
+    size_t size = i == 1 ? n / 2 : i % 5 == 4 ? 0 : 1 + random[i] % 7;
+    size        = size < n - total ? size : n - total;
+
+    sizes.push_back(size);
+    total += size;
+  }
+
+  return sizes;
+}
+
+template <typename T>
+void TestCopyBatched(const size_t n)
+{
+  thrust::host_vector<size_t> h_sizes = copy_batched_sizes(n);
+  const size_t num_buffers            = h_sizes.size();
+
+  thrust::host_vector<T> h_input = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_output(n, T(0));
+
+  thrust::device_vector<T> d_input = h_input;
+  thrust::device_vector<T> d_output(n, T(0));
+
+  // the buffers of the inputs are copied to the outputs in reverse order
+  thrust::host_vector<const T*> h_input_buffers(num_buffers);
+  thrust::host_vector<T*> h_output_buffers(num_buffers);
+  thrust::host_vector<const T*> d_input_buffers(num_buffers);
+  thrust::host_vector<T*> d_output_buffers(num_buffers);
+
+  for (size_t i = 0, offset = 0; i < num_buffers; i++)
+  {
+    const size_t output_offset = n - offset - h_sizes[i];
+
+    h_input_buffers[i]  = thrust::raw_pointer_cast(h_input.data()) + offset;
+    h_output_buffers[i] = thrust::raw_pointer_cast(h_output.data()) + output_offset;
+    d_input_buffers[i]  = thrust::raw_pointer_cast(d_input.data()) + offset;
+    d_output_buffers[i] = thrust::raw_pointer_cast(d_output.data()) + output_offset;
+
+    offset += h_sizes[i];
+  }
+
+  // reference
+  thrust::host_vector<T> reference(n);
+  for (size_t i = 0, offset = 0; i < num_buffers; i++)
+  {
+    for (size_t j = 0; j < h_sizes[i]; j++)
+    {
+      reference[n - offset - h_sizes[i] + j] = h_input[offset + j];
+    }
+
+    offset += h_sizes[i];
+  }
+
+  thrust::copy_batched(h_input_buffers.begin(), h_output_buffers.begin(), h_sizes.begin(), num_buffers);
+
+  thrust::device_vector<const T*> d_input_buffers_on_device = d_input_buffers;
+  thrust::device_vector<T*> d_output_buffers_on_device      = d_output_buffers;
+  thrust::device_vector<size_t> d_sizes                     = h_sizes;
+
+  thrust::copy_batched(
+    d_input_buffers_on_device.begin(), d_output_buffers_on_device.begin(), d_sizes.begin(), num_buffers);
+
+  ASSERT_EQUAL(reference, h_output);
+  ASSERT_EQUAL(reference, d_output);
+}
+DECLARE_VARIABLE_UNITTEST(TestCopyBatched);
@@ -0,0 +1,58 @@
+#include <thrust/distance.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+
+#include <unittest/unittest.h>
+
+#if _CCCL_STD_VER >= 2017
+#  include <cuda/std/ranges>
+
+struct square
+{
+  _CCCL_HOST_DEVICE int operator()(int x) const
+  {
+    return x * x;
+  }
+};
+
+// the views report input_iterator_tag as their category, thrust takes their traversal from iterator_concept
+void TestCudaStdViewsTraversal()
+{
+  auto iota       = cuda::std::views::iota(0, 10);
+  auto squares    = iota | cuda::std::views::transform(square{});
+  using iota_it   = decltype(iota.begin());
+  using square_it = decltype(squares.begin());
+
+  ASSERT_EQUAL((std::is_same<std::iterator_traits<square_it>::iterator_category, std::input_iterator_tag>::value),
+               true);
+  ASSERT_EQUAL((std::is_same<thrust::iterator_traversal<iota_it>::type, thrust::random_access_traversal_tag>::value),
+               true);
+  ASSERT_EQUAL(
+    (std::is_same<thrust::iterator_traversal<square_it>::type, thrust::random_access_traversal_tag>::value), true);
+
+  // a filter can't skip ahead, and stays bidirectional
+  auto evens = iota | cuda::std::views::filter([](int x) {
+                 return x % 2 == 0;
+               });
+
+  using evens_it = decltype(evens.begin());
+  ASSERT_EQUAL(
+    (std::is_same<thrust::iterator_traversal<evens_it>::type, thrust::bidirectional_traversal_tag>::value), true);
+}
+DECLARE_UNITTEST(TestCudaStdViewsTraversal);
+
+void TestCudaStdViewsAlgorithms()
+{
+  auto squares = cuda::std::views::iota(0, 100) | cuda::std::views::transform(square{});
+
+  ASSERT_EQUAL(thrust::distance(squares.begin(), squares.end()), 100);
+
+  thrust::host_vector<int> v(squares.begin(), squares.end());
+  ASSERT_EQUAL(v.size(), 100u);
+  ASSERT_EQUAL(v[99], 99 * 99);
+
+  ASSERT_EQUAL(thrust::reduce(thrust::host, squares.begin(), squares.end()), 328350);
+}
+DECLARE_UNITTEST(TestCudaStdViewsAlgorithms);
+#endif // _CCCL_STD_VER >= 2017
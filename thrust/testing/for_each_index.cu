@@ -0,0 +1,178 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <cuda/std/mdspan>
+
+#include <unittest/unittest.h>
+
+// counts how often every index of a row major space is visited
+template <typename Extents>
+struct count_visits
+{
+  Extents extents;
+  int* counts;
+
+  template <typename... Indices>
+  __host__ __device__ void operator()(Indices... idx) const
+  {
+    counts[cuda::std::layout_right::mapping<Extents>(extents)(idx...)] += 1;
+  }
+};
+
+template <typename Policy, typename Extents>
+void CheckForEachIndexVisitsAll(Policy policy, const Extents& extents)
+{
+  size_t n = 1;
+  for (size_t r = 0; r < Extents::rank(); ++r)
+  {
+    n *= extents.extent(r);
+  }
+
+  thrust::device_vector<int> counts(n, 0);
+  count_visits<Extents> f = {extents, thrust::raw_pointer_cast(counts.data())};
+
+  thrust::for_each_index(policy, extents, f);
+
+  thrust::host_vector<int> h_counts = counts;
+  thrust::host_vector<int> ref(n, 1);
+  ASSERT_EQUAL(ref, h_counts);
+}
+
+template <typename Policy>
+void CheckForEachIndex(Policy policy)
+{
+  typedef cuda::std::dextents<int, 1> ext1_t;
+  typedef cuda::std::dextents<int, 2> ext2_t;
+  typedef cuda::std::dextents<int, 3> ext3_t;
+
+  CheckForEachIndexVisitsAll(policy, cuda::std::extents<int>());
+  CheckForEachIndexVisitsAll(policy, ext1_t(1));
+  CheckForEachIndexVisitsAll(policy, ext1_t(10007));
+  CheckForEachIndexVisitsAll(policy, ext2_t(3, 5));
+  CheckForEachIndexVisitsAll(policy, ext2_t(130, 67));
+  CheckForEachIndexVisitsAll(policy, ext2_t(1000, 1));
+  CheckForEachIndexVisitsAll(policy, ext2_t(1, 1000));
+  CheckForEachIndexVisitsAll(policy, ext3_t(7, 65, 129));
+  CheckForEachIndexVisitsAll(policy, cuda::std::extents<size_t, 2, 3, 4, 5>());
+}
+
+void TestForEachIndexDevice()
+{
+  CheckForEachIndex(thrust::device);
+}
+DECLARE_UNITTEST(TestForEachIndexDevice);
+
+void TestForEachIndexSeq()
+{
+  CheckForEachIndex(thrust::seq);
+}
+DECLARE_UNITTEST(TestForEachIndexSeq);
+
+void TestForEachIndexEmpty()
+{
+  thrust::device_vector<int> counts(1, 0);
+  count_visits<cuda::std::dextents<int, 2>> f = {cuda::std::dextents<int, 2>(1, 1),
+                                                 thrust::raw_pointer_cast(counts.data())};
+
+  thrust::for_each_index(thrust::device, cuda::std::dextents<int, 2>(0, 100), f);
+  thrust::for_each_index(thrust::device, cuda::std::dextents<int, 2>(100, 0), f);
+
+  ASSERT_EQUAL(0, counts[0]);
+}
+DECLARE_UNITTEST(TestForEachIndexEmpty);
+
+template <typename T>
+struct times_two
+{
+  __host__ __device__ T operator()(T x) const
+  {
+    return 2 * x;
+  }
+};
+
+void TestTransformMdspan()
+{
+  const int m = 93;
+  const int n = 71;
+
+  thrust::device_vector<int> input(m * n);
+  thrust::sequence(input.begin(), input.end());
+  thrust::device_vector<int> output(m * n, 0);
+
+  typedef cuda::std::dextents<int, 2> ext_t;
+  cuda::std::mdspan<const int, ext_t> in(thrust::raw_pointer_cast(input.data()), m, n);
+  cuda::std::mdspan<int, ext_t, cuda::std::layout_left> out(thrust::raw_pointer_cast(output.data()), m, n);
+
+  thrust::transform(thrust::device, in, out, times_two<int>());
+
+  // the output is the transposed input in row major order
+  thrust::host_vector<int> h_output = output;
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      ASSERT_EQUAL(2 * (i * n + j), h_output[j * m + i]);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTransformMdspan);
+
+void TestTransformMdspanInPlace()
+{
+  thrust::host_vector<float> data(4 * 6);
+  thrust::sequence(data.begin(), data.end());
+
+  cuda::std::mdspan<float, cuda::std::extents<int, 4, 6>> md(data.data());
+  thrust::transform(thrust::host, md, md, times_two<float>());
+
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    ASSERT_EQUAL(2.0f * i, data[i]);
+  }
+}
+DECLARE_UNITTEST(TestTransformMdspanInPlace);
+
+// the extents only have to be equal, not of the same type
+void TestTransformMdspanMixedExtents()
+{
+  thrust::host_vector<int> input(3 * 5);
+  thrust::sequence(input.begin(), input.end());
+  thrust::host_vector<int> output(3 * 5, 0);
+
+  cuda::std::mdspan<const int, cuda::std::extents<int, 3, 5>> in(input.data());
+
+  typedef cuda::std::extents<long, cuda::std::dynamic_extent, 5> ext_t;
+  cuda::std::array<long, 2> strides{1, 3};
+  cuda::std::mdspan<int, ext_t, cuda::std::layout_stride> out(
+    output.data(), cuda::std::layout_stride::mapping<ext_t>(ext_t(3), strides));
+
+  thrust::transform(thrust::host, in, out, times_two<int>());
+
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 5; ++j)
+    {
+      ASSERT_EQUAL(2 * (i * 5 + j), output[j * 3 + i]);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTransformMdspanMixedExtents);
+
+template <typename Extents, typename Function>
+void for_each_index(my_system& system, const Extents&, Function)
+{
+  system.validate_dispatch();
+}
+
+void TestForEachIndexDispatchExplicit()
+{
+  my_system sys(0);
+  thrust::for_each_index(sys, cuda::std::dextents<int, 2>(2, 2), count_visits<cuda::std::dextents<int, 2>>());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestForEachIndexDispatchExplicit);
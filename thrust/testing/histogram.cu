@@ -0,0 +1,273 @@
+#include <thrust/execution_policy.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/retag.h>
+
+#include <limits>
+
+#include <unittest/unittest.h>
+
+template <typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator
+histogram_even(my_system& system, InputIterator, InputIterator, OutputIterator histogram, int, Level, Level)
+{
+  system.validate_dispatch();
+  return histogram;
+}
+
+void TestHistogramEvenDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_even(sys, vec.begin(), vec.end(), vec.begin(), 2, 0, 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchExplicit);
+
+template <typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(my_tag, InputIterator, InputIterator, OutputIterator histogram, int, Level, Level)
+{
+  *histogram = 13;
+  return histogram;
+}
+
+void TestHistogramEvenDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_even(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()), thrust::retag<my_tag>(vec.begin()), 2, 0, 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchImplicit);
+
+template <typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  my_system& system, InputIterator, InputIterator, OutputIterator histogram, RandomAccessIterator, RandomAccessIterator)
+{
+  system.validate_dispatch();
+  return histogram;
+}
+
+void TestHistogramRangeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_range(sys, vec.begin(), vec.end(), vec.begin(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchExplicit);
+
+template <typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  my_tag, InputIterator, InputIterator, OutputIterator histogram, RandomAccessIterator, RandomAccessIterator)
+{
+  *histogram = 13;
+  return histogram;
+}
+
+void TestHistogramRangeDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_range(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchImplicit);
+
+template <typename Vector>
+void TestHistogramEvenSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector samples(8);
+  samples[0] = T(2);
+  samples[1] = T(6);
+  samples[2] = T(7);
+  samples[3] = T(2);
+  samples[4] = T(3);
+  samples[5] = T(0);
+  samples[6] = T(2);
+  samples[7] = T(2);
+
+  Vector histogram(4);
+
+  typename Vector::iterator end =
+    thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 5, T(0), T(8));
+
+  ASSERT_EQUAL(end - histogram.begin(), 4);
+  ASSERT_EQUAL(histogram[0], T(1));
+  ASSERT_EQUAL(histogram[1], T(5));
+  ASSERT_EQUAL(histogram[2], T(0));
+  ASSERT_EQUAL(histogram[3], T(2));
+
+  // samples outside of [lower_level, upper_level) are ignored
+  end = thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 3, T(0), T(4));
+
+  ASSERT_EQUAL(end - histogram.begin(), 2);
+  ASSERT_EQUAL(histogram[0], T(1));
+  ASSERT_EQUAL(histogram[1], T(5));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramEvenSimple);
+
+template <typename Vector>
+void TestHistogramRangeSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector samples(8);
+  samples[0] = T(2);
+  samples[1] = T(6);
+  samples[2] = T(7);
+  samples[3] = T(2);
+  samples[4] = T(3);
+  samples[5] = T(0);
+  samples[6] = T(2);
+  samples[7] = T(2);
+
+  Vector levels(5);
+  levels[0] = T(0);
+  levels[1] = T(2);
+  levels[2] = T(3);
+  levels[3] = T(6);
+  levels[4] = T(8);
+
+  Vector histogram(4);
+
+  typename Vector::iterator end =
+    thrust::histogram_range(samples.begin(), samples.end(), histogram.begin(), levels.begin(), levels.end());
+
+  ASSERT_EQUAL(end - histogram.begin(), 4);
+  ASSERT_EQUAL(histogram[0], T(1));
+  ASSERT_EQUAL(histogram[1], T(4));
+  ASSERT_EQUAL(histogram[2], T(1));
+  ASSERT_EQUAL(histogram[3], T(2));
+
+  // samples outside of [levels[0], levels[last]) are ignored
+  end =
+    thrust::histogram_range(samples.begin(), samples.end(), histogram.begin(), levels.begin() + 1, levels.end() - 1);
+
+  ASSERT_EQUAL(end - histogram.begin(), 2);
+  ASSERT_EQUAL(histogram[0], T(4));
+  ASSERT_EQUAL(histogram[1], T(1));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramRangeSimple);
+
+void TestHistogramEvenNegativeLevels()
+{
+  const int samples[6] = {-128, -100, -1, 0, 99, 127};
+  int histogram[2];
+
+  // the range [-128, 127) is wider than signed char's maximum
+  thrust::histogram_even(thrust::host, samples, samples + 6, histogram, 3, (signed char) -128, (signed char) 127);
+
+  ASSERT_EQUAL(histogram[0], 3);
+  ASSERT_EQUAL(histogram[1], 2);
+}
+DECLARE_UNITTEST(TestHistogramEvenNegativeLevels);
+
+void TestHistogramEvenNaN()
+{
+  const float samples[4] = {0.5f, std::numeric_limits<float>::quiet_NaN(), 1.5f, 1.75f};
+  int histogram[2];
+
+  thrust::histogram_even(thrust::host, samples, samples + 4, histogram, 3, 0.0f, 2.0f);
+
+  ASSERT_EQUAL(histogram[0], 1);
+  ASSERT_EQUAL(histogram[1], 2);
+}
+DECLARE_UNITTEST(TestHistogramEvenNaN);
+
+// samples in [0, 113), skewed towards the low end so that consecutive samples
+// often fall into the same bin
+template <typename T>
+thrust::host_vector<T> histogram_samples(const size_t n)
+{
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<T> samples(n);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    const unsigned int r = random[i] % 113;
+    samples[i]           = static_cast<T>(i % 4 == 0 ? r : r % 7);
+  }
+
+  return samples;
+}
+
+template <typename T>
+void TestHistogramEven(const size_t n)
+{
+  thrust::host_vector<T> h_samples   = histogram_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  // reference: ten bins of width ten in [0, 100)
+  thrust::host_vector<int> reference(10, 0);
+  for (size_t i = 0; i < n; i++)
+  {
+    const int sample = static_cast<int>(h_samples[i]);
+    if (sample < 100)
+    {
+      ++reference[sample / 10];
+    }
+  }
+
+  thrust::host_vector<int> h_histogram(10);
+  thrust::device_vector<int> d_histogram(10);
+
+  thrust::histogram_even(h_samples.begin(), h_samples.end(), h_histogram.begin(), 11, T(0), T(100));
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 11, T(0), T(100));
+
+  ASSERT_EQUAL(reference, h_histogram);
+  ASSERT_EQUAL(reference, d_histogram);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramEven);
+
+template <typename T>
+void TestHistogramRange(const size_t n)
+{
+  thrust::host_vector<T> h_samples   = histogram_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  thrust::host_vector<T> h_levels(6);
+  h_levels[0] = T(1);
+  h_levels[1] = T(3);
+  h_levels[2] = T(4);
+  h_levels[3] = T(10);
+  h_levels[4] = T(50);
+  h_levels[5] = T(100);
+
+  thrust::device_vector<T> d_levels = h_levels;
+
+  thrust::host_vector<int> reference(5, 0);
+  for (size_t i = 0; i < n; i++)
+  {
+    for (int bin = 0; bin < 5; bin++)
+    {
+      if (h_levels[bin] <= h_samples[i] && h_samples[i] < h_levels[bin + 1])
+      {
+        ++reference[bin];
+      }
+    }
+  }
+
+  thrust::host_vector<int> h_histogram(5);
+  thrust::device_vector<int> d_histogram(5);
+
+  thrust::histogram_range(h_samples.begin(), h_samples.end(), h_histogram.begin(), h_levels.begin(), h_levels.end());
+  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_histogram.begin(), d_levels.begin(), d_levels.end());
+
+  ASSERT_EQUAL(reference, h_histogram);
+  ASSERT_EQUAL(reference, d_histogram);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramRange);
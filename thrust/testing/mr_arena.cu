@@ -0,0 +1,207 @@
+#include <thrust/mr/arena.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/tls_arena.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+
+#include <new>
+
+#include <unittest/unittest.h>
+
+struct counting_resource final : thrust::mr::new_delete_resource_base
+{
+  std::size_t allocations   = 0;
+  std::size_t deallocations = 0;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocations;
+    return new_delete_resource_base::do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+  {
+    ++deallocations;
+    new_delete_resource_base::do_deallocate(p, bytes, alignment);
+  }
+};
+
+void TestArenaAlignment()
+{
+  counting_resource upstream;
+  thrust::mr::unsynchronized_arena_resource<counting_resource> arena(&upstream);
+
+  for (int round = 0; round < 2; ++round)
+  {
+    void* a = arena.do_allocate(3, 1);
+    void* b = arena.do_allocate(100, 64);
+    void* c = arena.do_allocate(8, 4096);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(b) % 64, 0u);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(c) % 4096, 0u);
+    ASSERT_EQUAL(arena.outstanding(), 3u);
+
+    arena.do_deallocate(b, 100, 64);
+    arena.do_deallocate(a, 3, 1);
+    arena.do_deallocate(c, 8, 4096);
+    ASSERT_EQUAL(arena.outstanding(), 0u);
+  }
+}
+DECLARE_UNITTEST(TestArenaAlignment);
+
+void TestArenaReuse()
+{
+  counting_resource upstream;
+
+  {
+    thrust::mr::unsynchronized_arena_resource<counting_resource> arena(&upstream);
+
+    // the first round doesn't fit into the (empty) block and goes to upstream
+    void* a = arena.do_allocate(1000, 8);
+    void* b = arena.do_allocate(5000, 8);
+    ASSERT_EQUAL(upstream.allocations, 2u);
+    arena.do_deallocate(a, 1000, 8);
+    arena.do_deallocate(b, 5000, 8);
+
+    // ...after which the next allocation grows the block to hold all of it
+    ASSERT_EQUAL(upstream.allocations, 2u);
+    ASSERT_EQUAL(upstream.deallocations, 2u);
+    ASSERT_EQUAL(arena.capacity(), 0u);
+
+    for (int round = 0; round < 10; ++round)
+    {
+      void* c = arena.do_allocate(1000, 8);
+      void* d = arena.do_allocate(5000, 8);
+      ASSERT_EQUAL(static_cast<char*>(d) >= static_cast<char*>(c) + 1000, true);
+      arena.do_deallocate(d, 5000, 8);
+      arena.do_deallocate(c, 1000, 8);
+    }
+    ASSERT_EQUAL(upstream.allocations, 3u);
+    ASSERT_GEQUAL(arena.capacity(), 6000u);
+
+    // nothing is reused while anything is live
+    void* e = arena.do_allocate(16, 8);
+    void* f = arena.do_allocate(16, 8);
+    arena.do_deallocate(e, 16, 8);
+    void* g = arena.do_allocate(16, 8);
+    ASSERT_EQUAL(g == e || g == f, false);
+    arena.do_deallocate(f, 16, 8);
+    arena.do_deallocate(g, 16, 8);
+  }
+
+  ASSERT_EQUAL(upstream.allocations, upstream.deallocations);
+}
+DECLARE_UNITTEST(TestArenaReuse);
+
+void TestArenaMaxCapacity()
+{
+  counting_resource upstream;
+  thrust::mr::unsynchronized_arena_resource<counting_resource> arena(&upstream, 8192);
+  ASSERT_EQUAL(arena.max_capacity(), 8192u);
+
+  for (int round = 0; round < 3; ++round)
+  {
+    void* a = arena.do_allocate(100000, 8);
+    arena.do_deallocate(a, 100000, 8);
+  }
+
+  // the block stops at the limit, and what doesn't fit keeps going to upstream
+  ASSERT_EQUAL(arena.capacity(), 8192u);
+  ASSERT_EQUAL(upstream.allocations, 4u);
+
+  arena.release();
+  ASSERT_EQUAL(arena.capacity(), 0u);
+  ASSERT_EQUAL(upstream.allocations, upstream.deallocations);
+
+  // after a release, the block is only grown again once it overflows
+  void* b = arena.do_allocate(16, 8);
+  arena.do_deallocate(b, 16, 8);
+  ASSERT_EQUAL(upstream.allocations, 5u);
+  ASSERT_EQUAL(arena.capacity(), 0u);
+}
+DECLARE_UNITTEST(TestArenaMaxCapacity);
+
+struct failing_resource final : thrust::mr::new_delete_resource_base
+{
+  bool fail = false;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    if (fail)
+    {
+      throw std::bad_alloc();
+    }
+    return new_delete_resource_base::do_allocate(bytes, alignment);
+  }
+};
+
+void TestArenaDeallocateDoesNotAllocate()
+{
+  failing_resource upstream;
+  thrust::mr::unsynchronized_arena_resource<failing_resource> arena(&upstream);
+
+  void* a = arena.do_allocate(1000, 8);
+  upstream.fail = true;
+  arena.do_deallocate(a, 1000, 8);
+
+  // the growth of the block is reported by the next allocation instead
+  ASSERT_THROWS(arena.do_allocate(1000, 8), std::bad_alloc);
+  ASSERT_EQUAL(arena.outstanding(), 0u);
+
+  upstream.fail = false;
+  void* b = arena.do_allocate(1000, 8);
+  ASSERT_GEQUAL(arena.capacity(), 1000u);
+  arena.do_deallocate(b, 1000, 8);
+}
+DECLARE_UNITTEST(TestArenaDeallocateDoesNotAllocate);
+
+template <typename Policy>
+void TestScratchArenaPolicy(Policy policy)
+{
+  typedef thrust::mr::unsynchronized_arena_resource<thrust::mr::new_delete_resource> arena_t;
+  arena_t& arena = thrust::mr::tls_arena(thrust::mr::get_global_resource<thrust::mr::new_delete_resource>());
+
+  for (std::size_t n : {10u, 1000u, 100000u})
+  {
+    thrust::host_vector<int> keys(n);
+    thrust::host_vector<int> values(n);
+    thrust::sequence(keys.begin(), keys.end(), static_cast<int>(n), -1);
+    thrust::sequence(values.begin(), values.end());
+
+    thrust::stable_sort_by_key(policy.with_scratch_arena(), keys.begin(), keys.end(), values.begin());
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(keys[i], static_cast<int>(i + 1));
+      ASSERT_EQUAL(values[i], static_cast<int>(n - i - 1));
+    }
+    ASSERT_EQUAL(arena.outstanding(), 0u);
+  }
+
+  thrust::mr::release_tls_arena<thrust::mr::new_delete_resource>();
+  ASSERT_EQUAL(arena.capacity(), 0u);
+}
+
+void TestScratchArenaPolicyCpp()
+{
+  TestScratchArenaPolicy(thrust::cpp::par);
+}
+DECLARE_UNITTEST(TestScratchArenaPolicyCpp);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <thrust/system/omp/execution_policy.h>
+
+void TestScratchArenaPolicyOmp()
+{
+  TestScratchArenaPolicy(thrust::omp::par);
+}
+DECLARE_UNITTEST(TestScratchArenaPolicyOmp);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <thrust/system/tbb/execution_policy.h>
+
+void TestScratchArenaPolicyTbb()
+{
+  TestScratchArenaPolicy(thrust::tbb::par);
+}
+DECLARE_UNITTEST(TestScratchArenaPolicyTbb);
+#endif
@@ -263,6 +263,59 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolManyOversized()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  typedef PoolTemplate<thrust::mr::new_delete_resource, thrust::mr::new_delete_resource> Pool;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  const std::size_t n = 1000;
+  std::vector<void*> blocks(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    blocks[i] = pool.do_allocate(2048 + 16 * i, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  // deallocate every other block, in an order unrelated to the order of allocation
+  for (std::size_t i = 0; i < n; i += 2)
+  {
+    std::size_t j = (i * 7) % n | 1;
+    pool.do_deallocate(blocks[j], 2048 + 16 * j, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  // every cached block is the exact fit for an allocation of its original size
+  for (std::size_t i = 1; i < n; i += 2)
+  {
+    void* p = pool.do_allocate(2048 + 16 * i, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(p, blocks[i]);
+  }
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    pool.do_deallocate(blocks[i], 2048 + 16 * i, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+}
+
+void TestDisjointUnsynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolManyOversized);
+
+void TestDisjointSynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolManyOversized);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
@@ -353,6 +353,171 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedBestFit()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  typedef PoolTemplate<tracked_resource> Pool;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  upstream.id_to_allocate  = 2;
+  tracked_pointer<void> a2 = pool.do_allocate(2560, THRUST_MR_DEFAULT_ALIGNMENT);
+  upstream.id_to_allocate  = 3;
+  tracked_pointer<void> a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  // the biggest block is the most recently cached one
+  pool.do_deallocate(a1, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a2, 2560, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  // make sure that the smallest fitting block is used, not the first one
+  tracked_pointer<void> a4 = pool.do_allocate(2000, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a4.id, 1u);
+
+  tracked_pointer<void> a5 = pool.do_allocate(2100, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a5.id, 2u);
+
+  tracked_pointer<void> a6 = pool.do_allocate(2100, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a6.id, 3u);
+
+  pool.do_deallocate(a6, 2100, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a4, 2000, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a5, 2100, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  pool.release();
+
+  upstream.id_to_allocate  = 4;
+  tracked_pointer<void> a7 = pool.do_allocate(2304, THRUST_MR_DEFAULT_ALIGNMENT);
+  upstream.id_to_allocate  = 5;
+  tracked_pointer<void> a8 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  pool.do_deallocate(a8, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a7, 2304, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  // blocks of similar sizes share a size class; the best fit is found within it too
+  tracked_pointer<void> a9 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a9.id, 5u);
+  tracked_pointer<void> a10 = pool.do_allocate(2100, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(a10.id, 4u);
+
+  pool.do_deallocate(a9, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a10, 2100, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedBestFit);
+
+void TestSynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedBestFit);
+
+template <template <typename> class PoolTemplate>
+void TestPoolTrimmingOversized()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  typedef PoolTemplate<tracked_resource> Pool;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized            = true;
+  opts.largest_block_size         = 1024;
+  opts.max_cached_oversized_bytes = 4096;
+
+  {
+    Pool pool(&upstream, opts);
+
+    upstream.id_to_allocate  = 1;
+    tracked_pointer<void> a1 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    upstream.id_to_allocate  = 2;
+    tracked_pointer<void> a2 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    upstream.id_to_allocate  = 3;
+    tracked_pointer<void> a3 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    pool.do_deallocate(a1, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a2, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // exceeding the high-water mark returns the least recently cached block to upstream
+    upstream.id_to_deallocate = 1;
+    pool.do_deallocate(a3, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    tracked_pointer<void> a4 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a4.id, 3u);
+    tracked_pointer<void> a5 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a5.id, 2u);
+
+    // blocks bigger than the high-water mark aren't cached at all
+    upstream.id_to_allocate  = 4;
+    tracked_pointer<void> a6 = pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a6.id, 4u);
+    upstream.id_to_deallocate = 4;
+    pool.do_deallocate(a6, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    pool.do_deallocate(a4, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a5, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  opts.max_cached_oversized_bytes = 0;
+  opts.cached_oversized_max_idle  = 1;
+
+  upstream.id_to_allocate = -1u;
+
+  {
+    Pool pool(&upstream, opts);
+
+    upstream.id_to_allocate  = 5;
+    tracked_pointer<void> a1 = pool.do_allocate(2048, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.do_deallocate(a1, 2048, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // the cached block doesn't fit, but it has only been idle for a single allocation
+    upstream.id_to_allocate  = 6;
+    tracked_pointer<void> a2 = pool.do_allocate(8192, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a2.id, 6u);
+    pool.do_deallocate(a2, 8192, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // now it has been idle for too long, and is returned to upstream
+    upstream.id_to_deallocate = 5;
+    tracked_pointer<void> a3  = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+    ASSERT_EQUAL(a3.id, 6u);
+    pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  }
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolTrimmingOversized()
+{
+  TestPoolTrimmingOversized<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolTrimmingOversized);
+
+void TestSynchronizedPoolTrimmingOversized()
+{
+  TestPoolTrimmingOversized<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolTrimmingOversized);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -0,0 +1,170 @@
+#include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/statistics.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+struct trace_log
+{
+  std::vector<thrust::mr::allocation_event> events;
+};
+
+void record_event(void* log, const thrust::mr::allocation_event& event)
+{
+  static_cast<trace_log*>(log)->events.push_back(event);
+}
+
+void TestStatisticsResource()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_resource<thrust::mr::new_delete_resource> resource(&upstream);
+
+  void* p1 = resource.do_allocate(100, 16);
+  void* p2 = resource.do_allocate(50, 64);
+  ASSERT_EQUAL(resource.statistics().allocations, 2u);
+  ASSERT_EQUAL(resource.statistics().bytes_in_use, 150u);
+
+  resource.do_deallocate(p1, 100, 16);
+  ASSERT_EQUAL(resource.statistics().deallocations, 1u);
+  ASSERT_EQUAL(resource.statistics().bytes_in_use, 50u);
+  ASSERT_EQUAL(resource.statistics().peak_bytes_in_use, 150u);
+  ASSERT_EQUAL(resource.statistics().total_bytes_allocated, 150u);
+
+  // resetting keeps track of the memory that is still in use
+  resource.reset_statistics();
+  ASSERT_EQUAL(resource.statistics().allocations, 0u);
+  ASSERT_EQUAL(resource.statistics().bytes_in_use, 50u);
+  ASSERT_EQUAL(resource.statistics().peak_bytes_in_use, 50u);
+
+  trace_log log;
+  resource.set_trace_callback(record_event, &log);
+
+  // compared as integers, the pointers are dangling by then
+  void* p3               = resource.do_allocate(10, 8);
+  std::uintptr_t p3_addr = reinterpret_cast<std::uintptr_t>(p3);
+  std::uintptr_t p2_addr = reinterpret_cast<std::uintptr_t>(p2);
+  resource.do_deallocate(p3, 10, 8);
+  resource.do_deallocate(p2, 50, 64);
+
+  resource.set_trace_callback(NULL);
+  void* p4 = resource.do_allocate(10, 8);
+  resource.do_deallocate(p4, 10, 8);
+
+  ASSERT_EQUAL(log.events.size(), 3u);
+  ASSERT_EQUAL(log.events[0].is_allocation, true);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(log.events[0].pointer), p3_addr);
+  ASSERT_EQUAL(log.events[0].bytes, 10u);
+  ASSERT_EQUAL(log.events[0].alignment, 8u);
+  ASSERT_EQUAL(log.events[1].is_allocation, false);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(log.events[1].pointer), p3_addr);
+  ASSERT_EQUAL(log.events[2].is_allocation, false);
+  ASSERT_EQUAL(reinterpret_cast<std::uintptr_t>(log.events[2].pointer), p2_addr);
+  ASSERT_EQUAL(log.events[2].bytes, 50u);
+
+  ASSERT_EQUAL(resource.statistics().bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestStatisticsResource);
+
+template <typename Pool>
+void TestPoolStatistics(Pool& pool)
+{
+  void* a1 = pool.do_allocate(24, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a2 = pool.do_allocate(24, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a3 = pool.do_allocate(4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a3, 4096, THRUST_MR_DEFAULT_ALIGNMENT);
+  void* a4 = pool.do_allocate(4000, THRUST_MR_DEFAULT_ALIGNMENT);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+
+  ASSERT_EQUAL(stats.requests.allocations, 4u);
+  ASSERT_EQUAL(stats.requests.deallocations, 1u);
+  ASSERT_EQUAL(stats.requests.bytes_in_use, 4048u);
+  ASSERT_EQUAL(stats.requests.peak_bytes_in_use, 4144u);
+
+  // one chunk for the small blocks, and one oversized block
+  ASSERT_EQUAL(stats.upstream.allocations, 2u);
+  ASSERT_EQUAL(stats.upstream.deallocations, 0u);
+
+  ASSERT_EQUAL(stats.oversized_cache_hits, 1u);
+  ASSERT_EQUAL(stats.oversized_cache_misses, 1u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+
+  // the first allocation creates a chunk of 32 byte blocks, the second one is served from it
+  ASSERT_EQUAL(stats.buckets.size(), 7u);
+  ASSERT_EQUAL(stats.buckets[1].block_size, 32u);
+  ASSERT_EQUAL(stats.buckets[1].hits, 1u);
+  ASSERT_EQUAL(stats.buckets[1].misses, 1u);
+  ASSERT_EQUAL(stats.buckets[0].hits + stats.buckets[0].misses, 0u);
+
+  pool.do_deallocate(a4, 4000, THRUST_MR_DEFAULT_ALIGNMENT);
+  ASSERT_EQUAL(pool.statistics().cached_oversized_bytes, 4096u);
+
+  pool.reset_statistics();
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.requests.allocations, 0u);
+  ASSERT_EQUAL(stats.requests.bytes_in_use, 48u);
+  ASSERT_EQUAL(stats.buckets[1].hits, 0u);
+  ASSERT_EQUAL(stats.oversized_cache_hits, 0u);
+
+  std::ostringstream json;
+  thrust::mr::write_json(json, stats);
+  std::string str = json.str();
+  ASSERT_EQUAL(str.find("{\"requests\": {\"allocations\": 0, \"deallocations\": 0, \"bytes_in_use\": 48,"), 0u);
+  ASSERT_EQUAL(str.find("\"cached_oversized_bytes\": 4096") != std::string::npos, true);
+  ASSERT_EQUAL(str.find("{\"block_size\": 32, \"hits\": 0, \"misses\": 0}") != std::string::npos, true);
+  ASSERT_EQUAL(str[str.size() - 1], '}');
+
+  pool.do_deallocate(a1, 24, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.do_deallocate(a2, 24, THRUST_MR_DEFAULT_ALIGNMENT);
+  pool.release();
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.requests.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.upstream.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.cached_oversized_bytes, 0u);
+}
+
+template <typename Pool>
+thrust::mr::pool_options statistics_test_options()
+{
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.smallest_block_size      = 16;
+  opts.largest_block_size       = 1024;
+  return opts;
+}
+
+void TestUnsynchronizedPoolStatistics()
+{
+  typedef thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource> Pool;
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream, statistics_test_options<Pool>());
+  TestPoolStatistics(pool);
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStatistics);
+
+void TestSynchronizedPoolStatistics()
+{
+  typedef thrust::mr::synchronized_pool_resource<thrust::mr::new_delete_resource> Pool;
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream, statistics_test_options<Pool>());
+  TestPoolStatistics(pool);
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStatistics);
+
+void TestDisjointPoolStatistics()
+{
+  typedef thrust::mr::disjoint_unsynchronized_pool_resource<thrust::mr::new_delete_resource,
+                                                            thrust::mr::new_delete_resource>
+    Pool;
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+  Pool pool(&upstream, &bookkeeper, statistics_test_options<Pool>());
+  TestPoolStatistics(pool);
+}
+DECLARE_UNITTEST(TestDisjointPoolStatistics);
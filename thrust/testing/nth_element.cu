@@ -0,0 +1,173 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator>
+void nth_element(my_system& system, RandomAccessIterator, RandomAccessIterator, RandomAccessIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestNthElementDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::nth_element(sys, vec.begin(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestNthElementDispatchExplicit);
+
+template <typename RandomAccessIterator>
+void nth_element(my_tag, RandomAccessIterator first, RandomAccessIterator, RandomAccessIterator)
+{
+  *first = 13;
+}
+
+void TestNthElementDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::nth_element(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestNthElementDispatchImplicit);
+
+template <typename Vector>
+void TestNthElementSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(7);
+  v[0] = T(5);
+  v[1] = T(1);
+  v[2] = T(6);
+  v[3] = T(3);
+  v[4] = T(7);
+  v[5] = T(2);
+  v[6] = T(4);
+
+  thrust::nth_element(v.begin(), v.begin() + 3, v.end());
+
+  ASSERT_EQUAL(v[3], T(4));
+  for (int i = 0; i < 3; i++)
+  {
+    ASSERT_EQUAL(true, v[i] < T(4));
+  }
+  for (int i = 4; i < 7; i++)
+  {
+    ASSERT_EQUAL(true, T(4) < v[i]);
+  }
+
+  thrust::nth_element(v.begin(), v.begin() + 1, v.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(v[1], T(6));
+
+  // nth == last has no effect
+  Vector w = v;
+  thrust::nth_element(v.begin(), v.end(), v.end());
+
+  ASSERT_EQUAL(v, w);
+}
+DECLARE_VECTOR_UNITTEST(TestNthElementSimple);
+
+// checks that [first, last) is partitioned around *nth and that *nth is the
+// element which the sorted reference holds at its position
+template <typename Vector, typename T>
+void CheckNthElement(const Vector& d_data, const thrust::host_vector<T>& sorted, size_t nth)
+{
+  thrust::host_vector<T> h_data = d_data;
+
+  ASSERT_EQUAL(h_data[nth], sorted[nth]);
+
+  for (size_t i = 0; i < nth; i++)
+  {
+    ASSERT_EQUAL(false, h_data[nth] < h_data[i]);
+  }
+  for (size_t i = nth + 1; i < h_data.size(); i++)
+  {
+    ASSERT_EQUAL(false, h_data[i] < h_data[nth]);
+  }
+}
+
+template <typename T>
+void TestNthElement(const size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end());
+
+  const size_t positions[4] = {0, n / 3, n / 2, n - 1};
+
+  for (int i = 0; i < 4; i++)
+  {
+    thrust::host_vector<T> h_result   = h_data;
+    thrust::device_vector<T> d_result = h_data;
+
+    thrust::nth_element(h_result.begin(), h_result.begin() + positions[i], h_result.end());
+    thrust::nth_element(d_result.begin(), d_result.begin() + positions[i], d_result.end());
+
+    CheckNthElement(h_result, sorted, positions[i]);
+    CheckNthElement(d_result, sorted, positions[i]);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestNthElement);
+
+void TestNthElementManyDuplicates()
+{
+  const size_t n = 100003;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_data[i] = static_cast<unsigned int>(h_data[i]) % 5;
+  }
+
+  thrust::host_vector<int> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end());
+
+  thrust::host_vector<int> h_result   = h_data;
+  thrust::device_vector<int> d_result = h_data;
+
+  thrust::nth_element(h_result.begin(), h_result.begin() + n / 2, h_result.end());
+  thrust::nth_element(d_result.begin(), d_result.begin() + n / 2, d_result.end());
+
+  CheckNthElement(h_result, sorted, n / 2);
+  CheckNthElement(d_result, sorted, n / 2);
+}
+DECLARE_UNITTEST(TestNthElementManyDuplicates);
+
+void TestNthElementDescending()
+{
+  const size_t n = 10027;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+
+  thrust::host_vector<int> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end(), thrust::greater<int>());
+
+  thrust::device_vector<int> d_result = h_data;
+  thrust::nth_element(d_result.begin(), d_result.begin() + 100, d_result.end(), thrust::greater<int>());
+
+  thrust::host_vector<int> h_result = d_result;
+
+  ASSERT_EQUAL(h_result[100], sorted[100]);
+  for (size_t i = 0; i < 100; i++)
+  {
+    ASSERT_EQUAL(false, h_result[i] < h_result[100]);
+  }
+}
+DECLARE_UNITTEST(TestNthElementDescending);
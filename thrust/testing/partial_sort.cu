@@ -0,0 +1,216 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator>
+void partial_sort(my_system& system, RandomAccessIterator, RandomAccessIterator, RandomAccessIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestPartialSortDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::partial_sort(sys, vec.begin(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestPartialSortDispatchExplicit);
+
+template <typename RandomAccessIterator>
+void partial_sort(my_tag, RandomAccessIterator first, RandomAccessIterator, RandomAccessIterator)
+{
+  *first = 13;
+}
+
+void TestPartialSortDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::partial_sort(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestPartialSortDispatchImplicit);
+
+template <typename InputIterator, typename RandomAccessIterator>
+RandomAccessIterator
+partial_sort_copy(my_system& system, InputIterator, InputIterator, RandomAccessIterator result, RandomAccessIterator)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestPartialSortCopyDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::partial_sort_copy(sys, vec.begin(), vec.end(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestPartialSortCopyDispatchExplicit);
+
+template <typename InputIterator, typename RandomAccessIterator>
+RandomAccessIterator
+partial_sort_copy(my_tag, InputIterator, InputIterator, RandomAccessIterator result, RandomAccessIterator)
+{
+  *result = 13;
+  return result;
+}
+
+void TestPartialSortCopyDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::partial_sort_copy(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestPartialSortCopyDispatchImplicit);
+
+template <typename Vector>
+void TestPartialSortSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(7);
+  v[0] = T(5);
+  v[1] = T(1);
+  v[2] = T(6);
+  v[3] = T(3);
+  v[4] = T(7);
+  v[5] = T(2);
+  v[6] = T(4);
+
+  thrust::partial_sort(v.begin(), v.begin() + 3, v.end());
+
+  ASSERT_EQUAL(v[0], T(1));
+  ASSERT_EQUAL(v[1], T(2));
+  ASSERT_EQUAL(v[2], T(3));
+
+  thrust::partial_sort(v.begin(), v.begin() + 2, v.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(v[0], T(7));
+  ASSERT_EQUAL(v[1], T(6));
+}
+DECLARE_VECTOR_UNITTEST(TestPartialSortSimple);
+
+template <typename Vector>
+void TestPartialSortCopySimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(7);
+  v[0] = T(5);
+  v[1] = T(1);
+  v[2] = T(6);
+  v[3] = T(3);
+  v[4] = T(7);
+  v[5] = T(2);
+  v[6] = T(4);
+
+  Vector input = v;
+  Vector result(3);
+
+  typename Vector::iterator end = thrust::partial_sort_copy(v.begin(), v.end(), result.begin(), result.end());
+
+  ASSERT_EQUAL(end - result.begin(), 3);
+  ASSERT_EQUAL(result[0], T(1));
+  ASSERT_EQUAL(result[1], T(2));
+  ASSERT_EQUAL(result[2], T(3));
+  ASSERT_EQUAL(v, input);
+
+  end = thrust::partial_sort_copy(v.begin(), v.end(), result.begin(), result.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(end - result.begin(), 3);
+  ASSERT_EQUAL(result[0], T(7));
+  ASSERT_EQUAL(result[1], T(6));
+  ASSERT_EQUAL(result[2], T(5));
+
+  // a result longer than the input receives all of it
+  Vector large_result(10);
+  end = thrust::partial_sort_copy(v.begin(), v.begin() + 4, large_result.begin(), large_result.end());
+
+  ASSERT_EQUAL(end - large_result.begin(), 4);
+  ASSERT_EQUAL(large_result[0], T(1));
+  ASSERT_EQUAL(large_result[1], T(3));
+  ASSERT_EQUAL(large_result[2], T(5));
+  ASSERT_EQUAL(large_result[3], T(6));
+}
+DECLARE_VECTOR_UNITTEST(TestPartialSortCopySimple);
+
+template <typename T>
+void TestPartialSort(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end());
+
+  const size_t sizes[3] = {0, (std::min)(n, size_t(100)), n / 2};
+
+  for (int i = 0; i < 3; i++)
+  {
+    const size_t k = sizes[i];
+
+    thrust::host_vector<T> h_result   = h_data;
+    thrust::device_vector<T> d_result = h_data;
+
+    thrust::partial_sort(h_result.begin(), h_result.begin() + k, h_result.end());
+    thrust::partial_sort(d_result.begin(), d_result.begin() + k, d_result.end());
+
+    thrust::host_vector<T> reference(sorted.begin(), sorted.begin() + k);
+
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(h_result.begin(), h_result.begin() + k));
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(d_result.begin(), d_result.begin() + k));
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestPartialSort);
+
+template <typename T>
+void TestPartialSortCopy(const size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end());
+
+  const size_t sizes[3] = {1, 100, n / 2};
+
+  for (int i = 0; i < 3; i++)
+  {
+    const size_t k = sizes[i];
+
+    thrust::host_vector<T> h_result(k);
+    thrust::device_vector<T> d_result(k);
+
+    typename thrust::host_vector<T>::iterator h_end =
+      thrust::partial_sort_copy(h_data.begin(), h_data.end(), h_result.begin(), h_result.end());
+    typename thrust::device_vector<T>::iterator d_end =
+      thrust::partial_sort_copy(d_data.begin(), d_data.end(), d_result.begin(), d_result.end());
+
+    const size_t m = (std::min)(n, k);
+
+    thrust::host_vector<T> reference(sorted.begin(), sorted.begin() + m);
+
+    ASSERT_EQUAL(size_t(h_end - h_result.begin()), m);
+    ASSERT_EQUAL(size_t(d_end - d_result.begin()), m);
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(h_result.begin(), h_end));
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(d_result.begin(), d_end));
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestPartialSortCopy);
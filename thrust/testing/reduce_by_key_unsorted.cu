@@ -0,0 +1,302 @@
+#include <thrust/fill.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+template <typename Vector>
+void TestReduceByKeyUnsortedSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector keys(7);
+  Vector values(7);
+
+  keys[0] = 1;
+  keys[1] = 3;
+  keys[2] = 3;
+  keys[3] = 3;
+  keys[4] = 2;
+  keys[5] = 2;
+  keys[6] = 1;
+
+  values[0] = 9;
+  values[1] = 8;
+  values[2] = 7;
+  values[3] = 6;
+  values[4] = 5;
+  values[5] = 4;
+  values[6] = 3;
+
+  Vector output_keys(keys.size());
+  Vector output_values(values.size());
+
+  typename thrust::pair<typename Vector::iterator, typename Vector::iterator> new_last =
+    thrust::reduce_by_key_unsorted(keys.begin(), keys.end(), values.begin(), output_keys.begin(), output_values.begin());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 3);
+  ASSERT_EQUAL(new_last.second - output_values.begin(), 3);
+
+  // the order of the output is unspecified
+  output_keys.resize(3);
+  output_values.resize(3);
+  thrust::sort_by_key(output_keys.begin(), output_keys.end(), output_values.begin());
+
+  ASSERT_EQUAL(output_keys[0], T(1));
+  ASSERT_EQUAL(output_keys[1], T(2));
+  ASSERT_EQUAL(output_keys[2], T(3));
+
+  ASSERT_EQUAL(output_values[0], T(12));
+  ASSERT_EQUAL(output_values[1], T(9));
+  ASSERT_EQUAL(output_values[2], T(21));
+
+  // test BinaryFunction
+  new_last = thrust::reduce_by_key_unsorted(
+    keys.begin(),
+    keys.end(),
+    values.begin(),
+    output_keys.begin(),
+    output_values.begin(),
+    thrust::equal_to<T>(),
+    thrust::maximum<T>());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 3);
+  thrust::sort_by_key(output_keys.begin(), output_keys.end(), output_values.begin());
+
+  ASSERT_EQUAL(output_values[0], T(9));
+  ASSERT_EQUAL(output_values[1], T(5));
+  ASSERT_EQUAL(output_values[2], T(8));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestReduceByKeyUnsortedSimple);
+
+template <typename K>
+struct TestReduceByKeyUnsorted
+{
+  void operator()(const size_t n)
+  {
+    typedef unsigned int V; // ValueType
+
+    thrust::host_vector<K> h_keys = unittest::random_integers<K>(n);
+    thrust::host_vector<V> h_vals = unittest::random_integers<V>(n);
+
+    // limit the number of distinct keys so that most of them repeat
+    for (size_t i = 0; i < n; i++)
+    {
+      h_keys[i] = static_cast<K>(static_cast<unsigned int>(h_keys[i]) % 37);
+    }
+
+    thrust::device_vector<K> d_keys = h_keys;
+    thrust::device_vector<V> d_vals = h_vals;
+
+    // reference: sort the input and reduce consecutive keys
+    thrust::host_vector<K> h_sorted_keys = h_keys;
+    thrust::host_vector<V> h_sorted_vals = h_vals;
+    thrust::stable_sort_by_key(h_sorted_keys.begin(), h_sorted_keys.end(), h_sorted_vals.begin());
+
+    thrust::host_vector<K> h_keys_output(n);
+    thrust::host_vector<V> h_vals_output(n);
+    size_t N = thrust::reduce_by_key(h_sorted_keys.begin(),
+                                     h_sorted_keys.end(),
+                                     h_sorted_vals.begin(),
+                                     h_keys_output.begin(),
+                                     h_vals_output.begin())
+                 .first
+             - h_keys_output.begin();
+    h_keys_output.resize(N);
+    h_vals_output.resize(N);
+
+    thrust::device_vector<K> d_keys_output(n);
+    thrust::device_vector<V> d_vals_output(n);
+    size_t d_N = thrust::reduce_by_key_unsorted(
+                   d_keys.begin(), d_keys.end(), d_vals.begin(), d_keys_output.begin(), d_vals_output.begin())
+                   .first
+               - d_keys_output.begin();
+
+    ASSERT_EQUAL(N, d_N);
+
+    d_keys_output.resize(d_N);
+    d_vals_output.resize(d_N);
+    thrust::sort_by_key(d_keys_output.begin(), d_keys_output.end(), d_vals_output.begin());
+
+    ASSERT_EQUAL(h_keys_output, d_keys_output);
+    ASSERT_EQUAL(h_vals_output, d_vals_output);
+  }
+};
+VariableUnitTest<TestReduceByKeyUnsorted, IntegralTypes> TestReduceByKeyUnsortedInstance;
+
+template <typename T>
+struct equal_mod_10
+{
+  __host__ __device__ bool operator()(T x, T y) const
+  {
+    return x % 10 == y % 10;
+  }
+};
+
+template <typename T>
+struct less_mod_10
+{
+  __host__ __device__ bool operator()(T x, T y) const
+  {
+    return x % 10 < y % 10;
+  }
+};
+
+template <typename Vector>
+void TestReduceByKeyUnsortedCompare(void)
+{
+  typedef typename Vector::value_type T;
+
+  // 3, 13 and 23 as well as 5 and 15 are equal, but not next to each other in the usual order
+  Vector keys(6);
+  Vector values(6);
+
+  keys[0] = 3;
+  keys[1] = 13;
+  keys[2] = 5;
+  keys[3] = 23;
+  keys[4] = 15;
+  keys[5] = 4;
+
+  values[0] = 1;
+  values[1] = 2;
+  values[2] = 3;
+  values[3] = 4;
+  values[4] = 5;
+  values[5] = 6;
+
+  Vector output_keys(keys.size());
+  Vector output_values(values.size());
+
+  typename thrust::pair<typename Vector::iterator, typename Vector::iterator> new_last =
+    thrust::reduce_by_key_unsorted(
+      keys.begin(),
+      keys.end(),
+      values.begin(),
+      output_keys.begin(),
+      output_values.begin(),
+      equal_mod_10<T>(),
+      thrust::plus<T>(),
+      less_mod_10<T>());
+
+  ASSERT_EQUAL(new_last.first - output_keys.begin(), 3);
+  ASSERT_EQUAL(new_last.second - output_values.begin(), 3);
+
+  // the order of the output is unspecified
+  output_keys.resize(3);
+  output_values.resize(3);
+  thrust::sort_by_key(output_keys.begin(), output_keys.end(), output_values.begin(), less_mod_10<T>());
+
+  ASSERT_EQUAL(output_keys[0] % 10, T(3));
+  ASSERT_EQUAL(output_keys[1] % 10, T(4));
+  ASSERT_EQUAL(output_keys[2] % 10, T(5));
+
+  ASSERT_EQUAL(output_values[0], T(7));
+  ASSERT_EQUAL(output_values[1], T(6));
+  ASSERT_EQUAL(output_values[2], T(8));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestReduceByKeyUnsortedCompare);
+
+template <typename Vector>
+void TestReduceByKeyUnsortedZippedKeys(void)
+{
+  typedef typename Vector::value_type T;
+
+  // the keys (1, 0), (1, 1) and (2, 0) repeat, only the first 30 values are
+  // nonzero so that small value types don't overflow
+  const size_t n = 20000;
+  Vector keys1(n);
+  Vector keys2(n);
+  Vector values(n, T(0));
+  for (size_t i = 0; i < n; ++i)
+  {
+    keys1[i] = T(1 + (i % 3 == 2));
+    keys2[i] = T(i % 3 == 1);
+  }
+  thrust::fill(values.begin(), values.begin() + 30, T(1));
+
+  Vector output_keys1(n);
+  Vector output_keys2(n);
+  Vector output_values(n);
+
+  size_t num_keys =
+    thrust::reduce_by_key_unsorted(
+      thrust::make_zip_iterator(thrust::make_tuple(keys1.begin(), keys2.begin())),
+      thrust::make_zip_iterator(thrust::make_tuple(keys1.end(), keys2.end())),
+      values.begin(),
+      thrust::make_zip_iterator(thrust::make_tuple(output_keys1.begin(), output_keys2.begin())),
+      output_values.begin())
+      .second
+    - output_values.begin();
+
+  ASSERT_EQUAL(num_keys, 3u);
+
+  // the order of the output is unspecified
+  output_keys1.resize(3);
+  output_keys2.resize(3);
+  output_values.resize(3);
+  thrust::sort_by_key(thrust::make_zip_iterator(thrust::make_tuple(output_keys1.begin(), output_keys2.begin())),
+                      thrust::make_zip_iterator(thrust::make_tuple(output_keys1.end(), output_keys2.end())),
+                      output_values.begin());
+
+  ASSERT_EQUAL(output_keys1[0], T(1));
+  ASSERT_EQUAL(output_keys2[0], T(0));
+  ASSERT_EQUAL(output_keys1[1], T(1));
+  ASSERT_EQUAL(output_keys2[1], T(1));
+  ASSERT_EQUAL(output_keys1[2], T(2));
+  ASSERT_EQUAL(output_keys2[2], T(0));
+
+  ASSERT_EQUAL(output_values[0], T(10));
+  ASSERT_EQUAL(output_values[1], T(10));
+  ASSERT_EQUAL(output_values[2], T(10));
+}
+DECLARE_VECTOR_UNITTEST(TestReduceByKeyUnsortedZippedKeys);
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  my_system& system,
+  InputIterator1,
+  InputIterator1,
+  InputIterator2,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  system.validate_dispatch();
+  return thrust::make_pair(keys_output, values_output);
+}
+
+void TestReduceByKeyUnsortedDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::reduce_by_key_unsorted(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestReduceByKeyUnsortedDispatchExplicit);
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  my_tag, InputIterator1, InputIterator1, InputIterator2, OutputIterator1 keys_output, OutputIterator2 values_output)
+{
+  *keys_output = 13;
+  return thrust::make_pair(keys_output, values_output);
+}
+
+void TestReduceByKeyUnsortedDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::reduce_by_key_unsorted(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestReduceByKeyUnsortedDispatchImplicit);
@@ -0,0 +1,366 @@
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/run_length.h>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  my_system& system, RandomAccessIterator, RandomAccessIterator, OutputIterator1 values, OutputIterator2 counts)
+{
+  system.validate_dispatch();
+  return thrust::make_pair(values, counts);
+}
+
+void TestRunLengthEncodeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::run_length_encode(sys, vec.begin(), vec.end(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestRunLengthEncodeDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2>
+run_length_encode(my_tag, RandomAccessIterator, RandomAccessIterator, OutputIterator1 values, OutputIterator2 counts)
+{
+  *values = 13;
+  return thrust::make_pair(values, counts);
+}
+
+void TestRunLengthEncodeDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::run_length_encode(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestRunLengthEncodeDispatchImplicit);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator run_length_decode(
+  my_system& system, RandomAccessIterator1, RandomAccessIterator1, RandomAccessIterator2, OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestRunLengthDecodeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::run_length_decode(sys, vec.begin(), vec.end(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestRunLengthDecodeDispatchExplicit);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator
+run_length_decode(my_tag, RandomAccessIterator1, RandomAccessIterator1, RandomAccessIterator2, OutputIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestRunLengthDecodeDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::run_length_decode(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestRunLengthDecodeDispatchImplicit);
+
+template <typename Vector>
+void TestRunLengthEncodeSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector input(8);
+  input[0] = T(7);
+  input[1] = T(7);
+  input[2] = T(1);
+  input[3] = T(3);
+  input[4] = T(3);
+  input[5] = T(3);
+  input[6] = T(7);
+  input[7] = T(4);
+
+  Vector values(8);
+  Vector counts(8);
+
+  thrust::pair<typename Vector::iterator, typename Vector::iterator> end =
+    thrust::run_length_encode(input.begin(), input.end(), values.begin(), counts.begin());
+
+  ASSERT_EQUAL(end.first - values.begin(), 5);
+  ASSERT_EQUAL(end.second - counts.begin(), 5);
+  ASSERT_EQUAL(values[0], T(7));
+  ASSERT_EQUAL(values[1], T(1));
+  ASSERT_EQUAL(values[2], T(3));
+  ASSERT_EQUAL(values[3], T(7));
+  ASSERT_EQUAL(values[4], T(4));
+  ASSERT_EQUAL(counts[0], T(2));
+  ASSERT_EQUAL(counts[1], T(1));
+  ASSERT_EQUAL(counts[2], T(3));
+  ASSERT_EQUAL(counts[3], T(1));
+  ASSERT_EQUAL(counts[4], T(1));
+
+  // only the runs of at least two elements
+  end = thrust::run_length_encode_non_trivial_runs(input.begin(), input.end(), values.begin(), counts.begin());
+
+  ASSERT_EQUAL(end.first - values.begin(), 2);
+  ASSERT_EQUAL(end.second - counts.begin(), 2);
+  ASSERT_EQUAL(values[0], T(0));
+  ASSERT_EQUAL(values[1], T(3));
+  ASSERT_EQUAL(counts[0], T(2));
+  ASSERT_EQUAL(counts[1], T(3));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestRunLengthEncodeSimple);
+
+template <typename Vector>
+void TestRunLengthDecodeSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector values(4);
+  values[0] = T(7);
+  values[1] = T(1);
+  values[2] = T(3);
+  values[3] = T(4);
+
+  // runs of length zero produce no output
+  Vector counts(4);
+  counts[0] = T(2);
+  counts[1] = T(0);
+  counts[2] = T(3);
+  counts[3] = T(1);
+
+  Vector output(6);
+
+  typename Vector::iterator end =
+    thrust::run_length_decode(values.begin(), values.end(), counts.begin(), output.begin());
+
+  ASSERT_EQUAL(end - output.begin(), 6);
+  ASSERT_EQUAL(output[0], T(7));
+  ASSERT_EQUAL(output[1], T(7));
+  ASSERT_EQUAL(output[2], T(3));
+  ASSERT_EQUAL(output[3], T(3));
+  ASSERT_EQUAL(output[4], T(3));
+  ASSERT_EQUAL(output[5], T(4));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestRunLengthDecodeSimple);
+
+void TestRunLengthEncodeEmpty()
+{
+  const int input[1] = {0};
+  int values[1]      = {13};
+  int counts[1]      = {13};
+
+  thrust::pair<int*, int*> end = thrust::run_length_encode(thrust::host, input, input, values, counts);
+
+  ASSERT_EQUAL(end.first == values, true);
+  ASSERT_EQUAL(end.second == counts, true);
+
+  end = thrust::run_length_encode_non_trivial_runs(thrust::host, input, input, values, counts);
+
+  ASSERT_EQUAL(end.first == values, true);
+  ASSERT_EQUAL(end.second == counts, true);
+
+  int* result = thrust::run_length_decode(thrust::host, values, values, counts, values);
+
+  ASSERT_EQUAL(result == values, true);
+  ASSERT_EQUAL(values[0], 13);
+}
+DECLARE_UNITTEST(TestRunLengthEncodeEmpty);
+
+// values in [0, 4), which repeat their predecessor most of the time, with one
+// long run in the middle
+template <typename T>
+thrust::host_vector<T> run_length_input(const size_t n)
+{
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<T> input(n);
+
+  for (size_t i = 0; i < n; i++)
+  {
+    if (n / 3 <= i && i < 2 * n / 3)
+    {
+      input[i] = T(5);
+    }
+    else if (i > 0 && random[i] % 4 != 0)
+    {
+      input[i] = input[i - 1];
+    }
+    else
+    {
+      input[i] = static_cast<T>(random[i] % 4);
+    }
+  }
+
+  return input;
+}
+
+template <typename T>
+void TestRunLengthEncode(const size_t n)
+{
+  thrust::host_vector<T> h_input   = run_length_input<T>(n);
+  thrust::device_vector<T> d_input = h_input;
+
+  // reference
+  thrust::host_vector<T> values;
+  thrust::host_vector<int> counts;
+  for (size_t i = 0; i < n; i++)
+  {
+    if (i == 0 || !(h_input[i - 1] == h_input[i]))
+    {
+      values.push_back(h_input[i]);
+      counts.push_back(0);
+    }
+    ++counts.back();
+  }
+
+  thrust::host_vector<T> h_values(n);
+  thrust::host_vector<int> h_counts(n);
+  thrust::device_vector<T> d_values(n);
+  thrust::device_vector<int> d_counts(n);
+
+  thrust::pair<typename thrust::host_vector<T>::iterator, thrust::host_vector<int>::iterator> h_end =
+    thrust::run_length_encode(h_input.begin(), h_input.end(), h_values.begin(), h_counts.begin());
+  thrust::pair<typename thrust::device_vector<T>::iterator, thrust::device_vector<int>::iterator> d_end =
+    thrust::run_length_encode(d_input.begin(), d_input.end(), d_values.begin(), d_counts.begin());
+
+  h_values.resize(h_end.first - h_values.begin());
+  h_counts.resize(h_end.second - h_counts.begin());
+  d_values.resize(d_end.first - d_values.begin());
+  d_counts.resize(d_end.second - d_counts.begin());
+
+  ASSERT_EQUAL(values, h_values);
+  ASSERT_EQUAL(counts, h_counts);
+  ASSERT_EQUAL(values, d_values);
+  ASSERT_EQUAL(counts, d_counts);
+}
+DECLARE_VARIABLE_UNITTEST(TestRunLengthEncode);
+
+template <typename T>
+void TestRunLengthEncodeNonTrivialRuns(const size_t n)
+{
+  thrust::host_vector<T> h_input   = run_length_input<T>(n);
+  thrust::device_vector<T> d_input = h_input;
+
+  // reference
+  thrust::host_vector<int> offsets;
+  thrust::host_vector<int> lengths;
+  for (size_t i = 0; i < n;)
+  {
+    size_t j = i + 1;
+    while (j < n && h_input[j] == h_input[i])
+    {
+      ++j;
+    }
+
+    if (j - i > 1)
+    {
+      offsets.push_back(static_cast<int>(i));
+      lengths.push_back(static_cast<int>(j - i));
+    }
+
+    i = j;
+  }
+
+  thrust::host_vector<int> h_offsets(n);
+  thrust::host_vector<int> h_lengths(n);
+  thrust::device_vector<int> d_offsets(n);
+  thrust::device_vector<int> d_lengths(n);
+
+  thrust::pair<thrust::host_vector<int>::iterator, thrust::host_vector<int>::iterator> h_end =
+    thrust::run_length_encode_non_trivial_runs(h_input.begin(), h_input.end(), h_offsets.begin(), h_lengths.begin());
+  thrust::pair<thrust::device_vector<int>::iterator, thrust::device_vector<int>::iterator> d_end =
+    thrust::run_length_encode_non_trivial_runs(d_input.begin(), d_input.end(), d_offsets.begin(), d_lengths.begin());
+
+  h_offsets.resize(h_end.first - h_offsets.begin());
+  h_lengths.resize(h_end.second - h_lengths.begin());
+  d_offsets.resize(d_end.first - d_offsets.begin());
+  d_lengths.resize(d_end.second - d_lengths.begin());
+
+  ASSERT_EQUAL(offsets, h_offsets);
+  ASSERT_EQUAL(lengths, h_lengths);
+  ASSERT_EQUAL(offsets, d_offsets);
+  ASSERT_EQUAL(lengths, d_lengths);
+}
+DECLARE_VARIABLE_UNITTEST(TestRunLengthEncodeNonTrivialRuns);
+
+template <typename T>
+void TestRunLengthDecode(const size_t n)
+{
+  thrust::host_vector<T> h_values = unittest::random_integers<T>(n);
+
+  // mostly short runs, some empty ones and one which is longer than all others together
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+  thrust::host_vector<int> h_counts(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    h_counts[i] = static_cast<int>(random[i] % 5);
+  }
+  if (n > 0)
+  {
+    h_counts[n / 2] = static_cast<int>(2 * n);
+  }
+
+  thrust::device_vector<T> d_values   = h_values;
+  thrust::device_vector<int> d_counts = h_counts;
+
+  // reference
+  thrust::host_vector<T> reference;
+  for (size_t i = 0; i < n; i++)
+  {
+    reference.insert(reference.end(), h_counts[i], h_values[i]);
+  }
+
+  thrust::host_vector<T> h_output(reference.size());
+  thrust::device_vector<T> d_output(reference.size());
+
+  typename thrust::host_vector<T>::iterator h_end =
+    thrust::run_length_decode(h_values.begin(), h_values.end(), h_counts.begin(), h_output.begin());
+  typename thrust::device_vector<T>::iterator d_end =
+    thrust::run_length_decode(d_values.begin(), d_values.end(), d_counts.begin(), d_output.begin());
+
+  ASSERT_EQUAL(h_end - h_output.begin(), static_cast<std::ptrdiff_t>(reference.size()));
+  ASSERT_EQUAL(d_end - d_output.begin(), static_cast<std::ptrdiff_t>(reference.size()));
+  ASSERT_EQUAL(reference, h_output);
+  ASSERT_EQUAL(reference, d_output);
+}
+DECLARE_VARIABLE_UNITTEST(TestRunLengthDecode);
+
+template <typename T>
+void TestRunLengthRoundTrip(const size_t n)
+{
+  thrust::device_vector<T> input = run_length_input<T>(n);
+
+  thrust::device_vector<T> values(n);
+  thrust::device_vector<int> counts(n);
+
+  thrust::pair<typename thrust::device_vector<T>::iterator, thrust::device_vector<int>::iterator> end =
+    thrust::run_length_encode(input.begin(), input.end(), values.begin(), counts.begin());
+
+  thrust::device_vector<T> output(n);
+
+  thrust::run_length_decode(values.begin(), end.first, counts.begin(), output.begin());
+
+  ASSERT_EQUAL(input, output);
+}
+DECLARE_VARIABLE_UNITTEST(TestRunLengthRoundTrip);
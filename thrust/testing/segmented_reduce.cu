@@ -0,0 +1,155 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/reduce.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  my_system& system, RandomAccessIterator, RandomAccessIterator, OffsetIterator, OffsetIterator, OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestSegmentedReduceDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_reduce(sys, vec.begin(), vec.end(), vec.begin(), vec.end(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedReduceDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  my_tag, RandomAccessIterator, RandomAccessIterator, OffsetIterator, OffsetIterator, OutputIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestSegmentedReduceDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_reduce(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedReduceDispatchImplicit);
+
+template <typename Vector>
+void TestSegmentedReduceSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(6);
+  v[0] = T(1);
+  v[1] = T(2);
+  v[2] = T(3);
+  v[3] = T(4);
+  v[4] = T(5);
+  v[5] = T(6);
+
+  thrust::device_vector<int> offsets(4);
+  offsets[0] = 0;
+  offsets[1] = 2;
+  offsets[2] = 2;
+  offsets[3] = 6;
+
+  Vector result(3);
+
+  typename Vector::iterator end =
+    thrust::segmented_reduce(v.begin(), v.end(), offsets.begin(), offsets.end(), result.begin());
+
+  ASSERT_EQUAL(end - result.begin(), 3);
+  ASSERT_EQUAL(result[0], T(3));
+  ASSERT_EQUAL(result[1], T(0));
+  ASSERT_EQUAL(result[2], T(18));
+
+  end = thrust::segmented_reduce(v.begin(), v.end(), offsets.begin(), offsets.end(), result.begin(), T(1));
+
+  ASSERT_EQUAL(end - result.begin(), 3);
+  ASSERT_EQUAL(result[0], T(4));
+  ASSERT_EQUAL(result[1], T(1));
+  ASSERT_EQUAL(result[2], T(19));
+
+  // the segments need not cover the whole input
+  end = thrust::segmented_reduce(
+    v.begin(), v.end(), offsets.begin() + 1, offsets.end(), result.begin(), T(0), thrust::maximum<T>());
+
+  ASSERT_EQUAL(end - result.begin(), 2);
+  ASSERT_EQUAL(result[0], T(0));
+  ASSERT_EQUAL(result[1], T(6));
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedReduceSimple);
+
+// offsets of segments of random sizes, many of them empty, with one segment
+// which holds half of the elements, and empty segments at the end. The first
+// and last n / 8 elements lie outside of all segments.
+inline thrust::host_vector<int> random_segment_offsets(const size_t n)
+{
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+
+  const int begin      = static_cast<int>(n / 8);
+  const int end        = static_cast<int>(n - n / 8);
+  const int large_size = static_cast<int>(n / 2);
+
+  thrust::host_vector<int> offsets(1, begin);
+
+  for (size_t i = 0; offsets.back() < end; i++)
+  {
+    const int size = i == 5 ? large_size : static_cast<int>(random[i % n] % 64) - 16;
+    offsets.push_back((std::min)(end, offsets.back() + (std::max)(0, size)));
+  }
+
+  offsets.push_back(end);
+  offsets.push_back(end);
+
+  return offsets;
+}
+
+template <typename T>
+void TestSegmentedReduce(const size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<int> h_offsets   = random_segment_offsets(n);
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  const size_t num_segments = h_offsets.size() - 1;
+
+  thrust::host_vector<T> reference(num_segments);
+  for (size_t i = 0; i < num_segments; i++)
+  {
+    T sum = T(1);
+    for (int j = h_offsets[i]; j < h_offsets[i + 1]; j++)
+    {
+      sum = sum + h_data[j];
+    }
+    reference[i] = sum;
+  }
+
+  thrust::host_vector<T> h_result(num_segments);
+  thrust::device_vector<T> d_result(num_segments);
+
+  thrust::segmented_reduce(
+    h_data.begin(), h_data.end(), h_offsets.begin(), h_offsets.end(), h_result.begin(), T(1));
+  thrust::segmented_reduce(
+    d_data.begin(), d_data.end(), d_offsets.begin(), d_offsets.end(), d_result.begin(), T(1));
+
+  ASSERT_EQUAL(reference, h_result);
+  ASSERT_EQUAL(reference, d_result);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedReduce);
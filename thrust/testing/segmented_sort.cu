@@ -0,0 +1,136 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator, typename OffsetIterator>
+void segmented_sort(my_system& system, RandomAccessIterator, RandomAccessIterator, OffsetIterator, OffsetIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestSegmentedSortDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::segmented_sort(sys, vec.begin(), vec.end(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OffsetIterator>
+void segmented_sort(my_tag, RandomAccessIterator first, RandomAccessIterator, OffsetIterator, OffsetIterator)
+{
+  *first = 13;
+}
+
+void TestSegmentedSortDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::segmented_sort(
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()),
+    thrust::retag<my_tag>(vec.begin()),
+    thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestSegmentedSortDispatchImplicit);
+
+template <typename Vector>
+void TestSegmentedSortSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(8);
+  v[0] = T(9);
+  v[1] = T(3);
+  v[2] = T(1);
+  v[3] = T(2);
+  v[4] = T(7);
+  v[5] = T(5);
+  v[6] = T(6);
+  v[7] = T(0);
+
+  // the first and the last element lie outside of all segments
+  thrust::device_vector<int> offsets(5);
+  offsets[0] = 1;
+  offsets[1] = 3;
+  offsets[2] = 3;
+  offsets[3] = 4;
+  offsets[4] = 7;
+
+  thrust::segmented_sort(v.begin(), v.end(), offsets.begin(), offsets.end());
+
+  ASSERT_EQUAL(v[0], T(9));
+  ASSERT_EQUAL(v[1], T(1));
+  ASSERT_EQUAL(v[2], T(3));
+  ASSERT_EQUAL(v[3], T(2));
+  ASSERT_EQUAL(v[4], T(5));
+  ASSERT_EQUAL(v[5], T(6));
+  ASSERT_EQUAL(v[6], T(7));
+  ASSERT_EQUAL(v[7], T(0));
+
+  thrust::segmented_sort(v.begin(), v.end(), offsets.begin(), offsets.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(v[0], T(9));
+  ASSERT_EQUAL(v[1], T(3));
+  ASSERT_EQUAL(v[2], T(1));
+  ASSERT_EQUAL(v[3], T(2));
+  ASSERT_EQUAL(v[4], T(7));
+  ASSERT_EQUAL(v[5], T(6));
+  ASSERT_EQUAL(v[6], T(5));
+  ASSERT_EQUAL(v[7], T(0));
+}
+DECLARE_VECTOR_UNITTEST(TestSegmentedSortSimple);
+
+// offsets of segments of random sizes, many of them empty, with one segment
+// which holds half of the elements. The first and last n / 8 elements lie
+// outside of all segments.
+inline thrust::host_vector<int> random_segment_offsets(const size_t n)
+{
+  thrust::host_vector<unsigned int> random = unittest::random_integers<unsigned int>(n);
+
+  const int begin      = static_cast<int>(n / 8);
+  const int end        = static_cast<int>(n - n / 8);
+  const int large_size = static_cast<int>(n / 2);
+
+  thrust::host_vector<int> offsets(1, begin);
+
+  for (size_t i = 0; offsets.back() < end; i++)
+  {
+    const int size = i == 5 ? large_size : static_cast<int>(random[i % n] % 64) - 16;
+    offsets.push_back((std::min)(end, offsets.back() + (std::max)(0, size)));
+  }
+
+  return offsets;
+}
+
+template <typename T>
+void TestSegmentedSort(const size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<int> h_offsets   = random_segment_offsets(n);
+  thrust::device_vector<int> d_offsets = h_offsets;
+
+  thrust::host_vector<T> reference = h_data;
+  for (size_t i = 0; i + 1 < h_offsets.size(); i++)
+  {
+    std::sort(reference.begin() + h_offsets[i], reference.begin() + h_offsets[i + 1]);
+  }
+
+  thrust::segmented_sort(h_data.begin(), h_data.end(), h_offsets.begin(), h_offsets.end());
+  thrust::segmented_sort(d_data.begin(), d_data.end(), d_offsets.begin(), d_offsets.end());
+
+  ASSERT_EQUAL(reference, h_data);
+  ASSERT_EQUAL(reference, d_data);
+}
+DECLARE_VARIABLE_UNITTEST(TestSegmentedSort);
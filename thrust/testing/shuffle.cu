@@ -5,6 +5,7 @@
 #include <thrust/sequence.h>
 #include <thrust/shuffle.h>
 #include <thrust/sort.h>
+#include <thrust/unique.h>
 
 #include <limits>
 #include <map>
@@ -442,6 +443,64 @@ void TestHostDeviceIdentical(size_t m)
 }
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
 
+template <typename Vector>
+void TestSampleSimple()
+{
+  typedef typename Vector::value_type T;
+
+  Vector data(10);
+  thrust::sequence(data.begin(), data.end(), T{});
+
+  Vector sampled(10, T(13));
+  thrust::default_random_engine g(2);
+  typename Vector::iterator end = thrust::sample(data.begin(), data.end(), sampled.begin(), 3, g);
+
+  ASSERT_EQUAL(end - sampled.begin(), 3);
+  ASSERT_EQUAL(sampled[3], T(13));
+
+  // the sample holds distinct elements of data
+  thrust::sort(sampled.begin(), end);
+  ASSERT_EQUAL(thrust::unique(sampled.begin(), end) == end, true);
+  ASSERT_EQUAL(sampled[2] < T(10), true);
+
+  // asking for more elements than there are selects all of them
+  end = thrust::sample(data.begin(), data.end(), sampled.begin(), 20, g);
+  ASSERT_EQUAL(end - sampled.begin(), 10);
+  thrust::sort(sampled.begin(), sampled.end());
+  ASSERT_EQUAL(sampled, data);
+
+  end = thrust::sample(data.begin(), data.end(), sampled.begin(), 0, g);
+  ASSERT_EQUAL(end == sampled.begin(), true);
+}
+DECLARE_VECTOR_UNITTEST(TestSampleSimple);
+
+template <typename T>
+void TestSampleIsPrefixOfShuffleCopy(size_t m)
+{
+  thrust::host_vector<T> h_data(m);
+  thrust::sequence(h_data.begin(), h_data.end(), T{});
+  thrust::device_vector<T> d_data = h_data;
+
+  const size_t k = m / 3;
+
+  thrust::host_vector<T> h_shuffled(m);
+  thrust::host_vector<T> h_sampled(k);
+  thrust::device_vector<T> d_sampled(k);
+
+  thrust::default_random_engine g(183);
+  thrust::shuffle_copy(h_data.begin(), h_data.end(), h_shuffled.begin(), g);
+  g.seed(183);
+  thrust::sample(h_data.begin(), h_data.end(), h_sampled.begin(), k, g);
+  g.seed(183);
+  thrust::sample(d_data.begin(), d_data.end(), d_sampled.begin(), k, g);
+
+  h_shuffled.resize(k);
+
+  ASSERT_EQUAL(h_shuffled, h_sampled);
+  ASSERT_EQUAL(h_shuffled, d_sampled);
+}
+DECLARE_VARIABLE_UNITTEST(TestSampleIsPrefixOfShuffleCopy);
+
 template <typename T>
 void TestFunctionIsBijection(size_t m)
 {
@@ -0,0 +1,297 @@
+#include <thrust/device_allocator.h>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/fill.h>
+#include <thrust/soa_vector.h>
+#include <thrust/sort.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include <unittest/unittest.h>
+
+typedef thrust::tuple<int, float, char> soa_tuple;
+
+template <typename Alloc>
+void CheckSoaVectorPushBack()
+{
+  thrust::soa_vector<soa_tuple, Alloc> v;
+
+  ASSERT_EQUAL(true, v.empty());
+  ASSERT_EQUAL(0lu, v.size());
+
+  for (int i = 0; i < 100; ++i)
+  {
+    v.push_back(thrust::make_tuple(i, 0.5f * i, char(i % 7)));
+  }
+
+  ASSERT_EQUAL(false, v.empty());
+  ASSERT_EQUAL(100lu, v.size());
+  ASSERT_EQUAL(true, v.capacity() >= 100lu);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ASSERT_EQUAL_QUIET(soa_tuple(i, 0.5f * i, char(i % 7)), soa_tuple(v[i]));
+  }
+
+  ASSERT_EQUAL_QUIET(soa_tuple(0, 0.0f, char(0)), soa_tuple(v.front()));
+  ASSERT_EQUAL_QUIET(soa_tuple(99, 49.5f, char(1)), soa_tuple(v.back()));
+
+  v.pop_back();
+
+  ASSERT_EQUAL(99lu, v.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(98, 49.0f, char(0)), soa_tuple(v.back()));
+
+  v.clear();
+
+  ASSERT_EQUAL(true, v.empty());
+}
+
+void TestSoaVectorPushBackHost()
+{
+  CheckSoaVectorPushBack<std::allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorPushBackHost);
+
+void TestSoaVectorPushBackDevice()
+{
+  CheckSoaVectorPushBack<thrust::device_allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorPushBackDevice);
+
+template <typename Alloc>
+void CheckSoaVectorResize()
+{
+  thrust::soa_vector<soa_tuple, Alloc> v(3, thrust::make_tuple(1, 2.0f, char(3)));
+
+  ASSERT_EQUAL(3lu, v.size());
+
+  v.resize(5);
+
+  ASSERT_EQUAL(5lu, v.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[2]));
+  ASSERT_EQUAL_QUIET(soa_tuple(0, 0.0f, char(0)), soa_tuple(v[3]));
+  ASSERT_EQUAL_QUIET(soa_tuple(0, 0.0f, char(0)), soa_tuple(v[4]));
+
+  v.resize(1000, thrust::make_tuple(4, 5.0f, char(6)));
+
+  ASSERT_EQUAL(1000lu, v.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[0]));
+  ASSERT_EQUAL_QUIET(soa_tuple(0, 0.0f, char(0)), soa_tuple(v[4]));
+  ASSERT_EQUAL_QUIET(soa_tuple(4, 5.0f, char(6)), soa_tuple(v[5]));
+  ASSERT_EQUAL_QUIET(soa_tuple(4, 5.0f, char(6)), soa_tuple(v[999]));
+
+  v.resize(2);
+
+  ASSERT_EQUAL(2lu, v.size());
+  ASSERT_EQUAL(true, v.capacity() >= 1000lu);
+
+  v.shrink_to_fit();
+
+  ASSERT_EQUAL(2lu, v.capacity());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[0]));
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[1]));
+
+  v.reserve(100);
+
+  ASSERT_EQUAL(100lu, v.capacity());
+  ASSERT_EQUAL(2lu, v.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[1]));
+}
+
+void TestSoaVectorResizeHost()
+{
+  CheckSoaVectorResize<std::allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorResizeHost);
+
+void TestSoaVectorResizeDevice()
+{
+  CheckSoaVectorResize<thrust::device_allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorResizeDevice);
+
+template <typename Alloc>
+void CheckSoaVectorColumns()
+{
+  typedef thrust::soa_vector<soa_tuple, Alloc> Vector;
+
+  for (std::size_t n : {1, 3, 17, 64, 1000})
+  {
+    Vector v(n);
+
+    const std::uintptr_t column0 = reinterpret_cast<std::uintptr_t>(thrust::raw_pointer_cast(v.template column<0>()));
+    const std::uintptr_t column1 = reinterpret_cast<std::uintptr_t>(thrust::raw_pointer_cast(v.template column<1>()));
+    const std::uintptr_t column2 = reinterpret_cast<std::uintptr_t>(thrust::raw_pointer_cast(v.template column<2>()));
+
+    // every column is aligned and the columns don't overlap
+    ASSERT_EQUAL(0lu, column0 % Vector::column_alignment);
+    ASSERT_EQUAL(0lu, column1 % Vector::column_alignment);
+    ASSERT_EQUAL(0lu, column2 % Vector::column_alignment);
+    ASSERT_EQUAL(true, column0 + n * sizeof(int) <= column1);
+    ASSERT_EQUAL(true, column1 + n * sizeof(float) <= column2);
+
+    // the columns are the members of the elements
+    thrust::sequence(v.template column<0>(), v.template column<0>() + n);
+    thrust::fill(v.template column<1>(), v.template column<1>() + n, 1.5f);
+
+    ASSERT_EQUAL_QUIET(soa_tuple(0, 1.5f, char(0)), soa_tuple(v[0]));
+    ASSERT_EQUAL_QUIET(soa_tuple(int(n - 1), 1.5f, char(0)), soa_tuple(v[n - 1]));
+  }
+}
+
+void TestSoaVectorColumnsHost()
+{
+  CheckSoaVectorColumns<std::allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorColumnsHost);
+
+void TestSoaVectorColumnsDevice()
+{
+  CheckSoaVectorColumns<thrust::device_allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorColumnsDevice);
+
+template <typename Alloc>
+void CheckSoaVectorCopy()
+{
+  typedef thrust::soa_vector<soa_tuple, Alloc> Vector;
+
+  Vector v;
+  for (int i = 0; i < 10; ++i)
+  {
+    v.push_back(thrust::make_tuple(i, 1.0f * i, char(i)));
+  }
+
+  Vector copy(v);
+
+  ASSERT_EQUAL(10lu, copy.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(7, 7.0f, char(7)), soa_tuple(copy[7]));
+
+  // the copy owns its elements
+  copy[7] = thrust::make_tuple(1, 2.0f, char(3));
+
+  ASSERT_EQUAL_QUIET(soa_tuple(7, 7.0f, char(7)), soa_tuple(v[7]));
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(copy[7]));
+
+  Vector assigned(3);
+  assigned = copy;
+
+  ASSERT_EQUAL(10lu, assigned.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(assigned[7]));
+
+  Vector moved(std::move(copy));
+
+  ASSERT_EQUAL(10lu, moved.size());
+  ASSERT_EQUAL(0lu, copy.size());
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(moved[7]));
+
+  moved.swap(v);
+
+  ASSERT_EQUAL_QUIET(soa_tuple(7, 7.0f, char(7)), soa_tuple(moved[7]));
+  ASSERT_EQUAL_QUIET(soa_tuple(1, 2.0f, char(3)), soa_tuple(v[7]));
+}
+
+void TestSoaVectorCopyHost()
+{
+  CheckSoaVectorCopy<std::allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorCopyHost);
+
+void TestSoaVectorCopyDevice()
+{
+  CheckSoaVectorCopy<thrust::device_allocator<unsigned char>>();
+}
+DECLARE_UNITTEST(TestSoaVectorCopyDevice);
+
+struct soa_counted
+{
+  static int live;
+
+  soa_counted()
+  {
+    ++live;
+  }
+
+  soa_counted(const soa_counted&)
+  {
+    ++live;
+  }
+
+  ~soa_counted()
+  {
+    --live;
+  }
+};
+
+int soa_counted::live = 0;
+
+struct soa_throwing
+{
+  static int copies_left;
+
+  soa_throwing() {}
+
+  soa_throwing(const soa_throwing&)
+  {
+    if (copies_left-- == 0)
+    {
+      throw std::runtime_error("soa_throwing");
+    }
+  }
+};
+
+int soa_throwing::copies_left = 0;
+
+void TestSoaVectorCopyThrows()
+{
+  typedef thrust::soa_vector<thrust::tuple<soa_counted, soa_throwing>, std::allocator<unsigned char>> vector_t;
+
+  {
+    vector_t v(4);
+    ASSERT_EQUAL(4, soa_counted::live);
+
+    // the first column is copied completely before the second one throws, and
+    // has to be destroyed again
+    soa_throwing::copies_left = 0;
+    ASSERT_THROWS(v.reserve(100), std::runtime_error);
+    ASSERT_EQUAL(4, soa_counted::live);
+    ASSERT_EQUAL(4lu, v.size());
+
+    soa_throwing::copies_left = 0;
+    ASSERT_THROWS(vector_t copy(v), std::runtime_error);
+    ASSERT_EQUAL(4, soa_counted::live);
+
+    soa_throwing::copies_left = 4;
+    v.reserve(100);
+    ASSERT_EQUAL(4, soa_counted::live);
+    ASSERT_EQUAL(true, v.capacity() >= 100lu);
+  }
+
+  ASSERT_EQUAL(0, soa_counted::live);
+}
+DECLARE_UNITTEST(TestSoaVectorCopyThrows);
+
+template <typename T>
+void TestSoaVectorSort(const size_t n)
+{
+  thrust::host_vector<T> h_keys   = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_values = unittest::random_integers<T>(n);
+
+  thrust::soa_vector<thrust::tuple<T, T>, thrust::device_allocator<unsigned char>> v(n);
+  thrust::copy(thrust::make_zip_iterator(h_keys.begin(), h_values.begin()),
+               thrust::make_zip_iterator(h_keys.end(), h_values.end()),
+               v.begin());
+
+  thrust::sort(thrust::make_zip_iterator(h_keys.begin(), h_values.begin()),
+               thrust::make_zip_iterator(h_keys.end(), h_values.end()));
+  thrust::sort(v.begin(), v.end());
+
+  thrust::device_vector<T> d_keys(v.template column<0>(), v.template column<0>() + n);
+  thrust::device_vector<T> d_values(v.template column<1>(), v.template column<1>() + n);
+
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestSoaVectorSort);
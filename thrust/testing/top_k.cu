@@ -0,0 +1,114 @@
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+template <typename InputIterator, typename Size, typename RandomAccessIterator>
+RandomAccessIterator top_k(my_system& system, InputIterator, InputIterator, Size, RandomAccessIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestTopKDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::top_k(sys, vec.begin(), vec.end(), 1, vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestTopKDispatchExplicit);
+
+template <typename InputIterator, typename Size, typename RandomAccessIterator>
+RandomAccessIterator top_k(my_tag, InputIterator, InputIterator, Size, RandomAccessIterator result)
+{
+  *result = 13;
+  return result;
+}
+
+void TestTopKDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::top_k(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()), 1, thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestTopKDispatchImplicit);
+
+template <typename Vector>
+void TestTopKSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(7);
+  v[0] = T(5);
+  v[1] = T(1);
+  v[2] = T(6);
+  v[3] = T(3);
+  v[4] = T(7);
+  v[5] = T(2);
+  v[6] = T(4);
+
+  Vector result(3);
+
+  typename Vector::iterator end = thrust::top_k(v.begin(), v.end(), 3, result.begin());
+
+  ASSERT_EQUAL(end - result.begin(), 3);
+  ASSERT_EQUAL(result[0], T(7));
+  ASSERT_EQUAL(result[1], T(6));
+  ASSERT_EQUAL(result[2], T(5));
+
+  end = thrust::top_k(v.begin(), v.end(), 2, result.begin(), thrust::less<T>());
+
+  ASSERT_EQUAL(end - result.begin(), 2);
+  ASSERT_EQUAL(result[0], T(1));
+  ASSERT_EQUAL(result[1], T(2));
+
+  // k larger than the input selects all of it
+  end = thrust::top_k(v.begin(), v.begin() + 2, 3, result.begin());
+
+  ASSERT_EQUAL(end - result.begin(), 2);
+  ASSERT_EQUAL(result[0], T(5));
+  ASSERT_EQUAL(result[1], T(1));
+}
+DECLARE_VECTOR_UNITTEST(TestTopKSimple);
+
+template <typename T>
+void TestTopK(const size_t n)
+{
+  thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> sorted = h_data;
+  std::sort(sorted.begin(), sorted.end(), thrust::greater<T>());
+
+  const size_t sizes[3] = {1, 1000, n / 3};
+
+  for (int i = 0; i < 3; i++)
+  {
+    const size_t k = sizes[i];
+    const size_t m = (std::min)(n, k);
+
+    thrust::host_vector<T> h_result(k);
+    thrust::device_vector<T> d_result(k);
+
+    typename thrust::host_vector<T>::iterator h_end = thrust::top_k(h_data.begin(), h_data.end(), k, h_result.begin());
+    typename thrust::device_vector<T>::iterator d_end =
+      thrust::top_k(d_data.begin(), d_data.end(), k, d_result.begin());
+
+    thrust::host_vector<T> reference(sorted.begin(), sorted.begin() + m);
+
+    ASSERT_EQUAL(size_t(h_end - h_result.begin()), m);
+    ASSERT_EQUAL(size_t(d_end - d_result.begin()), m);
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(h_result.begin(), h_end));
+    ASSERT_EQUAL(reference, thrust::host_vector<T>(d_result.begin(), d_end));
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestTopK);
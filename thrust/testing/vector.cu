@@ -373,6 +373,78 @@ void TestVectorWithInitialValue(void)
 }
 DECLARE_VECTOR_UNITTEST(TestVectorWithInitialValue);
 
+template <class Vector>
+void TestVectorDefaultInit(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector v(3, thrust::default_init);
+  ASSERT_EQUAL(v.size(), 3lu);
+
+  thrust::sequence(v.begin(), v.end());
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+  ASSERT_EQUAL(v[2], T(2));
+
+  // the elements added by default_init growth have indeterminate values (for
+  // trivially constructible T), so only the retained ones are checked
+  v.resize(1);
+  v.resize(3, thrust::default_init);
+  ASSERT_EQUAL(v.size(), 3lu);
+  ASSERT_EQUAL(v[0], T(0));
+
+  v[1] = T(1);
+  v[2] = T(2);
+  v.resize(100, thrust::default_init);
+  ASSERT_EQUAL(v.size(), 100lu);
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+  ASSERT_EQUAL(v[2], T(2));
+
+  v[99] = T(99);
+  ASSERT_EQUAL(v[99], T(99));
+
+  v.resize(2, thrust::default_init);
+  ASSERT_EQUAL(v.size(), 2lu);
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+
+  Vector empty(0, thrust::default_init);
+  ASSERT_EQUAL(empty.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorDefaultInit);
+
+struct default_init_non_trivial
+{
+  int value;
+
+  _CCCL_HOST_DEVICE default_init_non_trivial()
+      : value(42)
+  {}
+};
+
+template <class Vector>
+void TestVectorDefaultInitNonTrivial(void)
+{
+  Vector v(3, thrust::default_init);
+  ASSERT_EQUAL(default_init_non_trivial(v[2]).value, 42);
+
+  v.resize(10, thrust::default_init);
+  ASSERT_EQUAL(default_init_non_trivial(v[9]).value, 42);
+}
+
+void TestVectorDefaultInitNonTrivialHost(void)
+{
+  TestVectorDefaultInitNonTrivial<thrust::host_vector<default_init_non_trivial>>();
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNonTrivialHost);
+
+void TestVectorDefaultInitNonTrivialDevice(void)
+{
+  TestVectorDefaultInitNonTrivial<thrust::device_vector<default_init_non_trivial>>();
+}
+DECLARE_UNITTEST(TestVectorDefaultInitNonTrivialDevice);
+
 template <class Vector>
 void TestVectorSwap(void)
 {
@@ -0,0 +1,124 @@
+// Only the vector headers of the host systems may come before the checks in this file; the
+// other thrust headers could bring the systems' algorithms along and hide a missing include.
+#include <thrust/system/omp/vector.h>
+
+// TBB is only linked into the tests of TBB targets
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB || THRUST_HOST_SYSTEM == THRUST_HOST_SYSTEM_TBB
+#  define THRUST_TEST_HAS_TBB
+#  include <thrust/system/tbb/vector.h>
+#endif
+
+#include <cstddef>
+#include <new>
+
+#include <unittest/unittest.h>
+
+// Systems which derive from omp's and tbb's execution policies, and take over for_each. Their
+// parallel copy reaches for_each through the generic copy and transform, while the sequential
+// copy they would otherwise inherit from cpp never calls it.
+static int probe_for_each_calls = 0;
+
+template <template <typename> class SystemPolicy>
+struct probe_system : SystemPolicy<probe_system<SystemPolicy>>
+{};
+
+template <template <typename> class SystemPolicy, typename InputIterator, typename UnaryFunction>
+InputIterator for_each(probe_system<SystemPolicy>&, InputIterator first, InputIterator last, UnaryFunction f)
+{
+  ++probe_for_each_calls;
+  for (; first != last; ++first)
+  {
+    f(*first);
+  }
+  return first;
+}
+
+template <typename T, typename System>
+struct probe_allocator
+{
+  typedef T value_type;
+  typedef thrust::pointer<T, System, T&> pointer;
+  typedef thrust::pointer<const T, System, const T&> const_pointer;
+
+  template <typename U>
+  struct rebind
+  {
+    typedef probe_allocator<U, System> other;
+  };
+
+  probe_allocator() {}
+
+  template <typename U>
+  probe_allocator(const probe_allocator<U, System>&)
+  {}
+
+  pointer allocate(std::size_t n)
+  {
+    return pointer(static_cast<T*>(::operator new(n * sizeof(T))));
+  }
+
+  void deallocate(pointer p, std::size_t)
+  {
+    ::operator delete(p.get());
+  }
+
+  bool operator==(const probe_allocator&) const
+  {
+    return true;
+  }
+
+  bool operator!=(const probe_allocator&) const
+  {
+    return false;
+  }
+};
+
+template <typename Vector>
+void TestVectorRelocationDispatch(bool expect_system_copy)
+{
+  Vector v(10);
+  int* raw = thrust::raw_pointer_cast(v.data());
+  for (int i = 0; i < 10; ++i)
+  {
+    raw[i] = i;
+  }
+
+  probe_for_each_calls = 0;
+  Vector copy(v);
+  ASSERT_EQUAL(probe_for_each_calls > 0, expect_system_copy);
+  ASSERT_EQUAL(thrust::raw_pointer_cast(copy.data())[9], 9);
+
+  probe_for_each_calls = 0;
+  v.reserve(100);
+  ASSERT_EQUAL(probe_for_each_calls > 0, expect_system_copy);
+  ASSERT_EQUAL(thrust::raw_pointer_cast(v.data())[9], 9);
+
+  // an insert beyond the capacity relocates the elements, and copies the new ones in
+  v.shrink_to_fit();
+  probe_for_each_calls = 0;
+  v.insert(v.begin() + 5, copy.begin(), copy.end());
+  ASSERT_EQUAL(probe_for_each_calls > 0, expect_system_copy);
+  ASSERT_EQUAL(v.size(), 20u);
+  ASSERT_EQUAL(thrust::raw_pointer_cast(v.data())[5], 0);
+  ASSERT_EQUAL(thrust::raw_pointer_cast(v.data())[19], 9);
+}
+
+void TestOmpVectorRelocationDispatch()
+{
+  typedef probe_system<thrust::system::omp::detail::execution_policy> system;
+
+  // without OpenMP the vector sticks to the sequential algorithms
+  TestVectorRelocationDispatch<thrust::omp::vector<int, probe_allocator<int, system>>>(
+    THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE);
+}
+DECLARE_UNITTEST(TestOmpVectorRelocationDispatch);
+
+#ifdef THRUST_TEST_HAS_TBB
+void TestTbbVectorRelocationDispatch()
+{
+  typedef probe_system<thrust::system::tbb::detail::execution_policy> system;
+
+  TestVectorRelocationDispatch<thrust::tbb::vector<int, probe_allocator<int, system>>>(true);
+}
+DECLARE_UNITTEST(TestTbbVectorRelocationDispatch);
+#endif
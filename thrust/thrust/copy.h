@@ -231,6 +231,140 @@ OutputIterator copy(InputIterator first, InputIterator last, OutputIterator resu
 template <typename InputIterator, typename Size, typename OutputIterator>
 OutputIterator copy_n(InputIterator first, Size n, OutputIterator result);
 
+/*! \p copy_batched copies a batch of \p num_buffers ranges at once. For every
+ *  \c i from \c 0 to \p num_buffers, it copies the range
+ *  <tt>[input_buffers[i], input_buffers[i] + sizes[i])</tt> to the range
+ *  <tt>[output_buffers[i], output_buffers[i] + sizes[i])</tt>, as if by
+ *  <tt>thrust::copy_n(input_buffers[i], sizes[i], output_buffers[i])</tt>.
+ *
+ *  Unlike a loop of calls to \p copy_n, the work is divided by the number of
+ *  elements rather than by the number of ranges: large ranges are split among
+ *  several threads and many small ranges are copied by the same one, so a batch
+ *  of many small ranges pays for a single dispatch.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param input_buffers The beginning of the sequence of the beginnings of the ranges to copy.
+ *  \param output_buffers The beginning of the sequence of the beginnings of the destination ranges.
+ *  \param sizes The beginning of the sequence of the numbers of elements to copy.
+ *  \param num_buffers The number of ranges to copy.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputBufferIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ * InputBufferIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputBufferIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ * OutputBufferIterator's \c value_type is a mutable random access iterator to whose \c value_type the elements of the
+ * input ranges are convertible.
+ *  \tparam SizeIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> with an
+ * integral \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre No destination range shall overlap any input range or any other destination range.
+ *
+ *  The following code snippet demonstrates how to use \p copy_batched to copy
+ *  three ranges using the \p thrust::host execution policy:
+ *
+ *  \code
+ *  #include <thrust/copy.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int a[2] = {1, 2};
+ *  int b[3] = {3, 4, 5};
+ *  int c[1] = {6};
+ *  int x[2], y[3], z[1];
+ *
+ *  const int* input_buffers[3] = {a, b, c};
+ *  int* output_buffers[3]      = {x, y, z};
+ *  int sizes[3]                = {2, 3, 1};
+ *
+ *  thrust::copy_batched(thrust::host, input_buffers, output_buffers, sizes, 3);
+ *
+ *  // x is now {1, 2}, y is now {3, 4, 5} and z is now {6}
+ *  \endcode
+ *
+ *  \see copy_n
+ */
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void copy_batched(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size num_buffers);
+
+/*! \p copy_batched copies a batch of \p num_buffers ranges at once. For every
+ *  \c i from \c 0 to \p num_buffers, it copies the range
+ *  <tt>[input_buffers[i], input_buffers[i] + sizes[i])</tt> to the range
+ *  <tt>[output_buffers[i], output_buffers[i] + sizes[i])</tt>, as if by
+ *  <tt>thrust::copy_n(input_buffers[i], sizes[i], output_buffers[i])</tt>.
+ *
+ *  Unlike a loop of calls to \p copy_n, the work is divided by the number of
+ *  elements rather than by the number of ranges: large ranges are split among
+ *  several threads and many small ranges are copied by the same one, so a batch
+ *  of many small ranges pays for a single dispatch.
+ *
+ *  \param input_buffers The beginning of the sequence of the beginnings of the ranges to copy.
+ *  \param output_buffers The beginning of the sequence of the beginnings of the destination ranges.
+ *  \param sizes The beginning of the sequence of the numbers of elements to copy.
+ *  \param num_buffers The number of ranges to copy.
+ *
+ *  \tparam InputBufferIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ * InputBufferIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputBufferIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and \c
+ * OutputBufferIterator's \c value_type is a mutable random access iterator to whose \c value_type the elements of the
+ * input ranges are convertible.
+ *  \tparam SizeIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> with an
+ * integral \c value_type.
+ *  \tparam Size is an integral type.
+ *
+ *  \pre No destination range shall overlap any input range or any other destination range.
+ *
+ *  The following code snippet demonstrates how to use \p copy_batched to copy
+ *  the columns of a matrix which are stored in separate vectors:
+ *
+ *  \code
+ *  #include <thrust/copy.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<float> columns[4];
+ *  thrust::host_vector<float> copies[4];
+ *  ...
+ *  thrust::host_vector<const float*> input_buffers(4);
+ *  thrust::host_vector<float*> output_buffers(4);
+ *  thrust::host_vector<size_t> sizes(4);
+ *
+ *  for (int i = 0; i < 4; ++i)
+ *  {
+ *    copies[i].resize(columns[i].size());
+ *    input_buffers[i]  = columns[i].data();
+ *    output_buffers[i] = copies[i].data();
+ *    sizes[i]          = columns[i].size();
+ *  }
+ *
+ *  thrust::copy_batched(input_buffers.begin(), output_buffers.begin(), sizes.begin(), 4);
+ *
+ *  // every copies[i] is now a copy of columns[i]
+ *  \endcode
+ *
+ *  \see copy_n
+ */
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void copy_batched(
+  InputBufferIterator input_buffers, OutputBufferIterator output_buffers, SizeIterator sizes, Size num_buffers);
+
 /*! \} // end copying
  */
 
@@ -503,4 +637,5 @@ copy_if(InputIterator1 first, InputIterator1 last, InputIterator2 stencil, Outpu
 THRUST_NAMESPACE_END
 
 #include <thrust/detail/copy.h>
+#include <thrust/detail/copy_batched.h>
 #include <thrust/detail/copy_if.h>
@@ -33,6 +33,9 @@ namespace detail
 template <typename Allocator, typename Pointer, typename Size>
 _CCCL_HOST_DEVICE inline void default_construct_range(Allocator& a, Pointer p, Size n);
 
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE inline void default_init_range(Allocator& a, Pointer p, Size n);
+
 } // namespace detail
 THRUST_NAMESPACE_END
 
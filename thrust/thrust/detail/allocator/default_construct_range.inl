@@ -85,6 +85,22 @@ default_construct_range(Allocator& a, Pointer p, Size n)
   thrust::uninitialized_fill_n(allocator_system<Allocator>::get(a), p, n, typename pointer_element<Pointer>::type());
 }
 
+// default initialization of elements which would not be constructed via the
+// allocator leaves them uninitialized
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE typename enable_if<
+  needs_default_construct_via_allocator<Allocator, typename pointer_element<Pointer>::type>::value>::type
+default_init_range(Allocator& a, Pointer p, Size n)
+{
+  allocator_traits_detail::default_construct_range(a, p, n);
+}
+
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE typename disable_if<
+  needs_default_construct_via_allocator<Allocator, typename pointer_element<Pointer>::type>::value>::type
+default_init_range(Allocator&, Pointer, Size)
+{}
+
 } // namespace allocator_traits_detail
 
 template <typename Allocator, typename Pointer, typename Size>
@@ -93,5 +109,11 @@ _CCCL_HOST_DEVICE void default_construct_range(Allocator& a, Pointer p, Size n)
   return allocator_traits_detail::default_construct_range(a, p, n);
 }
 
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void default_init_range(Allocator& a, Pointer p, Size n)
+{
+  return allocator_traits_detail::default_init_range(a, p, n);
+}
+
 } // namespace detail
 THRUST_NAMESPACE_END
@@ -104,6 +104,10 @@ public:
 
   _CCCL_HOST_DEVICE void default_construct_n(iterator first, size_type n);
 
+  // like default_construct_n, but leaves trivially constructible elements
+  // uninitialized
+  _CCCL_HOST_DEVICE void default_init_n(iterator first, size_type n);
+
   _CCCL_HOST_DEVICE void uninitialized_fill_n(iterator first, size_type n, const value_type& value);
 
   template <typename InputIterator>
@@ -208,6 +208,12 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::default_construct_n(iterato
   default_construct_range(m_allocator, first.base(), n);
 } // end contiguous_storage::default_construct_n()
 
+template <typename T, typename Alloc>
+_CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::default_init_n(iterator first, size_type n)
+{
+  default_init_range(m_allocator, first.base(), n);
+} // end contiguous_storage::default_init_n()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void
 contiguous_storage<T, Alloc>::uninitialized_fill_n(iterator first, size_type n, const value_type& x)
@@ -0,0 +1,72 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/copy_batched.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/adl/copy_batched.h>
+#include <thrust/system/detail/generic/copy_batched.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void copy_batched(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size num_buffers)
+{
+  using thrust::system::detail::generic::copy_batched;
+  return copy_batched(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), input_buffers, output_buffers, sizes, num_buffers);
+} // end copy_batched()
+
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+void copy_batched(
+  InputBufferIterator input_buffers, OutputBufferIterator output_buffers, SizeIterator sizes, Size num_buffers)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputBufferIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputBufferIterator>::type System2;
+  typedef typename thrust::iterator_system<SizeIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::copy_batched(
+    select_system(system1, system2, system3), input_buffers, output_buffers, sizes, num_buffers);
+} // end copy_batched()
+
+THRUST_NAMESPACE_END
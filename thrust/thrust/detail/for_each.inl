@@ -77,4 +77,17 @@ InputIterator for_each_n(InputIterator first, Size n, UnaryFunction f)
   return thrust::for_each_n(select_system(system), first, n, f);
 } // end for_each_n()
 
+#if _CCCL_STD_VER >= 2014
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+_CCCL_HOST_DEVICE void for_each_index(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                      const ::cuda::std::extents<IndexType, Extents...>& extents,
+                                      Function f)
+{
+  using thrust::system::detail::generic::for_each_index;
+
+  for_each_index(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), extents, f);
+} // end for_each_index()
+#endif // _CCCL_STD_VER >= 2014
+
 THRUST_NAMESPACE_END
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/adl/histogram.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using thrust::system::detail::generic::histogram_even;
+  return histogram_even(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    histogram,
+    num_levels,
+    lower_level,
+    upper_level);
+} // end histogram_even()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  using thrust::system::detail::generic::histogram_range;
+  return histogram_range(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    histogram,
+    levels_first,
+    levels_last);
+} // end histogram_range()
+
+template <typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::histogram_even(
+    select_system(system1, system2), first, last, histogram, num_levels, lower_level, upper_level);
+} // end histogram_even()
+
+template <typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::histogram_range(
+    select_system(system1, system2, system3), first, last, histogram, levels_first, levels_last);
+} // end histogram_range()
+
+THRUST_NAMESPACE_END
@@ -148,6 +148,190 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
     binary_op);
 } // end reduce_by_key()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  using thrust::system::detail::generic::reduce_by_key_unsorted;
+  return reduce_by_key_unsorted(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output);
+} // end reduce_by_key_unsorted()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::reduce_by_key_unsorted;
+  return reduce_by_key_unsorted(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred);
+} // end reduce_by_key_unsorted()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::reduce_by_key_unsorted;
+  return reduce_by_key_unsorted(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op);
+} // end reduce_by_key_unsorted()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::reduce_by_key_unsorted;
+  return reduce_by_key_unsorted(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op,
+    comp);
+} // end reduce_by_key_unsorted()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, offsets_first, offsets_last, result);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    offsets_first,
+    offsets_last,
+    result,
+    init);
+} // end segmented_reduce()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::segmented_reduce;
+  return segmented_reduce(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    offsets_first,
+    offsets_last,
+    result,
+    init,
+    binary_op);
+} // end segmented_reduce()
+
 template <typename InputIterator>
 typename thrust::iterator_traits<InputIterator>::value_type reduce(InputIterator first, InputIterator last)
 {
@@ -281,4 +465,223 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
     binary_op);
 }
 
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unsorted(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output);
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unsorted(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred);
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unsorted(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op);
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System3;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::reduce_by_key_unsorted(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op,
+    comp);
+}
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OffsetIterator>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2, system3), first, last, offsets_first, offsets_last, result);
+} // end segmented_reduce()
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator, typename T>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OffsetIterator>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2, system3), first, last, offsets_first, offsets_last, result, init);
+} // end segmented_reduce()
+
+template <typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OffsetIterator>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::segmented_reduce(
+    select_system(system1, system2, system3), first, last, offsets_first, offsets_last, result, init, binary_op);
+} // end segmented_reduce()
+
 THRUST_NAMESPACE_END
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/run_length.h>
+#include <thrust/system/detail/adl/run_length.h>
+#include <thrust/system/detail/generic/run_length.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output)
+{
+  using thrust::system::detail::generic::run_length_encode;
+  return run_length_encode(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_output, counts_output);
+} // end run_length_encode()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  using thrust::system::detail::generic::run_length_encode_non_trivial_runs;
+  return run_length_encode_non_trivial_runs(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, offsets_output, lengths_output);
+} // end run_length_encode_non_trivial_runs()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator run_length_decode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  using thrust::system::detail::generic::run_length_decode;
+  return run_length_decode(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), values_first, values_last, counts_first, result);
+} // end run_length_decode()
+
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  RandomAccessIterator first, RandomAccessIterator last, OutputIterator1 values_output, OutputIterator2 counts_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode(select_system(system1, system2, system3), first, last, values_output, counts_output);
+} // end run_length_encode()
+
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  RandomAccessIterator first, RandomAccessIterator last, OutputIterator1 offsets_output, OutputIterator2 lengths_output)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator1>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator2>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_encode_non_trivial_runs(
+    select_system(system1, system2, system3), first, last, offsets_output, lengths_output);
+} // end run_length_encode_non_trivial_runs()
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator run_length_decode(
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+  typedef typename thrust::iterator_system<OutputIterator>::type System3;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+
+  return thrust::run_length_decode(
+    select_system(system1, system2, system3), values_first, values_last, counts_first, result);
+} // end run_length_decode()
+
+THRUST_NAMESPACE_END
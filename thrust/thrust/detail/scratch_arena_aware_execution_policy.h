@@ -0,0 +1,58 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/tls_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace detail
+{
+
+// host systems only: the arena hands out memory from operator new
+template <template <typename> class ExecutionPolicyCRTPBase>
+struct scratch_arena_aware_execution_policy
+{
+  typedef thrust::mr::tls_arena_resource<thrust::mr::new_delete_resource> scratch_arena_resource;
+
+  typedef thrust::mr::allocator<thrust::detail::max_align_t, scratch_arena_resource> scratch_arena_allocator;
+  typedef thrust::detail::execute_with_allocator<scratch_arena_allocator, ExecutionPolicyCRTPBase> scratch_arena_policy;
+
+  // temporary storage of the algorithms is taken from an arena of the calling thread, which is reused from its start
+  // every time all of it has been returned, i.e. typically at the end of each algorithm; a thread keeps its arena's
+  // memory until it exits or calls thrust::mr::release_tls_arena<thrust::mr::new_delete_resource>()
+  _CCCL_HOST scratch_arena_policy with_scratch_arena() const
+  {
+    return scratch_arena_policy(thrust::mr::get_global_resource<scratch_arena_resource>());
+  }
+};
+
+} // end namespace detail
+
+THRUST_NAMESPACE_END
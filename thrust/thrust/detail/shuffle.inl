@@ -28,6 +28,7 @@
 #include <thrust/detail/cpp11_required.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
 
@@ -80,4 +81,33 @@ _CCCL_HOST_DEVICE void shuffle_copy(RandomIterator first, RandomIterator last, O
   return thrust::shuffle_copy(select_system(system1, system2), first, last, result, g);
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator sample(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g)
+{
+  using thrust::system::detail::generic::sample;
+  return sample(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, k, g);
+}
+
+template <typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator
+sample(RandomIterator first, RandomIterator last, OutputIterator result, Size k, URBG&& g)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomIterator>::type System1;
+  typedef typename thrust::iterator_system<OutputIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::sample(select_system(system1, system2), first, last, result, k, g);
+}
+
 THRUST_NAMESPACE_END
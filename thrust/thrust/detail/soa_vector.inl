@@ -0,0 +1,612 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator/copy_construct_range.h>
+#include <thrust/detail/allocator/default_construct_range.h>
+#include <thrust/detail/allocator/destroy_range.h>
+#include <thrust/detail/allocator/fill_construct_range.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/soa_vector.h>
+#include <thrust/swap.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+template <typename... Ts, typename Alloc>
+constexpr typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type
+  soa_vector<thrust::tuple<Ts...>, Alloc>::column_alignment;
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::soa_vector(const Alloc& alloc)
+    : m_storage(byte_allocator(alloc))
+    , m_size(0)
+    , m_capacity(0)
+{} // end soa_vector::soa_vector()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::soa_vector(size_type n, const Alloc& alloc)
+    : m_storage(byte_allocator(alloc))
+    , m_size(0)
+    , m_capacity(0)
+{
+  resize(n);
+} // end soa_vector::soa_vector()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::soa_vector(size_type n, const value_type& value, const Alloc& alloc)
+    : m_storage(byte_allocator(alloc))
+    , m_size(0)
+    , m_capacity(0)
+{
+  resize(n, value);
+} // end soa_vector::soa_vector()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::soa_vector(const soa_vector& v)
+    : m_storage(thrust::detail::copy_allocator_t(), v.m_storage)
+    , m_size(0)
+    , m_capacity(0)
+{
+  if (v.m_size > 0)
+  {
+    m_storage.allocate(storage_bytes(v.m_size));
+    copy_construct_columns(v.m_storage, v.m_capacity, m_storage, v.m_size, v.m_size, column_indices());
+    m_size     = v.m_size;
+    m_capacity = v.m_size;
+  }
+} // end soa_vector::soa_vector()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::soa_vector(soa_vector&& v)
+    : m_storage(v.m_storage.get_allocator())
+    , m_size(0)
+    , m_capacity(0)
+{
+  swap(v);
+} // end soa_vector::soa_vector()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>& soa_vector<thrust::tuple<Ts...>, Alloc>::operator=(const soa_vector& v)
+{
+  if (this != &v)
+  {
+    soa_vector temp(v);
+    swap(temp);
+  }
+
+  return *this;
+} // end soa_vector::operator=()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>& soa_vector<thrust::tuple<Ts...>, Alloc>::operator=(soa_vector&& v)
+{
+  soa_vector temp(std::move(v));
+  swap(temp);
+
+  return *this;
+} // end soa_vector::operator=()
+
+template <typename... Ts, typename Alloc>
+soa_vector<thrust::tuple<Ts...>, Alloc>::~soa_vector()
+{
+  // destroy every living thing
+  clear();
+} // end soa_vector::~soa_vector()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::resize(size_type new_size)
+{
+  if (new_size < m_size)
+  {
+    destroy_columns(new_size, m_size - new_size, column_indices());
+  }
+  else if (new_size > m_size)
+  {
+    if (new_size > m_capacity)
+    {
+      reserve(grown_capacity(new_size));
+    }
+
+    default_construct_columns(m_size, new_size - m_size, column_indices());
+  }
+
+  m_size = new_size;
+} // end soa_vector::resize()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::resize(size_type new_size, const value_type& x)
+{
+  if (new_size < m_size)
+  {
+    destroy_columns(new_size, m_size - new_size, column_indices());
+  }
+  else if (new_size > m_size)
+  {
+    if (new_size > m_capacity)
+    {
+      reserve(grown_capacity(new_size));
+    }
+
+    fill_construct_columns(m_size, new_size - m_size, x, column_indices());
+  }
+
+  m_size = new_size;
+} // end soa_vector::resize()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type soa_vector<thrust::tuple<Ts...>, Alloc>::size() const
+{
+  return m_size;
+} // end soa_vector::size()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type soa_vector<thrust::tuple<Ts...>, Alloc>::max_size() const
+{
+  const size_type column_sizes[] = {sizeof(Ts)...};
+
+  size_type bytes_per_element = 0;
+  for (size_type i = 0; i < sizeof...(Ts); ++i)
+  {
+    bytes_per_element += column_sizes[i];
+  }
+
+  // leave room for the padding of every column
+  return (m_storage.max_size() - sizeof...(Ts) * column_alignment) / bytes_per_element;
+} // end soa_vector::max_size()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::reserve(size_type n)
+{
+  if (n > m_capacity)
+  {
+    if (n > max_size())
+    {
+      throw std::length_error("reserve(): n exceeds max_size().");
+    }
+
+    reallocate(n);
+  }
+} // end soa_vector::reserve()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type soa_vector<thrust::tuple<Ts...>, Alloc>::capacity() const
+{
+  return m_capacity;
+} // end soa_vector::capacity()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::shrink_to_fit()
+{
+  if (m_capacity > m_size)
+  {
+    reallocate(m_size);
+  }
+} // end soa_vector::shrink_to_fit()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::reference
+soa_vector<thrust::tuple<Ts...>, Alloc>::operator[](size_type n)
+{
+  return begin()[n];
+} // end soa_vector::operator[]
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_reference
+soa_vector<thrust::tuple<Ts...>, Alloc>::operator[](size_type n) const
+{
+  return begin()[n];
+} // end soa_vector::operator[]
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::iterator soa_vector<thrust::tuple<Ts...>, Alloc>::begin()
+{
+  return make_iterator(0, column_indices());
+} // end soa_vector::begin()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_iterator soa_vector<thrust::tuple<Ts...>, Alloc>::begin() const
+{
+  return make_iterator(0, column_indices());
+} // end soa_vector::begin()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_iterator
+soa_vector<thrust::tuple<Ts...>, Alloc>::cbegin() const
+{
+  return begin();
+} // end soa_vector::cbegin()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::iterator soa_vector<thrust::tuple<Ts...>, Alloc>::end()
+{
+  return make_iterator(m_size, column_indices());
+} // end soa_vector::end()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_iterator soa_vector<thrust::tuple<Ts...>, Alloc>::end() const
+{
+  return make_iterator(m_size, column_indices());
+} // end soa_vector::end()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_iterator soa_vector<thrust::tuple<Ts...>, Alloc>::cend() const
+{
+  return end();
+} // end soa_vector::cend()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::reference soa_vector<thrust::tuple<Ts...>, Alloc>::front()
+{
+  return *begin();
+} // end soa_vector::front()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_reference
+soa_vector<thrust::tuple<Ts...>, Alloc>::front() const
+{
+  return *begin();
+} // end soa_vector::front()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::reference soa_vector<thrust::tuple<Ts...>, Alloc>::back()
+{
+  return begin()[m_size - 1];
+} // end soa_vector::back()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_reference
+soa_vector<thrust::tuple<Ts...>, Alloc>::back() const
+{
+  return begin()[m_size - 1];
+} // end soa_vector::back()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::template column_pointer<I>
+soa_vector<thrust::tuple<Ts...>, Alloc>::column()
+{
+  return column_in<I>(m_storage, m_capacity);
+} // end soa_vector::column()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::template const_column_pointer<I>
+soa_vector<thrust::tuple<Ts...>, Alloc>::column() const
+{
+  return column_in<I>(m_storage, m_capacity);
+} // end soa_vector::column()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::clear()
+{
+  destroy_columns(0, m_size, column_indices());
+  m_size = 0;
+} // end soa_vector::clear()
+
+template <typename... Ts, typename Alloc>
+bool soa_vector<thrust::tuple<Ts...>, Alloc>::empty() const
+{
+  return m_size == 0;
+} // end soa_vector::empty()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::push_back(const value_type& x)
+{
+  if (m_size == m_capacity)
+  {
+    reserve(grown_capacity(m_size + 1));
+  }
+
+  fill_construct_columns(m_size, 1, x, column_indices());
+  ++m_size;
+} // end soa_vector::push_back()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::pop_back()
+{
+  destroy_columns(m_size - 1, 1, column_indices());
+  --m_size;
+} // end soa_vector::pop_back()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::swap(soa_vector& v)
+{
+  thrust::swap(m_storage, v.m_storage);
+  thrust::swap(m_size, v.m_size);
+  thrust::swap(m_capacity, v.m_capacity);
+} // end soa_vector::swap()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::allocator_type
+soa_vector<thrust::tuple<Ts...>, Alloc>::get_allocator() const
+{
+  return allocator_type(m_storage.get_allocator());
+} // end soa_vector::get_allocator()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type
+soa_vector<thrust::tuple<Ts...>, Alloc>::column_bytes(size_type capacity)
+{
+  const size_type bytes = capacity * sizeof(column_type<I>);
+
+  return (bytes + column_alignment - 1) / column_alignment * column_alignment;
+} // end soa_vector::column_bytes()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type
+soa_vector<thrust::tuple<Ts...>, Alloc>::column_offset(size_type capacity)
+{
+  const size_type column_sizes[] = {sizeof(Ts)...};
+
+  size_type offset = 0;
+  for (size_type i = 0; i < I; ++i)
+  {
+    offset += (capacity * column_sizes[i] + column_alignment - 1) / column_alignment * column_alignment;
+  }
+
+  return offset;
+} // end soa_vector::column_offset()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type
+soa_vector<thrust::tuple<Ts...>, Alloc>::storage_bytes(size_type capacity)
+{
+  if (capacity == 0)
+  {
+    return 0;
+  }
+
+  constexpr std::size_t last = sizeof...(Ts) - 1;
+
+  return column_offset<last>(capacity) + column_bytes<last>(capacity) + column_alignment - 1;
+} // end soa_vector::storage_bytes()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::template column_pointer<I>
+soa_vector<thrust::tuple<Ts...>, Alloc>::column_in(storage_type& storage, size_type capacity)
+{
+  if (storage.size() == 0)
+  {
+    return column_pointer<I>();
+  }
+
+  // the allocation is not aligned to column_alignment in general, so skip to
+  // the first address in it which is
+  unsigned char* base          = thrust::raw_pointer_cast(storage.data());
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(base);
+  const size_type padding      = (column_alignment - address % column_alignment) % column_alignment;
+
+  return column_pointer<I>(reinterpret_cast<column_type<I>*>(base + padding + column_offset<I>(capacity)));
+} // end soa_vector::column_in()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::template const_column_pointer<I>
+soa_vector<thrust::tuple<Ts...>, Alloc>::column_in(const storage_type& storage, size_type capacity)
+{
+  return column_in<I>(const_cast<storage_type&>(storage), capacity);
+} // end soa_vector::column_in()
+
+template <typename... Ts, typename Alloc>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::reallocate(size_type new_capacity)
+{
+  storage_type new_storage(m_storage.get_allocator());
+
+  if (new_capacity > 0)
+  {
+    new_storage.allocate(storage_bytes(new_capacity));
+  }
+
+  copy_construct_columns(m_storage, m_capacity, new_storage, new_capacity, m_size, column_indices());
+  destroy_columns(0, m_size, column_indices());
+
+  m_storage.swap(new_storage);
+  m_capacity = new_capacity;
+} // end soa_vector::reallocate()
+
+template <typename... Ts, typename Alloc>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::size_type
+soa_vector<thrust::tuple<Ts...>, Alloc>::grown_capacity(size_type n) const
+{
+  // grow geometrically, but not beyond max_size()
+  const size_type doubled = m_capacity < max_size() / 2 ? 2 * m_capacity : max_size();
+
+  return doubled < n ? n : doubled;
+} // end soa_vector::grown_capacity()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::iterator
+soa_vector<thrust::tuple<Ts...>, Alloc>::make_iterator(size_type n, thrust::index_sequence<Is...>)
+{
+  return thrust::make_zip_iterator(thrust::make_tuple((column<Is>() + n)...));
+} // end soa_vector::make_iterator()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+typename soa_vector<thrust::tuple<Ts...>, Alloc>::const_iterator
+soa_vector<thrust::tuple<Ts...>, Alloc>::make_iterator(size_type n, thrust::index_sequence<Is...>) const
+{
+  return thrust::make_zip_iterator(thrust::make_tuple((column<Is>() + n)...));
+} // end soa_vector::make_iterator()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::default_construct_column(size_type first, size_type n)
+{
+  column_allocator<I> alloc(m_storage.get_allocator());
+  thrust::detail::default_construct_range(alloc, column<I>() + first, n);
+} // end soa_vector::default_construct_column()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::fill_construct_column(
+  size_type first, size_type n, const column_type<I>& x)
+{
+  column_allocator<I> alloc(m_storage.get_allocator());
+  thrust::detail::fill_construct_range(alloc, column<I>() + first, n, x);
+} // end soa_vector::fill_construct_column()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::destroy_column(size_type first, size_type n)
+{
+  destroy_column_in<I>(m_storage, m_capacity, first, n);
+} // end soa_vector::destroy_column()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::destroy_column_in(
+  storage_type& storage, size_type capacity, size_type first, size_type n)
+{
+  column_allocator<I> alloc(m_storage.get_allocator());
+  thrust::detail::destroy_range(alloc, column_in<I>(storage, capacity) + first, n);
+} // end soa_vector::destroy_column_in()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t I>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::copy_construct_column(
+  const storage_type& from_storage,
+  size_type from_capacity,
+  storage_type& to_storage,
+  size_type to_capacity,
+  size_type n)
+{
+  // XXX assumes the column's System is default-constructible
+  typename thrust::iterator_system<column_pointer<I>>::type from_system;
+
+  column_allocator<I> alloc(m_storage.get_allocator());
+  const_column_pointer<I> first = column_in<I>(from_storage, from_capacity);
+
+  thrust::detail::copy_construct_range(from_system, alloc, first, first + n, column_in<I>(to_storage, to_capacity));
+} // end soa_vector::copy_construct_column()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::default_construct_columns(
+  size_type first, size_type n, thrust::index_sequence<Is...>)
+{
+  if (n > 0)
+  {
+    std::size_t built = 0;
+
+    try
+    {
+      auto l = {(default_construct_column<Is>(first, n), ++built)...};
+      THRUST_UNUSED_VAR(l);
+    } // end try
+    catch (...)
+    {
+      destroy_first_columns(m_storage, m_capacity, first, n, built, column_indices());
+      throw;
+    } // end catch
+  }
+} // end soa_vector::default_construct_columns()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::fill_construct_columns(
+  size_type first, size_type n, const value_type& x, thrust::index_sequence<Is...>)
+{
+  if (n > 0)
+  {
+    std::size_t built = 0;
+
+    try
+    {
+      auto l = {(fill_construct_column<Is>(first, n, thrust::get<Is>(x)), ++built)...};
+      THRUST_UNUSED_VAR(l);
+    } // end try
+    catch (...)
+    {
+      destroy_first_columns(m_storage, m_capacity, first, n, built, column_indices());
+      throw;
+    } // end catch
+  }
+} // end soa_vector::fill_construct_columns()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::destroy_columns(
+  size_type first, size_type n, thrust::index_sequence<Is...>)
+{
+  if (n > 0)
+  {
+    auto l = {(destroy_column<Is>(first, n), 0)...};
+    THRUST_UNUSED_VAR(l);
+  }
+} // end soa_vector::destroy_columns()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::destroy_first_columns(
+  storage_type& storage,
+  size_type capacity,
+  size_type first,
+  size_type n,
+  std::size_t count,
+  thrust::index_sequence<Is...>)
+{
+  auto l = {(Is < count ? destroy_column_in<Is>(storage, capacity, first, n) : void(), 0)...};
+  THRUST_UNUSED_VAR(l);
+} // end soa_vector::destroy_first_columns()
+
+template <typename... Ts, typename Alloc>
+template <std::size_t... Is>
+void soa_vector<thrust::tuple<Ts...>, Alloc>::copy_construct_columns(
+  const storage_type& from_storage,
+  size_type from_capacity,
+  storage_type& to_storage,
+  size_type to_capacity,
+  size_type n,
+  thrust::index_sequence<Is...>)
+{
+  if (n > 0)
+  {
+    std::size_t built = 0;
+
+    try
+    {
+      auto l = {(copy_construct_column<Is>(from_storage, from_capacity, to_storage, to_capacity, n), ++built)...};
+      THRUST_UNUSED_VAR(l);
+    } // end try
+    catch (...)
+    {
+      destroy_first_columns(to_storage, to_capacity, 0, n, built, column_indices());
+      throw;
+    } // end catch
+  }
+} // end soa_vector::copy_construct_columns()
+
+THRUST_NAMESPACE_END
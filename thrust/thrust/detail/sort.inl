@@ -137,6 +137,145 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last);
+} // end nth_element()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last, comp);
+} // end nth_element()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last);
+} // end partial_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last, comp);
+} // end partial_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result);
+} // end top_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result, comp);
+} // end top_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, offsets_first, offsets_last);
+} // end segmented_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::segmented_sort;
+  return segmented_sort(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, offsets_first, offsets_last, comp);
+} // end segmented_sort()
+
 _CCCL_EXEC_CHECK_DISABLE
 template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE bool
@@ -298,6 +437,152 @@ void stable_sort_by_key(RandomAccessIterator1 keys_first,
   return thrust::stable_sort_by_key(select_system(system1, system2), keys_first, keys_last, values_first, comp);
 } // end stable_sort_by_key()
 
+template <typename RandomAccessIterator>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last);
+} // end nth_element()
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(
+  RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last, comp);
+} // end nth_element()
+
+template <typename RandomAccessIterator>
+void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last);
+} // end partial_sort()
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(
+  RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last, comp);
+} // end partial_sort()
+
+template <typename InputIterator, typename RandomAccessIterator>
+RandomAccessIterator partial_sort_copy(
+  InputIterator first, InputIterator last, RandomAccessIterator result_first, RandomAccessIterator result_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+template <typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+template <typename InputIterator, typename Size, typename RandomAccessIterator>
+RandomAccessIterator top_k(InputIterator first, InputIterator last, Size k, RandomAccessIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result);
+} // end top_k()
+
+template <typename InputIterator, typename Size, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator
+top_k(InputIterator first, InputIterator last, Size k, RandomAccessIterator result, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result, comp);
+} // end top_k()
+
+template <typename RandomAccessIterator, typename OffsetIterator>
+void segmented_sort(
+  RandomAccessIterator first, RandomAccessIterator last, OffsetIterator offsets_first, OffsetIterator offsets_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OffsetIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort(select_system(system1, system2), first, last, offsets_first, offsets_last);
+} // end segmented_sort()
+
+template <typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+void segmented_sort(RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OffsetIterator offsets_first,
+                    OffsetIterator offsets_last,
+                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System1;
+  typedef typename thrust::iterator_system<OffsetIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::segmented_sort(select_system(system1, system2), first, last, offsets_first, offsets_last, comp);
+} // end segmented_sort()
+
 template <typename ForwardIterator>
 bool is_sorted(ForwardIterator first, ForwardIterator last)
 {
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/transform.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -148,6 +149,66 @@ OutputIterator transform(InputIterator first, InputIterator last, OutputIterator
   return thrust::transform(select_system(system1, system2), first, last, result, op);
 } // end transform()
 
+#if _CCCL_STD_VER >= 2014
+namespace detail
+{
+
+template <typename InputMdspan, typename OutputMdspan, typename UnaryFunction>
+struct mdspan_transform_functor
+{
+  InputMdspan input;
+  OutputMdspan result;
+
+  // mutable because UnaryFunction::operator() might be non-const
+  mutable UnaryFunction op;
+
+  _CCCL_HOST_DEVICE mdspan_transform_functor(InputMdspan input, OutputMdspan result, UnaryFunction op)
+      : input(input)
+      , result(result)
+      , op(op)
+  {}
+
+  // goes through the mappings and accessors instead of operator() or operator[], one of which is
+  // unavailable depending on whether the compiler supports multidimensional subscripts
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename... Indices>
+  _CCCL_HOST_DEVICE void operator()(Indices... idx) const
+  {
+    result.accessor().access(result.data_handle(), result.mapping()(idx...)) =
+      op(input.accessor().access(input.data_handle(), input.mapping()(idx...)));
+  }
+};
+
+} // namespace detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename T1,
+          typename Extents1,
+          typename Layout1,
+          typename Accessor1,
+          typename T2,
+          typename Extents2,
+          typename Layout2,
+          typename Accessor2,
+          typename UnaryFunction>
+_CCCL_HOST_DEVICE void transform(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                 ::cuda::std::mdspan<T1, Extents1, Layout1, Accessor1> input,
+                                 ::cuda::std::mdspan<T2, Extents2, Layout2, Accessor2> result,
+                                 UnaryFunction op)
+{
+  static_assert(Extents1::rank() == Extents2::rank(), "the input and output arrays must have the same rank");
+  _LIBCUDACXX_ASSERT(input.extents() == result.extents(), "the input and output arrays must have the same extents");
+
+  typedef ::cuda::std::mdspan<T1, Extents1, Layout1, Accessor1> InputMdspan;
+  typedef ::cuda::std::mdspan<T2, Extents2, Layout2, Accessor2> OutputMdspan;
+
+  typedef detail::mdspan_transform_functor<InputMdspan, OutputMdspan, UnaryFunction> Functor;
+
+  thrust::for_each_index(exec, input.extents(), Functor(input, result, op));
+} // end transform()
+#endif // _CCCL_STD_VER >= 2014
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename BinaryFunction>
 OutputIterator
 transform(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, OutputIterator result, BinaryFunction op)
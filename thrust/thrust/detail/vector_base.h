@@ -42,6 +42,27 @@
 
 THRUST_NAMESPACE_BEGIN
 
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! \p default_init_t is the type of \p default_init.
+ */
+struct default_init_t
+{};
+
+/*! \p default_init selects the constructors and the \p resize overload of
+ *  \p host_vector, \p device_vector and \p universal_vector which default
+ *  initialize the new elements instead of value initializing them. Elements
+ *  with trivial default constructors are left uninitialized, which saves a
+ *  pass over the memory when they are overwritten anyway, e.g. by the output
+ *  of an algorithm. Other elements are constructed as usual.
+ */
+THRUST_INLINE_CONSTANT default_init_t default_init{};
+
+/*! \} // containers
+ */
+
 namespace detail
 {
 
@@ -90,6 +111,21 @@ public:
    */
   explicit vector_base(size_type n, const Alloc& alloc);
 
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, which are left uninitialized if they are trivially
+   *  default constructible.
+   *  \param n The number of elements to create.
+   */
+  vector_base(size_type n, default_init_t);
+
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, which are left uninitialized if they are trivially
+   *  default constructible.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  vector_base(size_type n, default_init_t, const Alloc& alloc);
+
   /*! This constructor creates a vector_base with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -226,6 +262,18 @@ public:
    */
   void resize(size_type new_size, const value_type& x);
 
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this vector_base to the specified number of
+   *  elements. If the number is smaller than this vector_base's current
+   *  size this vector_base is truncated, otherwise this vector_base is
+   *  extended and new elements are default initialized, i.e. left
+   *  uninitialized if they are trivially default constructible.
+   */
+  void resize(size_type new_size, default_init_t);
+
   /*! Returns the number of elements in this vector_base.
    */
   _CCCL_HOST_DEVICE size_type size(void) const;
@@ -498,6 +546,8 @@ private:
 
   void default_init(size_type n);
 
+  void default_init(size_type n, default_init_t);
+
   void fill_init(size_type n, const T& x);
 
   // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -509,8 +559,9 @@ private:
   template <typename InputIteratorOrIntegralType>
   void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-  // this method appends n default-constructed elements at the end
-  void append(size_type n);
+  // this method appends n default-constructed elements at the end, or
+  // default-initialized elements if default_initialize is true
+  void append(size_type n, bool default_initialize = false);
 
   // this method performs insertion from a fill value
   void fill_insert(iterator position, size_type n, const T& x);
@@ -31,6 +31,8 @@
 #include <thrust/detail/execution_policy.h>
 #include <thrust/detail/type_traits.h>
 
+#include <cuda/std/mdspan>
+
 THRUST_NAMESPACE_BEGIN
 
 /*! \addtogroup modifying
@@ -258,6 +260,63 @@ InputIterator for_each(InputIterator first, InputIterator last, UnaryFunction f)
 template <typename InputIterator, typename Size, typename UnaryFunction>
 InputIterator for_each_n(InputIterator first, Size n, UnaryFunction f);
 
+#if _CCCL_STD_VER >= 2014
+/*! \p for_each_index applies the function object \p f to every multidimensional
+ *  index of the index space described by \p extents. For a space of rank \c R, \p f is
+ *  called as <tt>f(i0, i1, ..., iR-1)</tt>, where every \c ik is of type
+ *  <tt>IndexType</tt> and lies in <tt>[0, extents.extent(k))</tt>; \p f's return value,
+ *  if any, is ignored. No guarantee is made on the order of execution.
+ *
+ *  Unlike iterating a \p counting_iterator over the flattened space, the host backends
+ *  split the space into cache sized tiles which are distributed among threads. Inside of
+ *  a tile the indices are enumerated with nested loops, so no integer division is
+ *  performed per index and the last index varies fastest.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param extents The index space to iterate.
+ *  \param f The function object to apply to every index of \p extents.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam IndexType is the index type of \p extents.
+ *  \tparam Function is a function object which is callable with <tt>sizeof...(Extents)</tt>
+ *          arguments of type \p IndexType.
+ *
+ *  The following code snippet demonstrates how to use \p for_each_index to fill a row
+ *  major matrix using the \p thrust::omp::par execution policy:
+ *
+ *  \code
+ *  #include <thrust/for_each.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <cuda/std/mdspan>
+ *  ...
+ *  struct fill_functor
+ *  {
+ *    cuda::std::mdspan<float, cuda::std::dextents<int, 2>> m;
+ *
+ *    __host__ __device__
+ *    void operator()(int i, int j) const
+ *    {
+ *      m(i, j) = i + 0.5f * j;
+ *    }
+ *  };
+ *  ...
+ *  std::vector<float> data(1000 * 500);
+ *  cuda::std::mdspan<float, cuda::std::dextents<int, 2>> m(data.data(), 1000, 500);
+ *
+ *  thrust::for_each_index(thrust::omp::par, m.extents(), fill_functor{m});
+ *  \endcode
+ *
+ *  \see for_each
+ *  \see transform
+ */
+template <typename DerivedPolicy, typename IndexType, ::cuda::std::size_t... Extents, typename Function>
+_CCCL_HOST_DEVICE void for_each_index(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                      const ::cuda::std::extents<IndexType, Extents...>& extents,
+                                      Function f);
+#endif // _CCCL_STD_VER >= 2014
+
 /*! \} // end modifying
  */
 
@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Counts the samples of a range which fall into each bin of a histogram
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p histogram_even counts the samples in the range <tt>[first, last)</tt>
+ *  which fall into each of <tt>num_levels - 1</tt> bins of equal width. The
+ *  bins evenly divide the half-open interval <tt>[lower_level, upper_level)</tt>,
+ *  and samples outside of that interval are ignored. The count of the <tt>i</tt>th
+ *  bin is assigned to <tt>*(histogram + i)</tt>.
+ *
+ *  The bins are computed like in <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *  With an integral \p Level, a sample \c s falls into the bin
+ *  <tt>(s - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt>.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) count the samples in linear
+ *  time. The parallel host systems give every thread a private histogram and
+ *  sum them afterwards. Other systems sort the bin indices of the samples.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output range of <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the lowest bin.
+ *  \param upper_level The upper bound, exclusive, of the highest bin.
+ *  \return The end of the output range, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a> and \p InputIterator's \c value_type is comparable to \p Level and convertible to \p Level.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *  \pre The sample range shall not overlap the output range.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to
+ *  count the samples in each of four bins using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[8] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.0f};
+ *  int histogram[4];
+ *
+ *  // bins are [0, 2), [2, 4), [4, 6) and [6, 8)
+ *  thrust::histogram_even(thrust::host, samples, samples + 8, histogram, 5, 0.0f, 8.0f);
+ *
+ *  // histogram is now {1, 5, 0, 2}
+ *  \endcode
+ *
+ *  \see histogram_range
+ *  \see <tt>cub::DeviceHistogram</tt>
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_even counts the samples in the range <tt>[first, last)</tt>
+ *  which fall into each of <tt>num_levels - 1</tt> bins of equal width. The
+ *  bins evenly divide the half-open interval <tt>[lower_level, upper_level)</tt>,
+ *  and samples outside of that interval are ignored. The count of the <tt>i</tt>th
+ *  bin is assigned to <tt>*(histogram + i)</tt>.
+ *
+ *  The bins are computed like in <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *  With an integral \p Level, a sample \c s falls into the bin
+ *  <tt>(s - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt>.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output range of <tt>num_levels - 1</tt> counters.
+ *  \param num_levels The number of bin boundaries, which is one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the lowest bin.
+ *  \param upper_level The upper bound, exclusive, of the highest bin.
+ *  \return The end of the output range, <tt>histogram + num_levels - 1</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a> and \p InputIterator's \c value_type is comparable to \p Level and convertible to \p Level.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>.
+ *  \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *  \pre The sample range shall not overlap the output range.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to
+ *  count the samples in each of four bins:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  float samples[8] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.0f};
+ *  thrust::device_vector<float> d_samples(samples, samples + 8);
+ *  thrust::device_vector<int> d_histogram(4);
+ *
+ *  // bins are [0, 2), [2, 4), [4, 6) and [6, 8)
+ *  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 5, 0.0f, 8.0f);
+ *
+ *  // d_histogram is now {1, 5, 0, 2}
+ *  \endcode
+ *
+ *  \see histogram_range
+ *  \see <tt>cub::DeviceHistogram</tt>
+ */
+template <typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_range counts the samples in the range <tt>[first, last)</tt>
+ *  which fall into each of the bins delimited by the sorted range of levels
+ *  <tt>[levels_first, levels_last)</tt>. The <tt>i</tt>th bin is the half-open
+ *  interval <tt>[*(levels_first + i), *(levels_first + i + 1))</tt>, and samples
+ *  outside of all bins are ignored. The count of the <tt>i</tt>th bin is
+ *  assigned to <tt>*(histogram + i)</tt>.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) find the bin of every sample
+ *  with a binary search over the levels. The parallel host systems give every
+ *  thread a private histogram and sum them afterwards. Other systems sort the
+ *  bin indices of the samples.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output range of <tt>levels_last - levels_first - 1</tt> counters.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return The end of the output range, <tt>histogram + (levels_last - levels_first - 1)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a> and \p InputIterator's \c value_type is comparable to \p RandomAccessIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The range <tt>[levels_first, levels_last)</tt> shall be sorted in strictly ascending order.
+ *  \pre The sample range shall not overlap the output range.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to
+ *  count the samples in each of four bins of varying width using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[8] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.0f};
+ *  float levels[5]  = {0.0f, 2.0f, 3.0f, 6.0f, 8.0f};
+ *  int histogram[4];
+ *
+ *  // bins are [0, 2), [2, 3), [3, 6) and [6, 8)
+ *  thrust::histogram_range(thrust::host, samples, samples + 8, histogram, levels, levels + 5);
+ *
+ *  // histogram is now {1, 4, 1, 2}
+ *  \endcode
+ *
+ *  \see histogram_even
+ *  \see <tt>cub::DeviceHistogram</tt>
+ */
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last);
+
+/*! \p histogram_range counts the samples in the range <tt>[first, last)</tt>
+ *  which fall into each of the bins delimited by the sorted range of levels
+ *  <tt>[levels_first, levels_last)</tt>. The <tt>i</tt>th bin is the half-open
+ *  interval <tt>[*(levels_first + i), *(levels_first + i + 1))</tt>, and samples
+ *  outside of all bins are ignored. The count of the <tt>i</tt>th bin is
+ *  assigned to <tt>*(histogram + i)</tt>.
+ *
+ *  \param first The beginning of the sequence of samples.
+ *  \param last The end of the sequence of samples.
+ *  \param histogram The beginning of the output range of <tt>levels_last - levels_first - 1</tt> counters.
+ *  \param levels_first The beginning of the sequence of bin boundaries.
+ *  \param levels_last The end of the sequence of bin boundaries.
+ *  \return The end of the output range, <tt>histogram + (levels_last - levels_first - 1)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ *          Iterator</a> and \p InputIterator's \c value_type is comparable to \p RandomAccessIterator's \c value_type.
+ *  \tparam OutputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output
+ *          Iterator</a>.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The range <tt>[levels_first, levels_last)</tt> shall be sorted in strictly ascending order.
+ *  \pre The sample range shall not overlap the output range.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to
+ *  count the samples in each of four bins of varying width:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  float samples[8] = {2.2f, 6.0f, 7.1f, 2.9f, 3.5f, 0.3f, 2.9f, 2.0f};
+ *  float levels[5]  = {0.0f, 2.0f, 3.0f, 6.0f, 8.0f};
+ *  thrust::device_vector<float> d_samples(samples, samples + 8);
+ *  thrust::device_vector<float> d_levels(levels, levels + 5);
+ *  thrust::device_vector<int> d_histogram(4);
+ *
+ *  // bins are [0, 2), [2, 3), [3, 6) and [6, 8)
+ *  thrust::histogram_range(
+ *    d_samples.begin(), d_samples.end(), d_histogram.begin(), d_levels.begin(), d_levels.end());
+ *
+ *  // d_histogram is now {1, 4, 1, 2}
+ *  \endcode
+ *
+ *  \see histogram_even
+ *  \see <tt>cub::DeviceHistogram</tt>
+ */
+template <typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last);
+
+/*! \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
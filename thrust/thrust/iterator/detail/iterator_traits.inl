@@ -103,9 +103,30 @@ struct iterator_system<const void*>
 template <typename Iterator>
 using iterator_system_t = typename iterator_system<Iterator>::type;
 
+namespace detail
+{
+
+// C++20 iterators whose reference is a prvalue, such as the ones of the cuda::std::ranges views, report
+// input_iterator_tag as their category and their actual traversal in iterator_concept
+template <typename Iterator, typename = void>
+struct iterator_category_or_concept
+{
+  typedef typename iterator_traits<Iterator>::iterator_category type;
+}; // end iterator_category_or_concept
+
+template <typename Iterator>
+struct iterator_category_or_concept<Iterator, typename voider<typename Iterator::iterator_concept>::type>
+    : eval_if<is_convertible<typename Iterator::iterator_concept,
+                             typename iterator_traits<Iterator>::iterator_category>::value,
+              identity_<typename Iterator::iterator_concept>,
+              identity_<typename iterator_traits<Iterator>::iterator_category>>
+{}; // end iterator_category_or_concept
+
+} // namespace detail
+
 template <typename Iterator>
 struct iterator_traversal
-    : detail::iterator_category_to_traversal<typename thrust::iterator_traits<Iterator>::iterator_category>
+    : detail::iterator_category_to_traversal<typename detail::iterator_category_or_concept<Iterator>::type>
 {}; // end iterator_traversal
 
 namespace detail
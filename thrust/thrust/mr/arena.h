@@ -0,0 +1,269 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A bump allocating memory resource adaptor, which hands its memory out again
+ *  once everything allocated from it has been returned.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor for short lived scratch memory, such as the temporary storage of an algorithm.
+ *
+ *  Allocations are carved out of a single block of memory obtained from \p Upstream by bumping an offset, and
+ * deallocations only count down the number of live allocations; when that number drops to zero, the whole block is
+ * reused from its start. Allocations which don't fit into the block are served by separate blocks from \p Upstream,
+ * which are returned once the arena is empty again; the next allocation then grows the block to cover all of them, so
+ * that a repeated pattern of allocations stops reaching \p Upstream after its first round. The block never grows past
+ * \p max_capacity, allocations beyond that keep going to \p Upstream.
+ *
+ *  Memory is only ever reclaimed as a whole, so this resource is a poor fit for long lived allocations or for
+ * allocations which are never all released at the same time.
+ *
+ *  \tparam Upstream the type of memory resource that will be used for allocating memory blocks; it has to return raw
+ *      pointers
+ */
+template <typename Upstream>
+class unsynchronized_arena_resource final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+  static_assert(std::is_same<typename Upstream::pointer, void*>::value,
+                "unsynchronized_arena_resource requires an upstream resource returning raw pointers");
+
+public:
+  /*! The default limit for the size of the block.
+   */
+  static const std::size_t default_max_capacity = static_cast<std::size_t>(1) << 24;
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param max_capacity the largest size the block is grown to
+   */
+  unsynchronized_arena_resource(Upstream* upstream, std::size_t max_capacity = default_max_capacity)
+      : m_upstream(upstream)
+      , m_max_capacity(max_capacity)
+      , m_block(nullptr)
+      , m_block_size(0)
+      , m_wanted_block_size(0)
+      , m_offset(0)
+      , m_overflow(nullptr)
+      , m_demand(0)
+      , m_outstanding(0)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   */
+  unsynchronized_arena_resource()
+      : unsynchronized_arena_resource(get_global_resource<Upstream>())
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~unsynchronized_arena_resource()
+  {
+    release();
+  }
+
+  unsynchronized_arena_resource(const unsynchronized_arena_resource&)            = delete;
+  unsynchronized_arena_resource& operator=(const unsynchronized_arena_resource&) = delete;
+
+  /*! Releases all held memory to upstream, and forgets how large the block was meant to grow. Nothing allocated from
+   *  this resource may be live at that point.
+   */
+  void release()
+  {
+    assert(m_outstanding == 0);
+
+    release_overflow();
+    release_block();
+    m_wanted_block_size = 0;
+    m_offset            = 0;
+    m_demand            = 0;
+  }
+
+  /*! Returns the size of the block allocations are currently carved out of.
+   */
+  std::size_t capacity() const
+  {
+    return m_block_size;
+  }
+
+  /*! Returns the largest size the block is grown to.
+   */
+  std::size_t max_capacity() const
+  {
+    return m_max_capacity;
+  }
+
+  /*! Returns the number of allocations which haven't been deallocated yet.
+   */
+  std::size_t outstanding() const
+  {
+    return m_outstanding;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    // growing the block is left to here, deallocations must not allocate
+    if (m_outstanding == 0 && m_wanted_block_size > m_block_size)
+    {
+      release_block();
+      m_block      = m_upstream->do_allocate(m_wanted_block_size, block_alignment);
+      m_block_size = m_wanted_block_size;
+    }
+
+    // the worst case footprint of this allocation in a block of our own
+    m_demand += bytes + alignment;
+
+    if (m_block)
+    {
+      std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_block);
+      std::uintptr_t ret  = (base + m_offset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+      if (ret + bytes <= base + m_block_size)
+      {
+        m_offset = ret + bytes - base;
+        ++m_outstanding;
+        return reinterpret_cast<void*>(ret);
+      }
+    }
+
+    // doesn't fit; get a block from upstream which lives until the arena is empty, and put the bookkeeping in front
+    std::size_t block_align = alignment < alignof(overflow_block) ? alignof(overflow_block) : alignment;
+    std::size_t header_size = (sizeof(overflow_block) + block_align - 1) & ~(block_align - 1);
+
+    overflow_block* block = static_cast<overflow_block*>(m_upstream->do_allocate(header_size + bytes, block_align));
+    block->next           = m_overflow;
+    block->size           = header_size + bytes;
+    block->alignment      = block_align;
+    m_overflow            = block;
+
+    ++m_outstanding;
+    return static_cast<char*>(static_cast<void*>(block)) + header_size;
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    (void) p;
+    (void) bytes;
+    (void) alignment;
+    assert(m_outstanding > 0);
+
+    if (--m_outstanding == 0)
+    {
+      reset();
+    }
+  }
+
+private:
+  struct overflow_block
+  {
+    overflow_block* next;
+    std::size_t size;
+    std::size_t alignment;
+  };
+
+  static const std::size_t block_alignment = THRUST_MR_DEFAULT_ALIGNMENT;
+  static const std::size_t min_block_size  = 4096;
+
+  Upstream* m_upstream;
+  std::size_t m_max_capacity;
+
+  void* m_block;
+  std::size_t m_block_size;
+  // the size the block is grown to by the next allocation into an empty arena
+  std::size_t m_wanted_block_size;
+  std::size_t m_offset;
+
+  overflow_block* m_overflow;
+  // the bytes a single block would have needed for the allocations since the arena was last empty
+  std::size_t m_demand;
+  std::size_t m_outstanding;
+
+  void release_overflow()
+  {
+    while (m_overflow)
+    {
+      overflow_block* next = m_overflow->next;
+      m_upstream->do_deallocate(m_overflow, m_overflow->size, m_overflow->alignment);
+      m_overflow = next;
+    }
+  }
+
+  void release_block()
+  {
+    if (m_block)
+    {
+      m_upstream->do_deallocate(m_block, m_block_size, block_alignment);
+      m_block      = nullptr;
+      m_block_size = 0;
+    }
+  }
+
+  void reset()
+  {
+    if (m_overflow)
+    {
+      release_overflow();
+
+      std::size_t new_size = m_block_size * 2;
+      new_size             = new_size < m_demand ? m_demand : new_size;
+      new_size             = new_size < min_block_size ? min_block_size : new_size;
+      new_size             = new_size > m_max_capacity ? m_max_capacity : new_size;
+
+      if (new_size > m_block_size)
+      {
+        m_wanted_block_size = new_size;
+      }
+    }
+
+    m_offset = 0;
+    m_demand = 0;
+  }
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
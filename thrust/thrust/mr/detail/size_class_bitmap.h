@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/integer_math.h>
+
+#include <algorithm>
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+
+// Size classes used by the pool resources to index their cached oversized
+// blocks, with four classes per power of two, so that all the sizes within a
+// class are within a factor of 1.25 of each other. The bitmap keeps track of
+// the classes that aren't empty, so that a search for a fitting block skips
+// over empty classes without touching their (possibly device) storage.
+class size_class_bitmap
+{
+  static const std::size_t word_bits = 8 * sizeof(std::size_t);
+
+public:
+  static const std::size_t class_count = 4 * word_bits;
+
+  size_class_bitmap()
+  {
+    clear();
+  }
+
+  static std::size_t size_class(std::size_t size)
+  {
+    std::size_t size_log2 = thrust::detail::log2(size);
+    std::size_t sub_class = size_log2 < 2 ? 0 : (size >> (size_log2 - 2)) & 3;
+    return size_log2 * 4 + sub_class;
+  }
+
+  // the smallest size that falls into the given class
+  static std::size_t lower_bound(std::size_t size_class)
+  {
+    std::size_t size_log2 = size_class / 4;
+    if (size_log2 < 2)
+    {
+      return static_cast<std::size_t>(1) << size_log2;
+    }
+    return (4 + size_class % 4) << (size_log2 - 2);
+  }
+
+  void set(std::size_t size_class)
+  {
+    m_words[size_class / word_bits] |= static_cast<std::size_t>(1) << (size_class % word_bits);
+  }
+
+  void reset(std::size_t size_class)
+  {
+    m_words[size_class / word_bits] &= ~(static_cast<std::size_t>(1) << (size_class % word_bits));
+  }
+
+  void clear()
+  {
+    std::fill(m_words, m_words + class_count / word_bits, std::size_t(0));
+  }
+
+  // returns class_count if there is no non-empty class at or after size_class
+  std::size_t next(std::size_t size_class) const
+  {
+    while (size_class < class_count)
+    {
+      std::size_t word = m_words[size_class / word_bits] >> (size_class % word_bits);
+      if (word == 0)
+      {
+        size_class = (size_class / word_bits + 1) * word_bits;
+        continue;
+      }
+
+      while (!(word & 1))
+      {
+        word >>= 1;
+        ++size_class;
+      }
+      return size_class;
+    }
+
+    return class_count;
+  }
+
+private:
+  std::size_t m_words[class_count / word_bits];
+};
+
+} // end namespace detail
+THRUST_NAMESPACE_END
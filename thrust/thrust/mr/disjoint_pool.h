@@ -35,11 +35,15 @@
 
 #include <thrust/binary_search.h>
 #include <thrust/detail/algorithm_wrapper.h>
+#include <thrust/detail/cstdint.h>
 #include <thrust/detail/seq.h>
+#include <thrust/find.h>
 #include <thrust/host_vector.h>
+#include <thrust/mr/detail/size_class_bitmap.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/statistics.h>
 
 #include <cassert>
 
@@ -105,6 +109,9 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_cached_oversized_bytes = 0;
+    ret.cached_oversized_max_idle  = 0;
+
     return ret;
   }
 
@@ -124,12 +131,18 @@ public:
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_oversized_count(0)
+      , m_statistics()
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector blocks(m_bookkeeper);
+    cached_bin bin(blocks);
+    m_cached_oversized.resize(size_class_bitmap::class_count, bin);
   }
 
   // TODO: C++11: use delegating constructors
@@ -147,12 +160,18 @@ public:
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_oversized_count(0)
+      , m_statistics()
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector blocks(m_bookkeeper);
+    cached_bin bin(blocks);
+    m_cached_oversized.resize(size_class_bitmap::class_count, bin);
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -191,36 +210,25 @@ private:
     }
   };
 
-  struct equal_pointers
-  {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.pointer == p;
-    }
-
-  private:
-    void_ptr p;
-  };
-
   struct matching_alignment
   {
   public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
+    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested, std::size_t cutoff_factor)
         : requested(requested)
+        , cutoff_factor(cutoff_factor)
     {}
 
+    // if the alignment is bigger than the requested one by a factor bigger
+    // than or equal to the specified cutoff for alignment, the block is
+    // considered too overaligned to be used
     _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
     {
-      return desc.alignment >= requested;
+      return desc.alignment >= requested && desc.alignment / requested < cutoff_factor;
     }
 
   private:
     std::size_t requested;
+    std::size_t cutoff_factor;
   };
 
   typedef thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>
@@ -233,11 +241,15 @@ private:
     _CCCL_HOST pool(const pointer_vector& free)
         : free_blocks(free)
         , previous_allocated_count(0)
+        , hits(0)
+        , misses(0)
     {}
 
     _CCCL_HOST pool(const pool& other)
         : free_blocks(other.free_blocks)
         , previous_allocated_count(other.previous_allocated_count)
+        , hits(other.hits)
+        , misses(other.misses)
     {}
 
     pool& operator=(const pool&) = default;
@@ -246,10 +258,32 @@ private:
 
     pointer_vector free_blocks;
     std::size_t previous_allocated_count;
+    std::size_t hits;
+    std::size_t misses;
   };
 
   typedef thrust::host_vector<pool, allocator<pool, Bookkeeper>> pool_vector;
 
+  struct cached_bin
+  {
+    _CCCL_HOST cached_bin(const oversized_block_vector& blocks)
+        : blocks(blocks)
+    {}
+
+    _CCCL_HOST cached_bin(const cached_bin& other)
+        : blocks(other.blocks)
+    {}
+
+    cached_bin& operator=(const cached_bin&) = default;
+
+    _CCCL_HOST ~cached_bin() {}
+
+    oversized_block_vector blocks;
+  };
+
+  typedef thrust::host_vector<cached_bin, allocator<cached_bin, Bookkeeper>> cached_bin_vector;
+  typedef thrust::detail::size_class_bitmap size_class_bitmap;
+
   Upstream* m_upstream;
   Bookkeeper* m_bookkeeper;
 
@@ -260,12 +294,150 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
+  // cached oversized/overaligned blocks that have been returned to the pool, binned by size class; every bin is sorted
+  // by size and alignment
+  cached_bin_vector m_cached_oversized;
+  size_class_bitmap m_nonempty_bins;
+  // all oversized/overaligned allocations from upstream, in an open addressing hash table keyed by the pointer, so
+  // that deallocation doesn't have to search through all of them
   oversized_block_vector m_oversized;
+  std::size_t m_oversized_count;
+
+  pool_statistics m_statistics;
+
+  void_ptr upstream_allocate(std::size_t bytes, std::size_t alignment)
+  {
+    void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+    m_statistics.upstream.record_allocation(bytes);
+    return ret;
+  }
+
+  void upstream_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment)
+  {
+    m_statistics.upstream.record_deallocation(bytes);
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+  static oversized_block_descriptor empty_oversized_slot()
+  {
+    oversized_block_descriptor ret = {0, 0, void_ptr()};
+    return ret;
+  }
+
+  static bool is_empty_oversized_slot(const oversized_block_descriptor& desc)
+  {
+    return !detail::pointer_traits<void_ptr>::get(desc.pointer);
+  }
+
+  static std::size_t hash_pointer(void_ptr p)
+  {
+    // upstream allocations are aligned, so the low bits used to select a slot
+    // need to be mixed with the higher ones
+    thrust::detail::uint64_t h = static_cast<thrust::detail::uint64_t>(
+      reinterpret_cast<thrust::detail::uintptr_t>(detail::pointer_traits<void_ptr>::get(p)));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+  // the slot holding the block p, or the empty slot where it is to be inserted
+  std::size_t find_oversized_slot(void_ptr p) const
+  {
+    const std::size_t mask = m_oversized.size() - 1;
+
+    for (std::size_t slot = hash_pointer(p) & mask;; slot = (slot + 1) & mask)
+    {
+      if (is_empty_oversized_slot(m_oversized[slot]) || m_oversized[slot].pointer == p)
+      {
+        return slot;
+      }
+    }
+  }
+
+  void rehash_oversized(std::size_t capacity)
+  {
+    oversized_block_vector table(m_bookkeeper);
+    table.resize(capacity, empty_oversized_slot());
+    m_oversized.swap(table);
+
+    for (std::size_t i = 0; i < table.size(); ++i)
+    {
+      if (!is_empty_oversized_slot(table[i]))
+      {
+        m_oversized[find_oversized_slot(table[i].pointer)] = table[i];
+      }
+    }
+  }
+
+  void insert_oversized(const oversized_block_descriptor& desc)
+  {
+    // keep the load factor at or below one half
+    if (2 * (m_oversized_count + 1) > m_oversized.size())
+    {
+      rehash_oversized((std::max)(static_cast<std::size_t>(16), 2 * m_oversized.size()));
+    }
+
+    m_oversized[find_oversized_slot(desc.pointer)] = desc;
+    ++m_oversized_count;
+  }
+
+  void erase_oversized(std::size_t slot)
+  {
+    const std::size_t mask = m_oversized.size() - 1;
+
+    // shift the following entries of the probe sequence back, so that no
+    // tombstones are needed
+    std::size_t hole = slot;
+    for (std::size_t next = (hole + 1) & mask; !is_empty_oversized_slot(m_oversized[next]); next = (next + 1) & mask)
+    {
+      std::size_t home = hash_pointer(m_oversized[next].pointer) & mask;
+      if (((next - home) & mask) >= ((next - hole) & mask))
+      {
+        m_oversized[hole] = m_oversized[next];
+        hole              = next;
+      }
+    }
+
+    m_oversized[hole] = empty_oversized_slot();
+    --m_oversized_count;
+  }
 
 public:
+  /*! Returns the statistics of the allocations served by the pool and of the memory it allocated from upstream.
+   */
+  pool_statistics statistics() const
+  {
+    pool_statistics ret = m_statistics;
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      bucket_statistics bucket;
+      bucket.block_size = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      bucket.hits       = m_pools[i].hits;
+      bucket.misses     = m_pools[i].misses;
+      ret.buckets.push_back(bucket);
+    }
+
+    return ret;
+  }
+
+  /*! Zeroes the counters in the statistics of the pool. The memory currently in use is still accounted for.
+   */
+  void reset_statistics()
+  {
+    m_statistics.requests.reset();
+    m_statistics.upstream.reset();
+    m_statistics.oversized_cache_hits   = 0;
+    m_statistics.oversized_cache_misses = 0;
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      m_pools[i].hits   = 0;
+      m_pools[i].misses = 0;
+    }
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -280,23 +452,36 @@ public:
     // deallocate memory allocated for the buckets
     for (std::size_t i = 0; i < m_allocated.size(); ++i)
     {
-      m_upstream->do_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
+      upstream_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
     }
 
     // deallocate cached oversized/overaligned memory
     for (std::size_t i = 0; i < m_oversized.size(); ++i)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      if (!is_empty_oversized_slot(m_oversized[i]))
+      {
+        upstream_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      }
+    }
+
+    for (std::size_t bin = m_nonempty_bins.next(0); bin < size_class_bitmap::class_count;
+         bin             = m_nonempty_bins.next(bin + 1))
+    {
+      m_cached_oversized[bin].blocks.clear();
     }
+    m_nonempty_bins.clear();
+    m_statistics.cached_oversized_bytes = 0;
 
     m_allocated.clear();
     m_oversized.clear();
-    m_cached_oversized.clear();
+    m_oversized_count = 0;
   }
 
   _CCCL_NODISCARD virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    m_statistics.requests.record_allocation(bytes);
+
     bytes = (std::max)(bytes, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
@@ -307,51 +492,55 @@ public:
       oversized.size      = bytes;
       oversized.alignment = alignment;
 
-      if (m_options.cache_oversized && !m_cached_oversized.empty())
+      if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
+        std::size_t requested_bin = size_class_bitmap::size_class(bytes);
 
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        for (std::size_t bin = m_nonempty_bins.next(requested_bin); bin < size_class_bitmap::class_count;
+             bin             = m_nonempty_bins.next(bin + 1))
         {
+          oversized_block_vector& cached = m_cached_oversized[bin].blocks;
+
+          typename oversized_block_vector::iterator it =
+            thrust::lower_bound(thrust::seq, cached.begin(), cached.end(), oversized);
+          it = thrust::find_if(
+            thrust::seq, it, cached.end(), matching_alignment(alignment, m_options.cached_alignment_cutoff_factor));
+
+          if (it == cached.end())
+          {
+            continue;
+          }
+
+          // if the size is bigger than the requested size by a factor
+          // bigger than or equal to the specified cutoff for size,
+          // allocate a new block; all the remaining cached blocks are
+          // even bigger
           std::size_t size_factor = (*it).size / bytes;
           if (size_factor >= m_options.cached_size_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
+          // out of equivalent blocks take the last one, which is the cheapest to erase
+          it = thrust::upper_bound(thrust::seq, it, cached.end(), *it) - 1;
 
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
-          std::size_t alignment_factor = (*it).alignment / alignment;
-          if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+          oversized.pointer = (*it).pointer;
+          m_statistics.cached_oversized_bytes -= (*it).size;
+          ++m_statistics.oversized_cache_hits;
+          cached.erase(it);
+          if (cached.empty())
           {
-            it = m_cached_oversized.end();
+            m_nonempty_bins.reset(bin);
           }
-        }
 
-        if (it != m_cached_oversized.end())
-        {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
           return oversized.pointer;
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
-      oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      ++m_statistics.oversized_cache_misses;
+      oversized.pointer = upstream_allocate(bytes, alignment);
+      insert_oversized(oversized);
 
       return oversized.pointer;
     }
@@ -366,6 +555,8 @@ public:
     // and split it into blocks pushed to the free list
     if (bucket.free_blocks.empty())
     {
+      ++bucket.misses;
+
       std::size_t bucket_size = static_cast<std::size_t>(1) << bytes_log2;
 
       std::size_t n = bucket.previous_allocated_count;
@@ -399,7 +590,7 @@ public:
 
       chunk_descriptor allocated;
       allocated.size    = bytes;
-      allocated.pointer = m_upstream->do_allocate(bytes, m_options.alignment);
+      allocated.pointer = upstream_allocate(bytes, m_options.alignment);
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
 
@@ -408,6 +599,10 @@ public:
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
       }
     }
+    else
+    {
+      ++bucket.hits;
+    }
 
     // allocate a block from the front of the bucket's free list
     void_ptr ret = bucket.free_blocks.back();
@@ -417,6 +612,8 @@ public:
 
   virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    m_statistics.requests.record_deallocation(n);
+
     n = (std::max)(n, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
@@ -426,22 +623,26 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-      assert(it != m_oversized.end());
+      assert(m_oversized_count != 0);
+      std::size_t slot = find_oversized_slot(p);
+      assert(!is_empty_oversized_slot(m_oversized[slot]));
 
-      oversized_block_descriptor oversized = *it;
+      oversized_block_descriptor oversized = m_oversized[slot];
 
       if (m_options.cache_oversized)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        // inserting after equivalent blocks keeps repeated deallocations of same sized blocks cheap
+        std::size_t bin                = size_class_bitmap::size_class(oversized.size);
+        oversized_block_vector& cached = m_cached_oversized[bin].blocks;
+        cached.insert(thrust::upper_bound(thrust::seq, cached.begin(), cached.end(), oversized), oversized);
+        m_nonempty_bins.set(bin);
+        m_statistics.cached_oversized_bytes += oversized.size;
         return;
       }
 
-      m_oversized.erase(it);
+      erase_oversized(slot);
 
-      m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+      upstream_deallocate(p, oversized.size, oversized.alignment);
 
       return;
     }
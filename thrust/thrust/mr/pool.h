@@ -34,9 +34,11 @@
 
 #include <thrust/detail/algorithm_wrapper.h>
 #include <thrust/host_vector.h>
+#include <thrust/mr/detail/size_class_bitmap.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/statistics.h>
 
 #include <cassert>
 
@@ -100,6 +102,9 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_cached_oversized_bytes = 0;
+    ret.cached_oversized_max_idle  = 0;
+
     return ret;
   }
 
@@ -115,12 +120,19 @@ public:
       , m_pools(upstream)
       , m_allocated()
       , m_oversized()
-      , m_cached_oversized()
+      , m_cached_bins(upstream)
+      , m_cached_newest()
+      , m_cached_oldest()
+      , m_cached_bytes(0)
+      , m_oversized_epoch(0)
+      , m_statistics()
   {
     assert(m_options.validate());
 
-    pool p = {block_descriptor_ptr(), 0};
+    pool p = {block_descriptor_ptr(), 0, 0, 0};
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    m_cached_bins.resize(size_class_bitmap::class_count, oversized_block_descriptor_ptr());
   }
 
   // TODO: C++11: use delegating constructors
@@ -136,12 +148,19 @@ public:
       , m_pools(get_global_resource<Upstream>())
       , m_allocated()
       , m_oversized()
-      , m_cached_oversized()
+      , m_cached_bins(get_global_resource<Upstream>())
+      , m_cached_newest()
+      , m_cached_oldest()
+      , m_cached_bytes(0)
+      , m_oversized_epoch(0)
+      , m_statistics()
   {
     assert(m_options.validate());
 
-    pool p = {block_descriptor_ptr(), 0};
+    pool p = {block_descriptor_ptr(), 0, 0, 0};
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    m_cached_bins.resize(size_class_bitmap::class_count, oversized_block_descriptor_ptr());
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -178,23 +197,27 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list
   //
-  // TODO: investigate whether it's better to have this be a doubly-linked list
-  // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-  // a forward list and require traversal in do_deallocate
+  // cached blocks are additionally linked into two more doubly linked lists:
+  // the list of their size class bin (prev_cached and next_cached), and the
+  // list of all cached blocks ordered from the most to the least recently
+  // cached one (newer_cached and older_cached); both allow unlinking a block
+  // from the middle when it's reused or trimmed, without any traversal
   //
-  // I assume that it is better this way, but the additional pointer could
-  // potentially hurt? these are supposed to be oversized and/or overaligned,
-  // so they are kinda memory intensive already
+  // I assume that the additional pointers don't hurt; these are supposed to be
+  // oversized and/or overaligned, so they are kinda memory intensive already
   struct oversized_block_descriptor
   {
     std::size_t size;
     std::size_t alignment;
     oversized_block_descriptor_ptr prev;
     oversized_block_descriptor_ptr next;
+    oversized_block_descriptor_ptr prev_cached;
     oversized_block_descriptor_ptr next_cached;
+    oversized_block_descriptor_ptr newer_cached;
+    oversized_block_descriptor_ptr older_cached;
+    std::size_t cached_epoch;
     std::size_t current_size;
   };
 
@@ -202,9 +225,14 @@ private:
   {
     block_descriptor_ptr free_list;
     std::size_t previous_allocated_count;
+    std::size_t hits;
+    std::size_t misses;
   };
 
   typedef thrust::host_vector<pool, allocator<pool, Upstream>> pool_vector;
+  typedef thrust::host_vector<oversized_block_descriptor_ptr, allocator<oversized_block_descriptor_ptr, Upstream>>
+    oversized_bin_vector;
+  typedef thrust::detail::size_class_bitmap size_class_bitmap;
 
   Upstream* m_upstream;
 
@@ -214,9 +242,234 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+
+  // heads of the per size class lists of cached oversized blocks
+  oversized_bin_vector m_cached_bins;
+  size_class_bitmap m_nonempty_bins;
+  oversized_block_descriptor_ptr m_cached_newest;
+  oversized_block_descriptor_ptr m_cached_oldest;
+  std::size_t m_cached_bytes;
+  // the number of oversized allocations so far, used to measure how long blocks stay idle in the cache
+  std::size_t m_oversized_epoch;
+
+  pool_statistics m_statistics;
+
+  void_ptr upstream_allocate(std::size_t bytes, std::size_t alignment)
+  {
+    void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+    m_statistics.upstream.record_allocation(bytes);
+    return ret;
+  }
+
+  void upstream_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment)
+  {
+    m_statistics.upstream.record_deallocation(bytes);
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+  bool is_good_cached_fit(const oversized_block_descriptor& desc, std::size_t bytes, std::size_t alignment) const
+  {
+    // if the size or the alignment is bigger than the requested one by a
+    // factor bigger than or equal to the specified cutoff, a new block is
+    // allocated instead
+    return desc.size >= bytes && desc.alignment >= alignment
+        && desc.size / bytes < m_options.cached_size_cutoff_factor
+        && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor;
+  }
+
+  // Finds the cached block to use for a request. The bin of the requested size
+  // may contain blocks that are too small, so it is searched for the best fit;
+  // all blocks in the bins above it fit within a factor of 1.25 of each other,
+  // so the first suitable block in the first such bin is good enough.
+  oversized_block_descriptor_ptr find_cached_oversized(std::size_t bytes, std::size_t alignment) const
+  {
+    std::size_t requested_bin = size_class_bitmap::size_class(bytes);
+
+    for (std::size_t bin = m_nonempty_bins.next(requested_bin); bin < size_class_bitmap::class_count;
+         bin             = m_nonempty_bins.next(bin + 1))
+    {
+      // all the remaining blocks are too ridiculously oversized
+      if (size_class_bitmap::lower_bound(bin) / bytes >= m_options.cached_size_cutoff_factor)
+      {
+        break;
+      }
+
+      oversized_block_descriptor_ptr best;
+      std::size_t best_size = 0;
+
+      oversized_block_descriptor_ptr ptr = m_cached_bins[bin];
+      while (oversized_block_ptr_traits::get(ptr))
+      {
+        oversized_block_descriptor desc = *ptr;
+        if (is_good_cached_fit(desc, bytes, alignment) && (best_size == 0 || desc.size < best_size))
+        {
+          best      = ptr;
+          best_size = desc.size;
+
+          if (bin != requested_bin || desc.size == bytes)
+          {
+            break;
+          }
+        }
+
+        ptr = desc.next_cached;
+      }
+
+      if (oversized_block_ptr_traits::get(best))
+      {
+        return best;
+      }
+    }
+
+    return oversized_block_descriptor_ptr();
+  }
+
+  void link_cached_oversized(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    std::size_t bin = size_class_bitmap::size_class(desc.size);
+    oversized_block_descriptor_ptr& head = thrust::raw_reference_cast(m_cached_bins[bin]);
+
+    desc.prev_cached  = oversized_block_descriptor_ptr();
+    desc.next_cached  = head;
+    desc.newer_cached = oversized_block_descriptor_ptr();
+    desc.older_cached = m_cached_newest;
+    desc.cached_epoch = m_oversized_epoch;
+
+    if (oversized_block_ptr_traits::get(desc.next_cached))
+    {
+      thrust::raw_reference_cast(*desc.next_cached).prev_cached = block;
+    }
+    head = block;
+    m_nonempty_bins.set(bin);
+
+    if (oversized_block_ptr_traits::get(desc.older_cached))
+    {
+      thrust::raw_reference_cast(*desc.older_cached).newer_cached = block;
+    }
+    else
+    {
+      m_cached_oldest = block;
+    }
+    m_cached_newest = block;
+
+    m_cached_bytes += desc.size;
+  }
+
+  void unlink_cached_oversized(oversized_block_descriptor& desc)
+  {
+    std::size_t bin = size_class_bitmap::size_class(desc.size);
+
+    if (oversized_block_ptr_traits::get(desc.prev_cached))
+    {
+      thrust::raw_reference_cast(*desc.prev_cached).next_cached = desc.next_cached;
+    }
+    else
+    {
+      thrust::raw_reference_cast(m_cached_bins[bin]) = desc.next_cached;
+      if (!oversized_block_ptr_traits::get(desc.next_cached))
+      {
+        m_nonempty_bins.reset(bin);
+      }
+    }
+
+    if (oversized_block_ptr_traits::get(desc.next_cached))
+    {
+      thrust::raw_reference_cast(*desc.next_cached).prev_cached = desc.prev_cached;
+    }
+
+    if (oversized_block_ptr_traits::get(desc.newer_cached))
+    {
+      thrust::raw_reference_cast(*desc.newer_cached).older_cached = desc.older_cached;
+    }
+    else
+    {
+      m_cached_newest = desc.older_cached;
+    }
+
+    if (oversized_block_ptr_traits::get(desc.older_cached))
+    {
+      thrust::raw_reference_cast(*desc.older_cached).newer_cached = desc.newer_cached;
+    }
+    else
+    {
+      m_cached_oldest = desc.newer_cached;
+    }
+
+    desc.prev_cached  = oversized_block_descriptor_ptr();
+    desc.next_cached  = oversized_block_descriptor_ptr();
+    desc.newer_cached = oversized_block_descriptor_ptr();
+    desc.older_cached = oversized_block_descriptor_ptr();
+
+    m_cached_bytes -= desc.size;
+  }
+
+  void unlink_oversized(const oversized_block_descriptor& desc)
+  {
+    if (oversized_block_ptr_traits::get(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = desc.next;
+    }
+    else
+    {
+      m_oversized = desc.next;
+    }
+
+    if (oversized_block_ptr_traits::get(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+    }
+  }
+
+  // returns the least recently cached block to upstream
+  void release_oldest_cached_oversized()
+  {
+    oversized_block_descriptor_ptr block = m_cached_oldest;
+    oversized_block_descriptor desc      = *block;
+
+    unlink_cached_oversized(desc);
+    unlink_oversized(desc);
+
+    void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - desc.size);
+    upstream_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+  }
 
 public:
+  /*! Returns the statistics of the allocations served by the pool and of the memory it allocated from upstream.
+   */
+  pool_statistics statistics() const
+  {
+    pool_statistics ret        = m_statistics;
+    ret.cached_oversized_bytes = m_cached_bytes;
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      pool p = m_pools[i];
+      bucket_statistics bucket;
+      bucket.block_size = static_cast<std::size_t>(1) << (m_smallest_block_log2 + i);
+      bucket.hits       = p.hits;
+      bucket.misses     = p.misses;
+      ret.buckets.push_back(bucket);
+    }
+
+    return ret;
+  }
+
+  /*! Zeroes the counters in the statistics of the pool. The memory currently in use is still accounted for.
+   */
+  void reset_statistics()
+  {
+    m_statistics.requests.reset();
+    m_statistics.upstream.reset();
+    m_statistics.oversized_cache_hits   = 0;
+    m_statistics.oversized_cache_misses = 0;
+
+    for (std::size_t i = 0; i < m_pools.size(); ++i)
+    {
+      thrust::raw_reference_cast(m_pools[i]).hits   = 0;
+      thrust::raw_reference_cast(m_pools[i]).misses = 0;
+    }
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -236,8 +489,7 @@ public:
 
       void_ptr p = static_cast<void_ptr>(
         static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
-      m_upstream->do_deallocate(
-        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+      upstream_deallocate(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
     }
 
     // deallocate cached oversized/overaligned memory
@@ -249,15 +501,26 @@ public:
       oversized_block_descriptor desc = thrust::raw_reference_cast(*alloc);
 
       void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - desc.current_size);
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      upstream_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+    }
+
+    for (std::size_t bin = m_nonempty_bins.next(0); bin < size_class_bitmap::class_count;
+         bin             = m_nonempty_bins.next(bin + 1))
+    {
+      thrust::raw_reference_cast(m_cached_bins[bin]) = oversized_block_descriptor_ptr();
     }
+    m_nonempty_bins.clear();
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    m_cached_newest = oversized_block_descriptor_ptr();
+    m_cached_oldest = oversized_block_descriptor_ptr();
+    m_cached_bytes  = 0;
   }
 
   _CCCL_NODISCARD virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    m_statistics.requests.record_allocation(bytes);
+
     bytes = (std::max)(bytes, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
@@ -266,85 +529,58 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
-        {
-          oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+        ++m_oversized_epoch;
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
+        // return the blocks that haven't been reused for too long to upstream
+        if (m_options.cached_oversized_max_idle != 0)
+        {
+          while (oversized_block_ptr_traits::get(m_cached_oldest)
+                 && m_oversized_epoch - thrust::raw_reference_cast(*m_cached_oldest).cached_epoch
+                      > m_options.cached_oversized_max_idle)
           {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
+            release_oldest_cached_oversized();
           }
+        }
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+        oversized_block_descriptor_ptr ptr = find_cached_oversized(bytes, alignment);
+        if (oversized_block_ptr_traits::get(ptr))
+        {
+          oversized_block_descriptor desc = *ptr;
+          unlink_cached_oversized(desc);
+
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          if (is_good)
+          if (bytes != desc.size)
           {
-            if (previous != &m_cached_oversized)
+            desc.current_size = bytes;
+
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (oversized_block_ptr_traits::get(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
-
-            *ptr = desc;
-
-            return static_cast<void_ptr>(ret);
           }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          *ptr = desc;
+
+          ++m_statistics.oversized_cache_hits;
+          return static_cast<void_ptr>(ret);
         }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
-      void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
+      ++m_statistics.oversized_cache_misses;
+      void_ptr allocated = upstream_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
       oversized_block_descriptor_ptr block =
         static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + bytes));
 
@@ -353,7 +589,11 @@ public:
       desc.alignment    = alignment;
       desc.prev         = oversized_block_descriptor_ptr();
       desc.next         = m_oversized;
+      desc.prev_cached  = oversized_block_descriptor_ptr();
       desc.next_cached  = oversized_block_descriptor_ptr();
+      desc.newer_cached = oversized_block_descriptor_ptr();
+      desc.older_cached = oversized_block_descriptor_ptr();
+      desc.cached_epoch = 0;
       desc.current_size = bytes;
       *block            = desc;
       m_oversized       = block;
@@ -380,6 +620,8 @@ public:
     // and split it into blocks pushed to the free list
     if (!detail::pointer_traits<block_descriptor_ptr>::get(bucket.free_list))
     {
+      ++bucket.misses;
+
       std::size_t n = bucket.previous_allocated_count;
       if (n == 0)
       {
@@ -407,7 +649,7 @@ public:
       block_size += m_options.alignment - block_size % m_options.alignment;
       std::size_t chunk_size = block_size * n;
 
-      void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+      void_ptr allocated = upstream_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
       chunk_descriptor_ptr chunk =
         static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
 
@@ -428,6 +670,10 @@ public:
         bucket.free_list = block;
       }
     }
+    else
+    {
+      ++bucket.hits;
+    }
 
     // allocate a block from the front of the bucket's free list
     block_descriptor_ptr block = bucket.free_list;
@@ -437,6 +683,8 @@ public:
 
   virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
+    m_statistics.requests.record_deallocation(n);
+
     n = (std::max)(n, m_options.smallest_block_size);
     assert(detail::is_power_of_2(alignment));
 
@@ -451,12 +699,14 @@ public:
 
       oversized_block_descriptor desc = *block;
       assert(desc.current_size == n);
-      assert(desc.alignment == alignment);
+      assert(desc.alignment >= alignment);
 
-      if (m_options.cache_oversized)
-      {
-        desc.next_cached = m_cached_oversized;
+      // blocks which alone exceed the limit of cached memory are never cached
+      bool cache = m_options.cache_oversized
+                && (m_options.max_cached_oversized_bytes == 0 || desc.size <= m_options.max_cached_oversized_bytes);
 
+      if (cache)
+      {
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -477,27 +727,24 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        link_cached_oversized(block, desc);
+        *block = desc;
 
-        return;
-      }
+        // keep the cached memory below the high-water mark, evicting the least recently cached blocks first
+        if (m_options.max_cached_oversized_bytes != 0)
+        {
+          while (m_cached_bytes > m_options.max_cached_oversized_bytes)
+          {
+            release_oldest_cached_oversized();
+          }
+        }
 
-      if (oversized_block_ptr_traits::get(desc.prev))
-      {
-        thrust::raw_reference_cast(*desc.prev).next = desc.next;
-      }
-      else
-      {
-        m_oversized = desc.next;
+        return;
       }
 
-      if (oversized_block_ptr_traits::get(desc.next))
-      {
-        thrust::raw_reference_cast(*desc.next).prev = desc.prev;
-      }
+      unlink_oversized(desc);
 
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      upstream_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
 
       return;
     }
@@ -98,6 +98,17 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The maximal total size of oversized and overaligned blocks kept in the cache. Whenever caching a block makes the
+   *      cache exceed it, the least recently cached blocks are returned to the upstream resource; blocks bigger than
+   *      this limit are never cached. 0 means no limit. Currently only respected by \p unsynchronized_pool_resource.
+   */
+  std::size_t max_cached_oversized_bytes;
+  /*! The number of oversized and overaligned allocations a cached block may stay unused for before it is returned to
+   *      the upstream resource. 0 means that cached blocks are kept until the pool is released. Currently only
+   *      respected by \p unsynchronized_pool_resource.
+   */
+  std::size_t cached_oversized_max_idle;
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consitent, false otherwise.
@@ -0,0 +1,299 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Allocation statistics of memory resources, and a memory resource adaptor collecting and tracing them.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Counters of the allocations and deallocations that went through a memory resource. Sizes are counted as passed to
+ *      \p allocate and \p deallocate.
+ */
+struct resource_statistics
+{
+  /*! The number of allocations. */
+  std::size_t allocations;
+  /*! The number of deallocations. */
+  std::size_t deallocations;
+  /*! The number of bytes currently allocated and not yet deallocated. */
+  std::size_t bytes_in_use;
+  /*! The highest value \p bytes_in_use has reached. */
+  std::size_t peak_bytes_in_use;
+  /*! The total number of bytes requested by all allocations. */
+  std::size_t total_bytes_allocated;
+
+  resource_statistics()
+      : allocations(0)
+      , deallocations(0)
+      , bytes_in_use(0)
+      , peak_bytes_in_use(0)
+      , total_bytes_allocated(0)
+  {}
+
+  /*! Records an allocation of \p bytes bytes. */
+  void record_allocation(std::size_t bytes)
+  {
+    ++allocations;
+    bytes_in_use += bytes;
+    total_bytes_allocated += bytes;
+    if (bytes_in_use > peak_bytes_in_use)
+    {
+      peak_bytes_in_use = bytes_in_use;
+    }
+  }
+
+  /*! Records a deallocation of \p bytes bytes. */
+  void record_deallocation(std::size_t bytes)
+  {
+    ++deallocations;
+    bytes_in_use -= bytes;
+  }
+
+  /*! Zeroes the counters. The memory currently in use is still accounted for, and becomes the new peak. */
+  void reset()
+  {
+    allocations           = 0;
+    deallocations         = 0;
+    peak_bytes_in_use     = bytes_in_use;
+    total_bytes_allocated = 0;
+  }
+};
+
+/*! Counters of a single pool of same sized blocks in a pooling memory resource.
+ */
+struct bucket_statistics
+{
+  /*! The size of the blocks in this pool. */
+  std::size_t block_size;
+  /*! The number of allocations served from blocks already held by the pool. */
+  std::size_t hits;
+  /*! The number of allocations which required a new chunk to be allocated from upstream. */
+  std::size_t misses;
+};
+
+/*! Statistics of a pooling memory resource, as returned by the \p statistics member function of the pool resources.
+ *      Allocations of the pool's own bookkeeping structures are not included in \p upstream.
+ */
+struct pool_statistics
+{
+  /*! Allocations and deallocations requested from the pool by its users. */
+  resource_statistics requests;
+  /*! Allocations and deallocations the pool requested from its upstream resource. */
+  resource_statistics upstream;
+
+  /*! The number of bytes in oversized and overaligned blocks currently held in the cache. */
+  std::size_t cached_oversized_bytes;
+  /*! The number of oversized or overaligned allocations served from the cache. */
+  std::size_t oversized_cache_hits;
+  /*! The number of oversized or overaligned allocations which had to be allocated from upstream. */
+  std::size_t oversized_cache_misses;
+
+  /*! Counters of the individual pools, from the smallest block size to the largest. */
+  std::vector<bucket_statistics> buckets;
+
+  pool_statistics()
+      : requests()
+      , upstream()
+      , cached_oversized_bytes(0)
+      , oversized_cache_hits(0)
+      , oversized_cache_misses(0)
+      , buckets()
+  {}
+};
+
+/*! Writes \p stats as a JSON object to \p os.
+ *
+ *  \param os the stream to write to
+ *  \param stats the statistics to write
+ *  \returns \p os
+ */
+inline std::ostream& write_json(std::ostream& os, const resource_statistics& stats)
+{
+  return os << "{\"allocations\": " << stats.allocations << ", \"deallocations\": " << stats.deallocations
+            << ", \"bytes_in_use\": " << stats.bytes_in_use << ", \"peak_bytes_in_use\": " << stats.peak_bytes_in_use
+            << ", \"total_bytes_allocated\": " << stats.total_bytes_allocated << "}";
+}
+
+/*! Writes \p stats as a JSON object to \p os.
+ *
+ *  \param os the stream to write to
+ *  \param stats the statistics to write
+ *  \returns \p os
+ */
+inline std::ostream& write_json(std::ostream& os, const pool_statistics& stats)
+{
+  os << "{\"requests\": ";
+  write_json(os, stats.requests);
+  os << ", \"upstream\": ";
+  write_json(os, stats.upstream);
+  os << ", \"cached_oversized_bytes\": " << stats.cached_oversized_bytes
+     << ", \"oversized_cache_hits\": " << stats.oversized_cache_hits
+     << ", \"oversized_cache_misses\": " << stats.oversized_cache_misses << ", \"buckets\": [";
+
+  for (std::size_t i = 0; i < stats.buckets.size(); ++i)
+  {
+    os << (i == 0 ? "" : ", ") << "{\"block_size\": " << stats.buckets[i].block_size
+       << ", \"hits\": " << stats.buckets[i].hits << ", \"misses\": " << stats.buckets[i].misses << "}";
+  }
+
+  return os << "]}";
+}
+
+/*! A single allocation or deallocation, as reported to the trace callback of \p statistics_resource.
+ */
+struct allocation_event
+{
+  /*! Whether this is an allocation or a deallocation. */
+  bool is_allocation;
+  /*! The raw address of the memory. */
+  void* pointer;
+  /*! The size of the memory, as passed to \p allocate or \p deallocate. */
+  std::size_t bytes;
+  /*! The alignment of the memory, as passed to \p allocate or \p deallocate. */
+  std::size_t alignment;
+};
+
+/*! A memory resource adaptor which forwards all requests to \p Upstream, counting them in a \p resource_statistics
+ *      object, and optionally reporting every single one of them to a callback.
+ *
+ *  The adaptor isn't synchronized; when shared between threads, it needs to be wrapped in a synchronizing adaptor, or
+ *      its upstream must be used only through a synchronized resource above it.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class statistics_resource final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+public:
+  typedef typename Upstream::pointer pointer;
+
+  /*! The type of the trace callback; its first argument is the \p user_data pointer passed to \p set_trace_callback.
+   */
+  typedef void (*trace_callback)(void*, const allocation_event&);
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   */
+  statistics_resource()
+      : m_upstream(get_global_resource<Upstream>())
+      , m_statistics()
+      , m_trace(NULL)
+      , m_trace_data(NULL)
+  {}
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   */
+  statistics_resource(Upstream* upstream)
+      : m_upstream(upstream)
+      , m_statistics()
+      , m_trace(NULL)
+      , m_trace_data(NULL)
+  {}
+
+  /*! Returns the statistics collected so far. */
+  const resource_statistics& statistics() const
+  {
+    return m_statistics;
+  }
+
+  /*! Zeroes the counters of the collected statistics, see \p resource_statistics::reset. */
+  void reset_statistics()
+  {
+    m_statistics.reset();
+  }
+
+  /*! Sets a callback invoked after every allocation and before every deallocation.
+   *
+   *  \param callback the callback to invoke, or \p NULL to stop tracing
+   *  \param user_data an arbitrary pointer passed back to the callback
+   */
+  void set_trace_callback(trace_callback callback, void* user_data = NULL)
+  {
+    m_trace      = callback;
+    m_trace_data = user_data;
+  }
+
+  _CCCL_NODISCARD virtual pointer
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    pointer p = m_upstream->do_allocate(bytes, alignment);
+    m_statistics.record_allocation(bytes);
+    trace(true, p, bytes, alignment);
+    return p;
+  }
+
+  virtual void do_deallocate(pointer p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    trace(false, p, bytes, alignment);
+    m_statistics.record_deallocation(bytes);
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+private:
+  void trace(bool is_allocation, pointer p, std::size_t bytes, std::size_t alignment)
+  {
+    if (m_trace)
+    {
+      allocation_event event;
+      event.is_allocation = is_allocation;
+      event.pointer       = static_cast<void*>(thrust::detail::pointer_traits<pointer>::get(p));
+      event.bytes         = bytes;
+      event.alignment     = alignment;
+      m_trace(m_trace_data, event);
+    }
+  }
+
+  Upstream* m_upstream;
+  resource_statistics m_statistics;
+  trace_callback m_trace;
+  void* m_trace_data;
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
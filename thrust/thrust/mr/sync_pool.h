@@ -82,6 +82,22 @@ public:
       : upstream_pool(get_global_resource<Upstream>(), options)
   {}
 
+  /*! Returns the statistics of the allocations served by the pool and of the memory it allocated from upstream.
+   */
+  pool_statistics statistics() const
+  {
+    lock_t lock(mtx);
+    return upstream_pool.statistics();
+  }
+
+  /*! Zeroes the counters in the statistics of the pool. The memory currently in use is still accounted for.
+   */
+  void reset_statistics()
+  {
+    lock_t lock(mtx);
+    upstream_pool.reset_statistics();
+  }
+
   /*! Releases all held memory to upstream.
    */
   void release()
@@ -104,7 +120,7 @@ public:
   }
 
 private:
-  std::mutex mtx;
+  mutable std::mutex mtx;
   unsync_pool upstream_pool;
 };
 
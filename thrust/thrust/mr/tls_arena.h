@@ -0,0 +1,115 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tls_arena.h
+ *  \brief A function wrapping a thread local instance of a \p unsynchronized_arena_resource, and a memory resource
+ *  forwarding to it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp11_required.h>
+#include <thrust/mr/arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_management Memory Management
+ *  \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_resources
+ *  \{
+ */
+
+/*! Potentially constructs, if not yet created, and then returns the address of a thread-local \p
+ * unsynchronized_arena_resource,
+ *
+ *  \tparam Upstream the template argument to the arena template
+ *  \param upstream the argument to the constructor, if invoked
+ */
+template <typename Upstream>
+_CCCL_HOST thrust::mr::unsynchronized_arena_resource<Upstream>& tls_arena(Upstream* upstream = NULL)
+{
+  static thread_local thrust::mr::unsynchronized_arena_resource<Upstream> arena((assert(upstream), upstream));
+
+  return arena;
+}
+
+/*! Releases the memory held by the \p tls_arena of the calling thread, for example after an unusually large algorithm
+ *      run by a long lived worker thread. Nothing allocated from that arena may be live at that point. Every thread
+ *      has its own arena, so this has to be called by each thread whose memory should be released.
+ *
+ *  \tparam Upstream the template argument to the arena template
+ *  \param upstream the argument to the constructor of the arena, if it doesn't exist yet
+ */
+template <typename Upstream>
+_CCCL_HOST void release_tls_arena(Upstream* upstream = get_global_resource<Upstream>())
+{
+  tls_arena(upstream).release();
+}
+
+/*! A memory resource which serves every allocation from the \p tls_arena of the calling thread. The object itself
+ *      holds no memory, so a single instance can be shared by all threads, as long as each allocation is deallocated
+ *      by the thread which allocated it.
+ *
+ *  \tparam Upstream the template argument to the arena template
+ */
+template <typename Upstream>
+class tls_arena_resource final : public memory_resource<typename Upstream::pointer>
+{
+public:
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource of the arenas, if they are created through this resource
+   */
+  tls_arena_resource(Upstream* upstream)
+      : m_upstream(upstream)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   */
+  tls_arena_resource()
+      : m_upstream(get_global_resource<Upstream>())
+  {}
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    return tls_arena(m_upstream).do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    tls_arena(m_upstream).do_deallocate(p, bytes, alignment);
+  }
+
+private:
+  Upstream* m_upstream;
+};
+
+/*! \}
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -755,6 +755,1087 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op);
 
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c equal_to
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys using the \p thrust::host execution policy for parallelization.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(thrust::host, A, A + N, B, C, D);
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c equal_to
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(A, A + N, B, C, D);
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *  Keys that are equal under \c binary_pred must have equal hashes and be
+ *  equivalent under \c operator<, use the version which takes a \c comp
+ *  ordering otherwise.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys using the \p thrust::host execution policy for parallelization.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(thrust::host, A, A + N, B, C, D, thrust::equal_to<int>());
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c plus to reduce values with equal keys.
+ *  Keys that are equal under \c binary_pred must have equal hashes and be
+ *  equivalent under \c operator<, use the version which takes a \c comp
+ *  ordering otherwise.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(A, A + N, B, C, D, thrust::equal_to<int>());
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys.
+ *  Keys that are equal under \c binary_pred must have equal hashes and be
+ *  equivalent under \c operator<, use the version which takes a \c comp
+ *  ordering otherwise.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>. \tparam
+ * BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary
+ * Function</a> and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys using the \p thrust::host execution policy for parallelization.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(thrust::host, A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>());
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output. The input does not need to be sorted, which saves
+ *  the <tt>sort_by_key</tt> that \p reduce_by_key would otherwise require.
+ *
+ *  The host systems (\p cpp, \p omp and \p tbb) accumulate the values in
+ *  hash tables, which takes linear expected time and is most effective when
+ *  the number of distinct keys is small compared to the input. The keys are
+ *  hashed with <tt>std::hash</tt>, and tuples of such keys, like the keys of a
+ *  \p zip_iterator, combine the hashes of their elements. Keys that compare
+ *  equal must have equal hashes. Other systems, and the host systems for keys
+ *  without a hash, sort a copy of the input by key, which additionally
+ *  requires the keys to be \c LessThanComparable.
+ *
+ *  The order of the output keys is unspecified. The host systems emit them in
+ *  the order of their first occurrence in the input.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys.
+ *  Keys that are equal under \c binary_pred must have equal hashes and be
+ *  equivalent under \c operator<, use the version which takes a \c comp
+ *  ordering otherwise.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>. \tparam
+ * BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary
+ * Function</a> and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of equal keys.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1}; // input keys
+ *  int B[N] = {9, 8, 7, 6, 5, 4, 3}; // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(A, A + N, B, C, D, thrust::equal_to<int>(), thrust::plus<int>());
+ *
+ *  // The first three keys in C are now {1, 3, 2} and new_end.first - C is 3.
+ *  // The first three values in D are now {12, 21, 9} and new_end.second - D is 3.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys. It
+ *  groups the keys by sorting a copy of the input with \c comp on every
+ *  system, so \c binary_pred may be coarser than the equality of the keys, for
+ *  instance comparing only a part of them. \c comp has to be consistent with
+ *  \c binary_pred: keys are equal under \c binary_pred exactly when neither is
+ *  ordered before the other by \c comp.
+ *
+ *  The order of the output keys is unspecified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \param comp The comparison operator used to group the keys.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>. \tparam
+ * BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary
+ * Function</a> and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type. \tparam
+ * StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/named_req/Compare">Strict Weak
+ * Ordering</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of keys with equal last digits using the \p thrust::host execution policy for parallelization.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  struct equal_mod_10
+ *  {
+ *    __host__ __device__ bool operator()(int x, int y) const { return x % 10 == y % 10; }
+ *  };
+ *
+ *  struct less_mod_10
+ *  {
+ *    __host__ __device__ bool operator()(int x, int y) const { return x % 10 < y % 10; }
+ *  };
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {3, 13, 5, 23, 15, 4}; // input keys
+ *  int B[N] = {1, 2, 3, 4, 5, 6};    // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(thrust::host, A, A + N, B, C, D, equal_mod_10(), thrust::plus<int>(), less_mod_10());
+ *
+ *  // new_end.first - C is 3; the keys 3, 4 and 5 stand for their groups in C, in some order,
+ *  // with the values 7, 6 and 8 at the same positions in D.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  StrictWeakOrdering comp);
+
+/*! \p reduce_by_key_unsorted is a variant of \p reduce_by_key which groups
+ *  all equal keys in the range <tt>[keys_first, keys_last)</tt>, not only
+ *  consecutive ones. For each distinct key, \p reduce_by_key_unsorted copies
+ *  the key to \c keys_output and the reduction of all values associated with
+ *  it to \c values_output.
+ *
+ *  This version of \p reduce_by_key_unsorted uses the function object \c binary_pred
+ *  to test for equality and \c binary_op to reduce values with equal keys. It
+ *  groups the keys by sorting a copy of the input with \c comp on every
+ *  system, so \c binary_pred may be coarser than the equality of the keys, for
+ *  instance comparing only a part of them. \c comp has to be consistent with
+ *  \c binary_pred: keys are equal under \c binary_pred exactly when neither is
+ *  ordered before the other by \c comp.
+ *
+ *  The order of the output keys is unspecified.
+ *
+ *  \param keys_first The beginning of the input key range.
+ *  \param keys_last  The end of the input key range.
+ *  \param values_first The beginning of the input value range.
+ *  \param keys_output The beginning of the output key range.
+ *  \param values_output The beginning of the output value range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \param binary_op The binary function used to accumulate values.
+ *  \param comp The comparison operator used to group the keys.
+ *  \return A pair of iterators at end of the ranges <tt>[keys_output, keys_output_last)</tt> and <tt>[values_output,
+ * values_output_last)</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a>, \tparam InputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input Iterator</a>, \tparam OutputIterator1 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator1's \c value_type is convertible to \c OutputIterator1's \c value_type. \tparam OutputIterator2 is a
+ * model of <a href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and and \p
+ * InputIterator2's \c value_type is convertible to \c OutputIterator2's \c value_type. \tparam BinaryPredicate is a
+ * model of <a href="https://en.cppreference.com/w/cpp/named_req/BinaryPredicate">Binary Predicate</a>. \tparam
+ * BinaryFunction is a model of <a href="https://en.cppreference.com/w/cpp/utility/functional/binary_function">Binary
+ * Function</a> and \c BinaryFunction's \c result_type is convertible to \c OutputIterator2's \c value_type. \tparam
+ * StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/named_req/Compare">Strict Weak
+ * Ordering</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p reduce_by_key_unsorted to
+ *  sum the values of keys with equal last digits.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  struct equal_mod_10
+ *  {
+ *    __host__ __device__ bool operator()(int x, int y) const { return x % 10 == y % 10; }
+ *  };
+ *
+ *  struct less_mod_10
+ *  {
+ *    __host__ __device__ bool operator()(int x, int y) const { return x % 10 < y % 10; }
+ *  };
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {3, 13, 5, 23, 15, 4}; // input keys
+ *  int B[N] = {1, 2, 3, 4, 5, 6};    // input values
+ *  int C[N];                         // output keys
+ *  int D[N];                         // output values
+ *
+ *  thrust::pair<int*,int*> new_end;
+ *  new_end = thrust::reduce_by_key_unsorted(A, A + N, B, C, D, equal_mod_10(), thrust::plus<int>(), less_mod_10());
+ *
+ *  // new_end.first - C is 3; the keys 3, 4 and 5 stand for their groups in C, in some order,
+ *  // with the values 7, 6 and 8 at the same positions in D.
+ *  \endcode
+ *
+ *  \see reduce_by_key
+ *  \see sort_by_key
+ */
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the sum of the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \c 0 for an empty segment.
+ *
+ *  This is equivalent to, and avoids expanding the offsets to a key per
+ *  element for, \p reduce_by_key.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of
+ *  every reduction and \c plus as the reduction operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and if \c x
+ * and \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to
+ * \p RandomAccessIterator's \c value_type.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  sum three segments of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(thrust::host, A, A + N, offsets, offsets + 4, sums);
+ *  // sums is now {3, 0, 18}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the sum of the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \c 0 for an empty segment.
+ *
+ *  This version of \p segmented_reduce uses \c 0 as the initial value of
+ *  every reduction and \c plus as the reduction operator.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and if \c x
+ * and \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to
+ * \p RandomAccessIterator's \c value_type.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  sum three segments of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(A, A + N, offsets, offsets + 4, sums);
+ *  // sums is now {3, 0, 18}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the sum of \p init and the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \p init for an empty segment.
+ *
+ *  This version of \p segmented_reduce uses \c plus as the reduction operator.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and if \c x
+ * and \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to
+ * \p T.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p T is
+ * convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is convertible to \p RandomAccessIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  sum three segments of a sequence of integers with an initial value using
+ *  the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(thrust::host, A, A + N, offsets, offsets + 4, sums, 1);
+ *  // sums is now {4, 1, 19}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the sum of \p init and the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \p init for an empty segment.
+ *
+ *  This version of \p segmented_reduce uses \c plus as the reduction operator.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \param init The initial value of every reduction.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and if \c x
+ * and \c y are objects of \p RandomAccessIterator's \c value_type, then <tt>x + y</tt> is defined and is convertible to
+ * \p T.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p T is
+ * convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is convertible to \p RandomAccessIterator's \c value_type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  sum three segments of a sequence of integers with an initial value.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int sums[3];
+ *  thrust::segmented_reduce(A, A + N, offsets, offsets + 4, sums, 1);
+ *  // sums is now {4, 1, 19}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator, typename T>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the reduction with \p binary_op of \p init and the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \p init for an empty segment. As with \p reduce, \p binary_op is
+ *  assumed to be associative, and the order of the reductions within a
+ *  segment is unspecified.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to reduce the values.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p T is
+ * convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ * convertible to \p BinaryFunction's \c first_argument_type and \c second_argument_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \c T.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  find the maximum of three segments of a sequence of integers using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int maxima[3];
+ *  thrust::segmented_reduce(thrust::host, A, A + N, offsets, offsets + 4, maxima, -1, thrust::maximum<int>());
+ *  // maxima is now {2, -1, 6}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
+/*! \p segmented_reduce reduces each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, <tt>*(result + i)</tt> is
+ *  assigned the reduction with \p binary_op of \p init and the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt>, which
+ *  is \p init for an empty segment. As with \p reduce, \p binary_op is
+ *  assumed to be associative, and the order of the reductions within a
+ *  segment is unspecified.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param result The beginning of the output sequence, which receives one value per segment.
+ *  \param init The initial value of every reduction.
+ *  \param binary_op The binary function used to reduce the values.
+ *  \return The end of the output sequence, <tt>result + (offsets_last - offsets_first - 1)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \c T.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p T is
+ * convertible to \p OutputIterator's \c value_type.
+ *  \tparam T is a model of <a href="https://en.cppreference.com/w/cpp/named_req/CopyAssignable">Assignable</a>, and is
+ * convertible to \p BinaryFunction's \c first_argument_type and \c second_argument_type.
+ *  \tparam BinaryFunction The function's return type must be convertible to \c T.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_reduce to
+ *  find the maximum of three segments of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/reduce.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 2, 3, 4, 5, 6};
+ *  int offsets[4] = {0, 2, 2, 6};
+ *  int maxima[3];
+ *  thrust::segmented_reduce(A, A + N, offsets, offsets + 4, maxima, -1, thrust::maximum<int>());
+ *  // maxima is now {2, -1, 6}
+ *  \endcode
+ *
+ *  \see reduce
+ *  \see reduce_by_key
+ *  \see segmented_sort
+ */
+template <typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
 /*! \} // end reductions
  */
 
@@ -0,0 +1,404 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file run_length.h
+ *  \brief Run-length encoding and decoding of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \p run_length_encode compresses every run of consecutive equal elements in
+ *  the range <tt>[first, last)</tt> to its value and its length. The value of
+ *  the <tt>i</tt>th run is assigned to <tt>*(values_output + i)</tt> and its
+ *  length to <tt>*(counts_output + i)</tt>. Two consecutive elements belong
+ *  to the same run if they compare equal with \c operator==.
+ *
+ *  This computes the same result as \p reduce_by_key with the input as the
+ *  keys and a \p constant_iterator of \c 1 as the values, like
+ *  <tt>cub::DeviceRunLengthEncode::Encode</tt>. The host systems encode in
+ *  linear time without temporary storage proportional to the input.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at the end of the ranges <tt>[values_output, values_output_last)</tt>
+ *          and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a> and is
+ *          convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to
+ *  compress a sequence of characters using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 8;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'a'};
+ *  char values[N];
+ *  int counts[N];
+ *
+ *  thrust::pair<char*, int*> end = thrust::run_length_encode(thrust::host, input, input + N, values, counts);
+ *
+ *  // end.first - values is now 4
+ *  // values is now {'a', 'b', 'c', 'a'}
+ *  // counts is now {2, 1, 3, 2}
+ *  \endcode
+ *
+ *  \see run_length_encode_non_trivial_runs
+ *  \see run_length_decode
+ *  \see reduce_by_key
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output);
+
+/*! \p run_length_encode compresses every run of consecutive equal elements in
+ *  the range <tt>[first, last)</tt> to its value and its length. The value of
+ *  the <tt>i</tt>th run is assigned to <tt>*(values_output + i)</tt> and its
+ *  length to <tt>*(counts_output + i)</tt>. Two consecutive elements belong
+ *  to the same run if they compare equal with \c operator==.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param values_output The beginning of the output sequence of run values.
+ *  \param counts_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at the end of the ranges <tt>[values_output, values_output_last)</tt>
+ *          and <tt>[counts_output, counts_output_last)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a> and is
+ *          convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam OutputIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The input range shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_encode to
+ *  compress a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  int input[8] = {7, 7, 1, 3, 3, 3, 7, 7};
+ *  thrust::device_vector<int> d_input(input, input + 8);
+ *  thrust::device_vector<int> d_values(8);
+ *  thrust::device_vector<int> d_counts(8);
+ *
+ *  thrust::run_length_encode(d_input.begin(), d_input.end(), d_values.begin(), d_counts.begin());
+ *
+ *  // d_values is now {7, 1, 3, 7, ...}
+ *  // d_counts is now {2, 1, 3, 2, ...}
+ *  \endcode
+ *
+ *  \see run_length_encode_non_trivial_runs
+ *  \see run_length_decode
+ *  \see reduce_by_key
+ */
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  RandomAccessIterator first, RandomAccessIterator last, OutputIterator1 values_output, OutputIterator2 counts_output);
+
+/*! \p run_length_encode_non_trivial_runs finds every run of at least two
+ *  consecutive equal elements in the range <tt>[first, last)</tt>. The offset
+ *  of the first element of the <tt>i</tt>th such run relative to \p first is
+ *  assigned to <tt>*(offsets_output + i)</tt> and its length to
+ *  <tt>*(lengths_output + i)</tt>. Runs of a single element are skipped. Two
+ *  consecutive elements belong to the same run if they compare equal with
+ *  \c operator==.
+ *
+ *  This is the equivalent of <tt>cub::DeviceRunLengthEncode::NonTrivialRuns</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_output The beginning of the output sequence of run offsets.
+ *  \param lengths_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt>
+ *          and <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  The following code snippet demonstrates how to use
+ *  \p run_length_encode_non_trivial_runs to find the repeated elements of a
+ *  sequence of characters using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 8;
+ *  char input[N] = {'a', 'a', 'b', 'c', 'c', 'c', 'a', 'd'};
+ *  int offsets[N];
+ *  int lengths[N];
+ *
+ *  thrust::run_length_encode_non_trivial_runs(thrust::host, input, input + N, offsets, lengths);
+ *
+ *  // offsets is now {0, 3}
+ *  // lengths is now {2, 3}
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output);
+
+/*! \p run_length_encode_non_trivial_runs finds every run of at least two
+ *  consecutive equal elements in the range <tt>[first, last)</tt>. The offset
+ *  of the first element of the <tt>i</tt>th such run relative to \p first is
+ *  assigned to <tt>*(offsets_output + i)</tt> and its length to
+ *  <tt>*(lengths_output + i)</tt>. Runs of a single element are skipped. Two
+ *  consecutive elements belong to the same run if they compare equal with
+ *  \c operator==.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param offsets_output The beginning of the output sequence of run offsets.
+ *  \param lengths_output The beginning of the output sequence of run lengths.
+ *  \return A pair of iterators at the end of the ranges <tt>[offsets_output, offsets_output_last)</tt>
+ *          and <tt>[lengths_output, lengths_output_last)</tt>.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c value_type is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/concepts/equality_comparable">Equality Comparable</a>.
+ *  \tparam OutputIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator1's \c value_type.
+ *  \tparam OutputIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator's \c difference_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  The following code snippet demonstrates how to use
+ *  \p run_length_encode_non_trivial_runs to find the repeated elements of a
+ *  sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  int input[8] = {7, 7, 1, 3, 3, 3, 7, 4};
+ *  thrust::device_vector<int> d_input(input, input + 8);
+ *  thrust::device_vector<int> d_offsets(8);
+ *  thrust::device_vector<int> d_lengths(8);
+ *
+ *  thrust::run_length_encode_non_trivial_runs(
+ *    d_input.begin(), d_input.end(), d_offsets.begin(), d_lengths.begin());
+ *
+ *  // d_offsets is now {0, 3, ...}
+ *  // d_lengths is now {2, 3, ...}
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output);
+
+/*! \} // end reductions
+ */
+
+/*! \addtogroup copying
+ *  \{
+ */
+
+/*! \p run_length_decode expands the runs described by the values
+ *  <tt>[values_first, values_last)</tt> and the lengths starting at
+ *  \p counts_first. The <tt>i</tt>th value is copied
+ *  <tt>*(counts_first + i)</tt> times, and the copies of all values are
+ *  written one after another to the range beginning at \p result. It is the
+ *  inverse of \p run_length_encode.
+ *
+ *  The host systems write every element of the output once and need no
+ *  temporary storage proportional to the output.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param values_first The beginning of the sequence of run values.
+ *  \param values_last The end of the sequence of run values.
+ *  \param counts_first The beginning of the sequence of run lengths.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator1's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The lengths shall not be negative.
+ *  \pre The output range shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_decode to
+ *  expand runs of characters using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  char values[4] = {'a', 'b', 'c', 'a'};
+ *  int counts[4]  = {2, 1, 3, 0};
+ *  char output[6];
+ *
+ *  char* end = thrust::run_length_decode(thrust::host, values, values + 4, counts, output);
+ *
+ *  // end - output is now 6
+ *  // output is now {'a', 'a', 'b', 'c', 'c', 'c'}
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator run_length_decode(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result);
+
+/*! \p run_length_decode expands the runs described by the values
+ *  <tt>[values_first, values_last)</tt> and the lengths starting at
+ *  \p counts_first. The <tt>i</tt>th value is copied
+ *  <tt>*(counts_first + i)</tt> times, and the copies of all values are
+ *  written one after another to the range beginning at \p result. It is the
+ *  inverse of \p run_length_encode.
+ *
+ *  \param values_first The beginning of the sequence of run values.
+ *  \param values_last The end of the sequence of run values.
+ *  \param counts_first The beginning of the sequence of run lengths.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator1's \c value_type is convertible to \p OutputIterator's \c value_type.
+ *  \tparam RandomAccessIterator2 is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ *          \p RandomAccessIterator2's \c value_type is an integral type.
+ *  \tparam OutputIterator is a model of <a
+ *          href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *
+ *  \pre The lengths shall not be negative.
+ *  \pre The output range shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p run_length_decode to
+ *  expand runs of integers.
+ *
+ *  \code
+ *  #include <thrust/run_length.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  int values[4] = {7, 1, 3, 7};
+ *  int counts[4] = {2, 1, 3, 2};
+ *  thrust::device_vector<int> d_values(values, values + 4);
+ *  thrust::device_vector<int> d_counts(counts, counts + 4);
+ *  thrust::device_vector<int> d_output(8);
+ *
+ *  thrust::run_length_decode(d_values.begin(), d_values.end(), d_counts.begin(), d_output.begin());
+ *
+ *  // d_output is now {7, 7, 1, 3, 3, 3, 7, 7}
+ *  \endcode
+ *
+ *  \see run_length_encode
+ */
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator run_length_decode(
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result);
+
+/*! \} // end copying
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/run_length.inl>
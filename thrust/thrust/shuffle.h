@@ -178,6 +178,93 @@ _CCCL_HOST_DEVICE void shuffle_copy(
 template <typename RandomIterator, typename OutputIterator, typename URBG>
 _CCCL_HOST_DEVICE void shuffle_copy(RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g);
 
+/*! \p sample selects <tt>min(k, last - first)</tt> distinct elements of <tt>[first, last)</tt>
+ *  uniformly at random, without replacement, and writes them to the range beginning at
+ *  \p result. The selected elements are the first ones of the permutation by which
+ *  \p shuffle_copy would reorder <tt>[first, last)</tt> with an equal random engine, so
+ *  they are written in random order, and every subset of \p k elements is equally likely.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence to sample.
+ *  \param last The end of the sequence to sample.
+ *  \param result Destination of the sample
+ *  \param k The number of elements to select.
+ *  \param g A UniformRandomBitGenerator
+ *  \return The end of the sample, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomIterator is a random access iterator
+ *  \tparam OutputIterator is a model of <a
+ *  href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam Size is an integral type.
+ *  \tparam URBG is a uniform random bit generator
+ *
+ *  The following code snippet demonstrates how to use \p sample to select three of ten elements
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/shuffle.h>
+ *  #include <thrust/random.h>
+ *  #include <thrust/execution_policy.h>
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  int result[3];
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::default_random_engine g;
+ *  thrust::sample(thrust::host, A, A + N, result, 3, g);
+ *  // result is now {6, 5, 8}
+ *  \endcode
+ *
+ *  \see \p shuffle_copy
+ */
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator sample(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g);
+
+/*! \p sample selects <tt>min(k, last - first)</tt> distinct elements of <tt>[first, last)</tt>
+ *  uniformly at random, without replacement, and writes them to the range beginning at
+ *  \p result. The selected elements are the first ones of the permutation by which
+ *  \p shuffle_copy would reorder <tt>[first, last)</tt> with an equal random engine, so
+ *  they are written in random order, and every subset of \p k elements is equally likely.
+ *
+ *  \param first The beginning of the sequence to sample.
+ *  \param last The end of the sequence to sample.
+ *  \param result Destination of the sample
+ *  \param k The number of elements to select.
+ *  \param g A UniformRandomBitGenerator
+ *  \return The end of the sample, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam RandomIterator is a random access iterator
+ *  \tparam OutputIterator is a model of <a
+ *  href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>.
+ *  \tparam Size is an integral type.
+ *  \tparam URBG is a uniform random bit generator
+ *
+ *  The following code snippet demonstrates how to use \p sample to select three of ten elements.
+ *
+ *  \code
+ *  #include <thrust/shuffle.h>
+ *  #include <thrust/random.h>
+ *  int A[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+ *  int result[3];
+ *  const int N = sizeof(A)/sizeof(int);
+ *  thrust::default_random_engine g;
+ *  thrust::sample(A, A + N, result, 3, g);
+ *  // result is now {6, 5, 8}
+ *  \endcode
+ *
+ *  \see \p shuffle_copy
+ */
+template <typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator
+sample(RandomIterator first, RandomIterator last, OutputIterator result, Size k, URBG&& g);
+
 THRUST_NAMESPACE_END
 
 #include <thrust/detail/shuffle.inl>
@@ -0,0 +1,460 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file soa_vector.h
+ *  \brief A dynamically-sizable container which stores the members of its
+ *         tuple elements in separate arrays.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/contiguous_storage.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/integer_sequence.h>
+
+#include <cstddef>
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes Container Classes
+ *  \{
+ */
+
+/*! A \p soa_vector is a container of tuples which keeps the elements of
+ *  every member of its tuples, its columns, in an array of their own. This
+ *  structure of arrays layout lets algorithms which access only some of the
+ *  members read only the memory of those, and lets compilers vectorize loops
+ *  over the columns, while the container is used like a vector of tuples:
+ *  its iterators are \p zip_iterators over the columns and all columns grow
+ *  and shrink together.
+ *
+ *  All columns of a \p soa_vector live in a single allocation of \p Alloc,
+ *  and every column begins at an address which is a multiple of
+ *  \p column_alignment bytes.
+ *
+ *  \tparam Tuple A \p thrust::tuple<Ts...> which gives the types of the columns.
+ *  \tparam Alloc The allocator used to allocate the columns. It is rebound to
+ *          every column type to construct and destroy the elements.
+ *
+ *  The following code snippet demonstrates how to sort the points of a
+ *  \p soa_vector by their keys.
+ *
+ *  \code
+ *  #include <thrust/soa_vector.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::soa_vector<thrust::tuple<int, float, float>> points;
+ *
+ *  points.push_back(thrust::make_tuple(3, 0.5f, 1.5f));
+ *  points.push_back(thrust::make_tuple(1, 2.5f, 3.5f));
+ *  points.push_back(thrust::make_tuple(2, 4.5f, 5.5f));
+ *
+ *  thrust::sort(points.begin(), points.end());
+ *
+ *  // points.column<0>() is now {1, 2, 3}
+ *  // points.column<1>() is now {2.5f, 4.5f, 0.5f}
+ *  \endcode
+ *
+ *  \see zip_iterator
+ *  \see host_vector
+ *  \see device_vector
+ */
+template <typename Tuple, typename Alloc = std::allocator<unsigned char>>
+class soa_vector;
+
+/*! \cond
+ */
+
+template <typename... Ts, typename Alloc>
+class soa_vector<thrust::tuple<Ts...>, Alloc>
+{
+  static_assert(sizeof...(Ts) > 0, "soa_vector requires at least one column");
+
+private:
+  typedef thrust::detail::allocator_traits<Alloc> alloc_traits;
+  typedef typename alloc_traits::template rebind_alloc<unsigned char> byte_allocator;
+  typedef thrust::detail::contiguous_storage<unsigned char, byte_allocator> storage_type;
+  typedef thrust::make_index_sequence<sizeof...(Ts)> column_indices;
+
+public:
+  // typedefs
+  typedef thrust::tuple<Ts...> value_type;
+  typedef typename storage_type::size_type size_type;
+  typedef typename storage_type::difference_type difference_type;
+  typedef Alloc allocator_type;
+
+  template <std::size_t I>
+  using column_type = typename thrust::tuple_element<I, value_type>::type;
+
+  template <std::size_t I>
+  using column_allocator = typename alloc_traits::template rebind_alloc<column_type<I>>;
+
+  template <std::size_t I>
+  using column_pointer = typename alloc_traits::template rebind_traits<column_type<I>>::pointer;
+
+  template <std::size_t I>
+  using const_column_pointer = typename alloc_traits::template rebind_traits<column_type<I>>::const_pointer;
+
+  typedef thrust::zip_iterator<thrust::tuple<typename alloc_traits::template rebind_traits<Ts>::pointer...>> iterator;
+  typedef thrust::zip_iterator<thrust::tuple<typename alloc_traits::template rebind_traits<Ts>::const_pointer...>>
+    const_iterator;
+
+  typedef typename thrust::iterator_reference<iterator>::type reference;
+  typedef typename thrust::iterator_reference<const_iterator>::type const_reference;
+
+  /*! The alignment in bytes of the beginning of every column. This is the
+   *  size of a cache line and of the widest vector registers of current CPUs.
+   */
+  static constexpr size_type column_alignment = 64;
+
+  /*! This constructor creates an empty soa_vector.
+   *  \param alloc The allocator to use by this soa_vector.
+   */
+  explicit soa_vector(const Alloc& alloc = Alloc());
+
+  /*! This constructor creates a soa_vector with default-constructed
+   *  elements.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this soa_vector.
+   */
+  explicit soa_vector(size_type n, const Alloc& alloc = Alloc());
+
+  /*! This constructor creates a soa_vector with copies
+   *  of an exemplar element.
+   *  \param n The number of elements to initially create.
+   *  \param value An element to copy.
+   *  \param alloc The allocator to use by this soa_vector.
+   */
+  soa_vector(size_type n, const value_type& value, const Alloc& alloc = Alloc());
+
+  /*! Copy constructor copies from an exemplar soa_vector.
+   *  \param v The soa_vector to copy.
+   */
+  soa_vector(const soa_vector& v);
+
+  /*! Move constructor moves from another soa_vector.
+   *  \param v The soa_vector to move.
+   */
+  soa_vector(soa_vector&& v);
+
+  /*! Copy assign operator copies from an exemplar soa_vector.
+   *  \param v The soa_vector to copy.
+   */
+  soa_vector& operator=(const soa_vector& v);
+
+  /*! Move assign operator moves from another soa_vector.
+   *  \param v The soa_vector to move.
+   */
+  soa_vector& operator=(soa_vector&& v);
+
+  /*! The destructor erases the elements.
+   */
+  ~soa_vector();
+
+  /*! \brief Resizes this soa_vector to the specified number of elements.
+   *  \param new_size Number of elements this soa_vector should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this soa_vector to the specified number of
+   *  elements. If the number is smaller than this soa_vector's current
+   *  size this soa_vector is truncated, otherwise this soa_vector is
+   *  extended and new default-constructed elements are appended.
+   */
+  void resize(size_type new_size);
+
+  /*! \brief Resizes this soa_vector to the specified number of elements.
+   *  \param new_size Number of elements this soa_vector should contain.
+   *  \param x Data with which new elements should be populated.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this soa_vector to the specified number of
+   *  elements. If the number is smaller than this soa_vector's current
+   *  size this soa_vector is truncated, otherwise this soa_vector is
+   *  extended and new elements are populated with given data.
+   */
+  void resize(size_type new_size, const value_type& x);
+
+  /*! Returns the number of elements in this soa_vector.
+   */
+  size_type size() const;
+
+  /*! Returns the size() of the largest possible soa_vector.
+   *  \return The largest possible return value of size().
+   */
+  size_type max_size() const;
+
+  /*! \brief If n is less than or equal to capacity(), this call has no effect.
+   *         Otherwise, this method is a request for allocation of additional memory
+   *         for all columns. If the request is successful, then capacity() is greater
+   *         than or equal to n; otherwise, capacity() is unchanged. In either case,
+   *         size() is unchanged.
+   *  \throw std::length_error If n exceeds max_size().
+   */
+  void reserve(size_type n);
+
+  /*! Returns the number of elements which have been reserved in this
+   *  soa_vector.
+   */
+  size_type capacity() const;
+
+  /*! This method shrinks the capacity of this soa_vector to exactly
+   *  fit its elements.
+   */
+  void shrink_to_fit();
+
+  /*! \brief Subscript access to the data contained in this soa_vector.
+   *  \param n The index of the element for which data should be accessed.
+   *  \return A tuple of references to the members of the element at index \p n.
+   */
+  reference operator[](size_type n);
+
+  /*! \brief Subscript read access to the data contained in this soa_vector.
+   *  \param n The index of the element for which data should be accessed.
+   *  \return A tuple of const references to the members of the element at index \p n.
+   */
+  const_reference operator[](size_type n) const;
+
+  /*! This method returns a zip_iterator pointing to the beginning of
+   *  this soa_vector.
+   *  \return iterator
+   */
+  iterator begin();
+
+  /*! This method returns a const_iterator pointing to the beginning
+   *  of this soa_vector.
+   *  \return const_iterator
+   */
+  const_iterator begin() const;
+
+  /*! This method returns a const_iterator pointing to the beginning
+   *  of this soa_vector.
+   *  \return const_iterator
+   */
+  const_iterator cbegin() const;
+
+  /*! This method returns an iterator pointing to one element past the
+   *  last of this soa_vector.
+   *  \return begin() + size().
+   */
+  iterator end();
+
+  /*! This method returns a const_iterator pointing to one element past the
+   *  last of this soa_vector.
+   *  \return begin() + size().
+   */
+  const_iterator end() const;
+
+  /*! This method returns a const_iterator pointing to one element past the
+   *  last of this soa_vector.
+   *  \return begin() + size().
+   */
+  const_iterator cend() const;
+
+  /*! This method returns a tuple of references to the first element of this soa_vector.
+   *  \return The first element of this soa_vector.
+   */
+  reference front();
+
+  /*! This method returns a tuple of const references to the first element of this soa_vector.
+   *  \return The first element of this soa_vector.
+   */
+  const_reference front() const;
+
+  /*! This method returns a tuple of references to the last element of this soa_vector.
+   *  \return The last element of this soa_vector.
+   */
+  reference back();
+
+  /*! This method returns a tuple of const references to the last element of this soa_vector.
+   *  \return The last element of this soa_vector.
+   */
+  const_reference back() const;
+
+  /*! This method returns a pointer to the first element of column \p I. The
+   *  column holds size() elements and its address is a multiple of
+   *  column_alignment.
+   *  \tparam I The index of the column.
+   *  \return A pointer to the first element of column \p I.
+   */
+  template <std::size_t I>
+  column_pointer<I> column();
+
+  /*! This method returns a const pointer to the first element of column \p I.
+   *  \tparam I The index of the column.
+   *  \return A const pointer to the first element of column \p I.
+   */
+  template <std::size_t I>
+  const_column_pointer<I> column() const;
+
+  /*! This method resizes this soa_vector to 0.
+   */
+  void clear();
+
+  /*! This method returns true iff size() == 0.
+   *  \return true if size() == 0; false, otherwise.
+   */
+  bool empty() const;
+
+  /*! This method appends the given element to the end of this soa_vector.
+   *  \param x The element to append.
+   */
+  void push_back(const value_type& x);
+
+  /*! This method erases the last element of this soa_vector, invalidating
+   *  all iterators and references to it.
+   */
+  void pop_back();
+
+  /*! This method swaps the contents of this soa_vector with another soa_vector.
+   *  \param v The soa_vector with which to swap.
+   */
+  void swap(soa_vector& v);
+
+  /*! This method returns a copy of this soa_vector's allocator.
+   *  \return A copy of the allocator used by this soa_vector.
+   */
+  allocator_type get_allocator() const;
+
+private:
+  // the storage of the columns
+  storage_type m_storage;
+
+  // the number of elements
+  size_type m_size;
+
+  // the number of elements for which every column has room
+  size_type m_capacity;
+
+  // returns the number of bytes column I of a storage with room for
+  // capacity elements takes, padded to column_alignment
+  template <std::size_t I>
+  static size_type column_bytes(size_type capacity);
+
+  // returns the offset of column I from the aligned beginning of a storage
+  // with room for capacity elements
+  template <std::size_t I>
+  static size_type column_offset(size_type capacity);
+
+  // returns the number of bytes to allocate for capacity elements. This
+  // includes the slack needed to align the first column.
+  static size_type storage_bytes(size_type capacity);
+
+  // returns the beginning of column I of storage
+  template <std::size_t I>
+  static column_pointer<I> column_in(storage_type& storage, size_type capacity);
+
+  template <std::size_t I>
+  static const_column_pointer<I> column_in(const storage_type& storage, size_type capacity);
+
+  // moves the elements to storage with room for new_capacity elements
+  void reallocate(size_type new_capacity);
+
+  // returns the capacity to grow to such that at least n elements fit
+  size_type grown_capacity(size_type n) const;
+
+  template <std::size_t... Is>
+  iterator make_iterator(size_type n, thrust::index_sequence<Is...>);
+
+  template <std::size_t... Is>
+  const_iterator make_iterator(size_type n, thrust::index_sequence<Is...>) const;
+
+  // these apply their operation to the elements [first, first + n) of column I
+  template <std::size_t I>
+  void default_construct_column(size_type first, size_type n);
+
+  template <std::size_t I>
+  void fill_construct_column(size_type first, size_type n, const column_type<I>& x);
+
+  template <std::size_t I>
+  void destroy_column(size_type first, size_type n);
+
+  template <std::size_t I>
+  void destroy_column_in(storage_type& storage, size_type capacity, size_type first, size_type n);
+
+  // copy constructs the first n elements of column I of from_storage into
+  // column I of to_storage
+  template <std::size_t I>
+  void copy_construct_column(
+    const storage_type& from_storage,
+    size_type from_capacity,
+    storage_type& to_storage,
+    size_type to_capacity,
+    size_type n);
+
+  // these apply the operations above to all columns
+  template <std::size_t... Is>
+  void default_construct_columns(size_type first, size_type n, thrust::index_sequence<Is...>);
+
+  template <std::size_t... Is>
+  void fill_construct_columns(size_type first, size_type n, const value_type& x, thrust::index_sequence<Is...>);
+
+  template <std::size_t... Is>
+  void destroy_columns(size_type first, size_type n, thrust::index_sequence<Is...>);
+
+  // destroys the elements [first, first + n) of the first count columns of
+  // storage, to undo one of the operations above which threw part way through
+  template <std::size_t... Is>
+  void destroy_first_columns(
+    storage_type& storage,
+    size_type capacity,
+    size_type first,
+    size_type n,
+    std::size_t count,
+    thrust::index_sequence<Is...>);
+
+  template <std::size_t... Is>
+  void copy_construct_columns(
+    const storage_type& from_storage,
+    size_type from_capacity,
+    storage_type& to_storage,
+    size_type to_capacity,
+    size_type n,
+    thrust::index_sequence<Is...>);
+};
+
+/*! \endcond
+ */
+
+/*! Exchanges the values of two soa_vectors.
+ *  \p x The first \p soa_vector of interest.
+ *  \p y The second \p soa_vector of interest.
+ */
+template <typename Tuple, typename Alloc>
+void swap(soa_vector<Tuple, Alloc>& a, soa_vector<Tuple, Alloc>& b)
+{
+  a.swap(b);
+}
+
+/*! \} // end container_classes
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/soa_vector.inl>
@@ -905,6 +905,999 @@ void stable_sort_by_key(RandomAccessIterator1 keys_first,
                         RandomAccessIterator2 values_first,
                         StrictWeakOrdering comp);
 
+/*! \p nth_element partially sorts the elements in <tt>[first, last)</tt>
+ *  such that the element pointed to by \p nth is the element which would be
+ *  there if <tt>[first, last)</tt> were sorted, no element of
+ *  <tt>[first, nth)</tt> is greater than \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is less than it. The order of the elements on
+ *  either side of \p nth is unspecified. If \p nth is \p last, \p nth_element
+ *  has no effect.
+ *
+ *  Selecting an element takes linear time on average, which is cheaper than
+ *  sorting the whole range when only one rank or a few ranks are of interest.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence of integers using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::nth_element(thrust::host, A, A + 3, A + N);
+ *  // A[3] is now 4
+ *  // A[0], A[1] and A[2] are {1, 2, 3} in unspecified order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last);
+
+/*! \p nth_element partially sorts the elements in <tt>[first, last)</tt>
+ *  such that the element pointed to by \p nth is the element which would be
+ *  there if <tt>[first, last)</tt> were sorted, no element of
+ *  <tt>[first, nth)</tt> is greater than \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is less than it. The order of the elements on
+ *  either side of \p nth is unspecified. If \p nth is \p last, \p nth_element
+ *  has no effect.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::nth_element(A, A + 3, A + N);
+ *  // A[3] is now 4
+ *  // A[0], A[1] and A[2] are {1, 2, 3} in unspecified order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename RandomAccessIterator>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last);
+
+/*! \p nth_element partially sorts the elements in <tt>[first, last)</tt>
+ *  such that the element pointed to by \p nth is the element which would be
+ *  there if <tt>[first, last)</tt> were sorted with \p comp, and no element
+ *  of <tt>[first, nth)</tt> is ordered after \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is ordered before it. The order of the elements on
+ *  either side of \p nth is unspecified. If \p nth is \p last, \p nth_element
+ *  has no effect.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the third largest of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::nth_element(thrust::host, A, A + 2, A + N, thrust::greater<int>());
+ *  // A[2] is now 5
+ *  // A[0] and A[1] are {6, 7} in unspecified order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+/*! \p nth_element partially sorts the elements in <tt>[first, last)</tt>
+ *  such that the element pointed to by \p nth is the element which would be
+ *  there if <tt>[first, last)</tt> were sorted with \p comp, and no element
+ *  of <tt>[first, nth)</tt> is ordered after \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is ordered before it. The order of the elements on
+ *  either side of \p nth is unspecified. If \p nth is \p last, \p nth_element
+ *  has no effect.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the third largest of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::nth_element(A, A + 2, A + N, thrust::greater<int>());
+ *  // A[2] is now 5
+ *  // A[0] and A[1] are {6, 7} in unspecified order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(
+  RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, StrictWeakOrdering comp);
+
+/*! \p partial_sort rearranges the elements in <tt>[first, last)</tt> such
+ *  that <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest
+ *  elements in ascending order. The order of the elements in
+ *  <tt>[middle, last)</tt> is unspecified. \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to
+ *  sort the three smallest of a sequence of integers using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + N);
+ *  // A[0], A[1] and A[2] are now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last);
+
+/*! \p partial_sort rearranges the elements in <tt>[first, last)</tt> such
+ *  that <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest
+ *  elements in ascending order. The order of the elements in
+ *  <tt>[middle, last)</tt> is unspecified. \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to
+ *  sort the three smallest of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::partial_sort(A, A + 3, A + N);
+ *  // A[0], A[1] and A[2] are now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator>
+void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last);
+
+/*! \p partial_sort rearranges the elements in <tt>[first, last)</tt> such
+ *  that <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements
+ *  which are ordered first by \p comp, sorted by \p comp. The order of the
+ *  elements in <tt>[middle, last)</tt> is unspecified. \p partial_sort is not
+ *  stable.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to
+ *  sort the three largest of a sequence of integers in descending order using
+ *  the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + N, thrust::greater<int>());
+ *  // A[0], A[1] and A[2] are now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+/*! \p partial_sort rearranges the elements in <tt>[first, last)</tt> such
+ *  that <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements
+ *  which are ordered first by \p comp, sorted by \p comp. The order of the
+ *  elements in <tt>[middle, last)</tt> is unspecified. \p partial_sort is not
+ *  stable.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the range to sort.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to
+ *  sort the three largest of a sequence of integers in descending order.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  thrust::partial_sort(A, A + 3, A + N, thrust::greater<int>());
+ *  // A[0], A[1] and A[2] are now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(
+  RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, StrictWeakOrdering comp);
+
+/*! \p partial_sort_copy copies the smallest elements of <tt>[first, last)</tt>
+ *  to <tt>[result_first, result_last)</tt> in ascending order. The number of
+ *  elements copied is the smaller of <tt>last - first</tt> and
+ *  <tt>result_last - result_first</tt>. The input range is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return The end of the sorted output, <tt>result_first + min(last - first, result_last - result_first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy
+ *  to copy the three smallest of a sequence of integers using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  int *end = thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 3);
+ *  // B is now {1, 2, 3} and end is B + 3
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last);
+
+/*! \p partial_sort_copy copies the smallest elements of <tt>[first, last)</tt>
+ *  to <tt>[result_first, result_last)</tt> in ascending order. The number of
+ *  elements copied is the smaller of <tt>last - first</tt> and
+ *  <tt>result_last - result_first</tt>. The input range is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return The end of the sorted output, <tt>result_first + min(last - first, result_last - result_first)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy
+ *  to copy the three smallest of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  int *end = thrust::partial_sort_copy(A, A + N, B, B + 3);
+ *  // B is now {1, 2, 3} and end is B + 3
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename InputIterator, typename RandomAccessIterator>
+RandomAccessIterator partial_sort_copy(
+  InputIterator first, InputIterator last, RandomAccessIterator result_first, RandomAccessIterator result_last);
+
+/*! \p partial_sort_copy copies the elements of <tt>[first, last)</tt> which
+ *  are ordered first by \p comp to <tt>[result_first, result_last)</tt>,
+ *  sorted by \p comp. The number of elements copied is the smaller of
+ *  <tt>last - first</tt> and <tt>result_last - result_first</tt>. The input
+ *  range is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the sorted output, <tt>result_first + min(last - first, result_last - result_first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy
+ *  to copy the three largest of a sequence of integers in descending order
+ *  using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 3, thrust::greater<int>());
+ *  // B is now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp);
+
+/*! \p partial_sort_copy copies the elements of <tt>[first, last)</tt> which
+ *  are ordered first by \p comp to <tt>[result_first, result_last)</tt>,
+ *  sorted by \p comp. The number of elements copied is the smaller of
+ *  <tt>last - first</tt> and <tt>result_last - result_first</tt>. The input
+ *  range is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the sorted output, <tt>result_first + min(last - first, result_last - result_first)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy
+ *  to copy the three largest of a sequence of integers in descending order.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::partial_sort_copy(A, A + N, B, B + 3, thrust::greater<int>());
+ *  // B is now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp);
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt>, or
+ *  all of them if there are fewer than \p k, to the range beginning at
+ *  \p result in descending order. The input range is not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator>, so
+ *  <tt>top_k(first, last, k, result)</tt> is equivalent to
+ *  <tt>partial_sort_copy(first, last, result, result + k, thrust::greater<T>())</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is comparable with \c operator>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three largest of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::top_k(thrust::host, A, A + N, 3, B);
+ *  // B is now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p nth_element
+ */
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result);
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt>, or
+ *  all of them if there are fewer than \p k, to the range beginning at
+ *  \p result in descending order. The input range is not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator>, so
+ *  <tt>top_k(first, last, k, result)</tt> is equivalent to
+ *  <tt>partial_sort_copy(first, last, result, result + k, thrust::greater<T>())</tt>.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the output sequence, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is comparable with \c operator>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three largest of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::top_k(A, A + N, 3, B);
+ *  // B is now {7, 6, 5}
+ *  \endcode
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p nth_element
+ */
+template <typename InputIterator, typename Size, typename RandomAccessIterator>
+RandomAccessIterator top_k(InputIterator first, InputIterator last, Size k, RandomAccessIterator result);
+
+/*! \p top_k copies the \p k elements of <tt>[first, last)</tt> which are
+ *  ordered first by \p comp, or all of them if there are fewer than \p k, to
+ *  the range beginning at \p result, sorted by \p comp. The input range is
+ *  not modified.
+ *
+ *  This version of \p top_k compares objects using a function object
+ *  \p comp. Note that \p comp orders the selected elements first, so
+ *  \c thrust::greater selects the largest elements and \c thrust::less the
+ *  smallest.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the output sequence, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three smallest of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::top_k(thrust::host, A, A + N, 3, B, thrust::less<int>());
+ *  // B is now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p nth_element
+ */
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result,
+  StrictWeakOrdering comp);
+
+/*! \p top_k copies the \p k elements of <tt>[first, last)</tt> which are
+ *  ordered first by \p comp, or all of them if there are fewer than \p k, to
+ *  the range beginning at \p result, sorted by \p comp. The input range is
+ *  not modified.
+ *
+ *  This version of \p top_k compares objects using a function object
+ *  \p comp. Note that \p comp orders the selected elements first, so
+ *  \c thrust::greater selects the largest elements and \c thrust::less the
+ *  smallest.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the output sequence, <tt>result + min(k, last - first)</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/input_iterator">Input
+ * Iterator</a> and \c InputIterator's \c value_type is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The input and output ranges shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three smallest of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 6, 3, 7, 2, 4};
+ *  int B[3];
+ *  thrust::top_k(A, A + N, 3, B, thrust::less<int>());
+ *  // B is now {1, 2, 3}
+ *  \endcode
+ *
+ *  \see \p partial_sort_copy
+ *  \see \p nth_element
+ */
+template <typename InputIterator, typename Size, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator
+top_k(InputIterator first, InputIterator last, Size k, RandomAccessIterator result, StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt> are
+ *  sorted into ascending order. Elements which belong to no segment are not
+ *  modified. Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This is equivalent to, and avoids the memory traffic of, sorting the
+ *  elements by pairs of segment index and value.
+ *
+ *  This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to
+ *  sort three segments of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {3, 1, 2, 9, 5, 7, 4};
+ *  int offsets[4] = {0, 3, 3, 7};
+ *  thrust::segmented_sort(thrust::host, A, A + N, offsets, offsets + 4);
+ *  // A is now {1, 2, 3, 4, 5, 7, 9}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_reduce
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last);
+
+/*! \p segmented_sort sorts each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt> are
+ *  sorted into ascending order. Elements which belong to no segment are not
+ *  modified. Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a>.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to
+ *  sort three segments of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {3, 1, 2, 9, 5, 7, 4};
+ *  int offsets[4] = {0, 3, 3, 7};
+ *  thrust::segmented_sort(A, A + N, offsets, offsets + 4);
+ *  // A is now {1, 2, 3, 4, 5, 7, 9}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_reduce
+ */
+template <typename RandomAccessIterator, typename OffsetIterator>
+void segmented_sort(
+  RandomAccessIterator first, RandomAccessIterator last, OffsetIterator offsets_first, OffsetIterator offsets_last);
+
+/*! \p segmented_sort sorts each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt> are
+ *  sorted by \p comp. Elements which belong to no segment are not modified.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort compares objects using a function
+ *  object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to
+ *  sort two segments of a sequence of integers in descending order using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {3, 1, 2, 9, 5, 7, 4};
+ *  int offsets[3] = {0, 3, 7};
+ *  thrust::segmented_sort(thrust::host, A, A + N, offsets, offsets + 3, thrust::greater<int>());
+ *  // A is now {3, 2, 1, 9, 7, 5, 4}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_reduce
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  StrictWeakOrdering comp);
+
+/*! \p segmented_sort sorts each of a sequence of segments of
+ *  <tt>[first, last)</tt> independently. The segments are described by the
+ *  offsets <tt>[offsets_first, offsets_last)</tt>: for every \c i in
+ *  <tt>[0, offsets_last - offsets_first - 1)</tt>, the elements in
+ *  <tt>[first + offsets_first[i], first + offsets_first[i + 1])</tt> are
+ *  sorted by \p comp. Elements which belong to no segment are not modified.
+ *  Note: \c segmented_sort is not guaranteed to be stable.
+ *
+ *  This version of \p segmented_sort compares objects using a function
+ *  object \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param offsets_first The beginning of the segment offsets.
+ *  \param offsets_last The end of the segment offsets.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type.
+ *  \tparam OffsetIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * OffsetIterator's \c value_type is an integral type.
+ *  \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The offsets shall be in ascending order and no greater than <tt>last - first</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p segmented_sort to
+ *  sort two segments of a sequence of integers in descending order.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {3, 1, 2, 9, 5, 7, 4};
+ *  int offsets[3] = {0, 3, 7};
+ *  thrust::segmented_sort(A, A + N, offsets, offsets + 3, thrust::greater<int>());
+ *  // A is now {3, 2, 1, 9, 7, 5, 4}
+ *  \endcode
+ *
+ *  \see \p sort
+ *  \see \p segmented_reduce
+ */
+template <typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+void segmented_sort(RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OffsetIterator offsets_first,
+                    OffsetIterator offsets_last,
+                    StrictWeakOrdering comp);
+
 /*! \} // end sorting
  */
 
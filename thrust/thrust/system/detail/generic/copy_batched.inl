@@ -0,0 +1,143 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/generic/copy_batched.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+// copies the element at a position of the concatenation of all buffers, which
+// it finds by a binary search over the ends of the buffers
+template <typename InputBufferIterator, typename OutputBufferIterator, typename RandomAccessIterator, typename Size>
+struct copy_buffer_element
+{
+  typedef typename thrust::iterator_value<InputBufferIterator>::type input_iterator;
+  typedef typename thrust::iterator_value<OutputBufferIterator>::type output_iterator;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type offset_type;
+
+  InputBufferIterator input_buffers;
+  OutputBufferIterator output_buffers;
+  RandomAccessIterator buffer_ends_first;
+  Size num_buffers;
+
+  _CCCL_HOST_DEVICE copy_buffer_element(
+    InputBufferIterator input_buffers,
+    OutputBufferIterator output_buffers,
+    RandomAccessIterator buffer_ends_first,
+    Size num_buffers)
+      : input_buffers(input_buffers)
+      , output_buffers(output_buffers)
+      , buffer_ends_first(buffer_ends_first)
+      , num_buffers(num_buffers)
+  {}
+
+  _CCCL_HOST_DEVICE void operator()(offset_type i) const
+  {
+    // find the first buffer which ends after i
+    Size lo = 0;
+    Size hi = num_buffers - 1;
+
+    while (lo < hi)
+    {
+      const Size mid = lo + (hi - lo) / 2;
+
+      if (static_cast<offset_type>(buffer_ends_first[mid]) <= i)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    const offset_type buffer_end = buffer_ends_first[lo];
+    const offset_type size       = lo == 0 ? buffer_end : buffer_end - buffer_ends_first[lo - 1];
+    const offset_type offset     = i - (buffer_end - size);
+
+    const input_iterator first   = input_buffers[lo];
+    const output_iterator result = output_buffers[lo];
+
+    result[offset] = first[offset];
+  }
+};
+
+} // end namespace detail
+
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+_CCCL_HOST_DEVICE void copy_batched(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size num_buffers)
+{
+  typedef typename thrust::iterator_value<SizeIterator>::type offset_type;
+  typedef typename thrust::detail::temporary_array<offset_type, DerivedPolicy>::iterator buffer_end_iterator;
+
+  if (num_buffers <= 0)
+  {
+    return;
+  }
+
+  // the end of every buffer in the concatenation of all buffers is an
+  // inclusive scan of the sizes
+  thrust::detail::temporary_array<offset_type, DerivedPolicy> buffer_ends(exec, num_buffers);
+  thrust::inclusive_scan(exec, sizes, sizes + num_buffers, buffer_ends.begin());
+
+  const offset_type n = buffer_ends[num_buffers - 1];
+
+  // every element searches for its buffer, so the work is balanced however
+  // the elements are distributed among the buffers
+  thrust::for_each(
+    exec,
+    thrust::counting_iterator<offset_type>(0),
+    thrust::counting_iterator<offset_type>(n),
+    detail::copy_buffer_element<InputBufferIterator, OutputBufferIterator, buffer_end_iterator, Size>(
+      input_buffers, output_buffers, buffer_ends.begin(), num_buffers));
+} // end copy_batched()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -60,7 +60,13 @@ for_each_n(thrust::execution_policy<DerivedPolicy>&, InputIterator first, Size,
   return first;
 } // end for_each_n()
 
+template <typename DerivedPolicy, typename Extents, typename Function>
+_CCCL_HOST_DEVICE void
+for_each_index(thrust::execution_policy<DerivedPolicy>& exec, const Extents& extents, Function f);
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
 THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/for_each.inl>
@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/system/detail/generic/for_each.h>
+#include <thrust/type_traits/integer_sequence.h>
+
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace for_each_index_detail
+{
+
+// recovers the multidimensional index from its row major linear index
+template <typename Extents, typename Function>
+struct linear_index_functor
+{
+  typedef typename Extents::index_type index_type;
+
+  Extents extents;
+
+  // mutable because Function::operator() might be non-const
+  mutable Function f;
+
+  _CCCL_HOST_DEVICE linear_index_functor(const Extents& extents, Function f)
+      : extents(extents)
+      , f(f)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <::cuda::std::size_t... Rs>
+  _CCCL_HOST_DEVICE void apply(const index_type* idx, thrust::index_sequence<Rs...>) const
+  {
+    f(idx[Rs]...);
+  }
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE void operator()(Size linear) const
+  {
+    index_type idx[Extents::rank() + 1];
+    index_type remainder = static_cast<index_type>(linear);
+
+    for (::cuda::std::size_t r = Extents::rank(); r-- > 0;)
+    {
+      idx[r] = remainder % extents.extent(r);
+      remainder /= extents.extent(r);
+    }
+
+    apply(idx, thrust::make_index_sequence<Extents::rank()>());
+  }
+};
+
+} // namespace for_each_index_detail
+
+template <typename DerivedPolicy, typename Extents, typename Function>
+_CCCL_HOST_DEVICE void
+for_each_index(thrust::execution_policy<DerivedPolicy>& exec, const Extents& extents, Function f)
+{
+  typedef typename Extents::index_type index_type;
+
+  index_type n = 1;
+  for (::cuda::std::size_t r = 0; r < Extents::rank(); ++r)
+  {
+    n *= extents.extent(r);
+  }
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<index_type>(0),
+                     n,
+                     for_each_index_detail::linear_index_functor<Extents, Function>(extents, f));
+} // end for_each_index()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
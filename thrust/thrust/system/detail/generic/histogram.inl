@@ -0,0 +1,139 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram_bins.h>
+#include <thrust/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+// systems without a specialized histogram sort the bin indices of the samples
+// and find the boundaries between the bins with a vectorized binary search
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinIndex>
+_CCCL_HOST_DEVICE OutputIterator histogram_by_sorting(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  BinIndex bin_index)
+{
+  typedef typename thrust::system::detail::internal::histogram_counter<InputIterator, OutputIterator>::type
+    counter_type;
+
+  thrust::detail::temporary_array<int, DerivedPolicy> bins(exec, thrust::distance(first, last));
+  thrust::transform(exec, first, last, bins.begin(), bin_index);
+  thrust::sort(exec, bins.begin(), bins.end());
+
+  // cumulative[i] is the number of samples in the bins below i. Samples which
+  // are out of range were mapped to num_bins, so they are never counted.
+  thrust::detail::temporary_array<counter_type, DerivedPolicy> cumulative(exec, num_bins + 1);
+  thrust::lower_bound(exec,
+                      bins.begin(),
+                      bins.end(),
+                      thrust::counting_iterator<int>(0),
+                      thrust::counting_iterator<int>(num_bins + 1),
+                      cumulative.begin());
+
+  return thrust::transform(
+    exec, cumulative.begin() + 1, cumulative.end(), cumulative.begin(), histogram, thrust::minus<counter_type>());
+} // end histogram_by_sorting()
+
+} // end namespace detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return detail::histogram_by_sorting(
+    exec,
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return detail::histogram_by_sorting(
+    exec,
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator>(levels_first, num_bins));
+} // end histogram_range()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -52,6 +52,45 @@ _CCCL_HOST_DEVICE T reduce(
   T init,
   BinaryFunction binary_op);
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op);
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
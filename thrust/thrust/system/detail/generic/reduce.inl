@@ -26,11 +26,14 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/seq.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/detail/generic/reduce.h>
+#include <thrust/transform.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -67,6 +70,103 @@ _CCCL_HOST_DEVICE OutputType reduce(
   return OutputType();
 } // end reduce()
 
+namespace segmented_reduce_detail
+{
+
+// reduces the segment with the given index sequentially
+template <typename RandomAccessIterator, typename OffsetIterator, typename T, typename BinaryFunction>
+struct reduce_segment
+{
+  RandomAccessIterator first;
+  OffsetIterator offsets_first;
+  T init;
+  BinaryFunction binary_op;
+
+  _CCCL_HOST_DEVICE
+  reduce_segment(RandomAccessIterator first, OffsetIterator offsets_first, T init, BinaryFunction binary_op)
+      : first(first)
+      , offsets_first(offsets_first)
+      , init(init)
+      , binary_op(binary_op)
+  {}
+
+  template <typename Size>
+  _CCCL_HOST_DEVICE T operator()(Size i) const
+  {
+    return thrust::reduce(thrust::seq, first + offsets_first[i], first + offsets_first[i + 1], init, binary_op);
+  }
+};
+
+} // end namespace segmented_reduce_detail
+
+template <typename ExecutionPolicy, typename RandomAccessIterator, typename OffsetIterator, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type InputType;
+
+  // use InputType(0) as init by default
+  return thrust::segmented_reduce(exec, first, last, offsets_first, offsets_last, result, InputType(0));
+} // end segmented_reduce()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init)
+{
+  // use plus<T> by default
+  return thrust::segmented_reduce(exec, first, last, offsets_first, offsets_last, result, init, thrust::plus<T>());
+} // end segmented_reduce()
+
+template <typename ExecutionPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return result;
+  }
+
+  // one thread per segment
+  return thrust::transform(
+    exec,
+    thrust::counting_iterator<segment_index>(0),
+    thrust::counting_iterator<segment_index>(num_segments),
+    result,
+    segmented_reduce_detail::reduce_segment<RandomAccessIterator, OffsetIterator, T, BinaryFunction>(
+      first, offsets_first, init, binary_op));
+} // end segmented_reduce()
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
@@ -31,11 +31,13 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/type_traits/function_traits.h>
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/detail/minimum_system.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/scatter.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
 #include <limits>
@@ -185,6 +187,119 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, thrust::plus<T>());
 } // end reduce_by_key()
 
+template <typename ExecutionPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<InputIterator2>::type ValueType;
+  typedef typename thrust::iterator_traits<InputIterator1>::difference_type difference_type;
+
+  // group the keys by sorting a copy of the input, comp makes the keys that are equal under
+  // binary_pred consecutive
+  difference_type n = thrust::distance(keys_first, keys_last);
+
+  thrust::detail::temporary_array<KeyType, ExecutionPolicy> keys(exec, keys_first, n);
+  thrust::detail::temporary_array<ValueType, ExecutionPolicy> values(exec, values_first, n);
+
+  thrust::stable_sort_by_key(exec, keys.begin(), keys.end(), values.begin(), comp);
+
+  return thrust::reduce_by_key(
+    exec, keys.begin(), keys.end(), values.begin(), keys_output, values_output, binary_pred, binary_op);
+} // end reduce_by_key_unsorted()
+
+template <typename ExecutionPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  // systems without a hash based implementation sort with less<KeyType>, which binary_pred has to
+  // be consistent with
+  return thrust::reduce_by_key_unsorted(
+    exec,
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op,
+    thrust::less<KeyType>());
+} // end reduce_by_key_unsorted()
+
+template <typename ExecutionPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+
+  // use equal_to<KeyType> as default BinaryPredicate
+  return thrust::reduce_by_key_unsorted(
+    exec, keys_first, keys_last, values_first, keys_output, values_output, thrust::equal_to<KeyType>());
+} // end reduce_by_key_unsorted()
+
+template <typename ExecutionPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key_unsorted(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  typedef typename thrust::detail::eval_if<thrust::detail::is_output_iterator<OutputIterator2>::value,
+                                           thrust::iterator_value<InputIterator2>,
+                                           thrust::iterator_value<OutputIterator2>>::type T;
+
+  // use plus<T> as default BinaryFunction
+  return thrust::reduce_by_key_unsorted(
+    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, thrust::plus<T>());
+} // end reduce_by_key_unsorted()
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/generic/run_length.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace detail
+{
+
+struct is_non_trivial_run
+{
+  template <typename Size>
+  _CCCL_HOST_DEVICE bool operator()(const Size& length) const
+  {
+    return length > 1;
+  }
+};
+
+// maps a position of the decoded output to the value of the run which covers
+// it, by a binary search over the ends of the runs
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+struct decoded_value
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type count_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  RandomAccessIterator1 values_first;
+  RandomAccessIterator2 run_ends_first;
+  difference_type num_runs;
+
+  _CCCL_HOST_DEVICE
+  decoded_value(RandomAccessIterator1 values_first, RandomAccessIterator2 run_ends_first, difference_type num_runs)
+      : values_first(values_first)
+      , run_ends_first(run_ends_first)
+      , num_runs(num_runs)
+  {}
+
+  _CCCL_HOST_DEVICE value_type operator()(count_type i) const
+  {
+    // find the first run which ends after i
+    difference_type lo = 0;
+    difference_type hi = num_runs - 1;
+
+    while (lo < hi)
+    {
+      const difference_type mid = lo + (hi - lo) / 2;
+
+      if (static_cast<count_type>(run_ends_first[mid]) <= i)
+      {
+        lo = mid + 1;
+      }
+      else
+      {
+        hi = mid;
+      }
+    }
+
+    return values_first[lo];
+  }
+};
+
+} // end namespace detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  // the length of a run is the sum of a 1 per element
+  return thrust::reduce_by_key(
+    exec, first, last, thrust::constant_iterator<difference_type>(1), values_output, counts_output);
+} // end run_length_encode()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  // find the lengths of all runs, and their offsets by a scan of the lengths
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> lengths(exec, last - first);
+
+  const difference_type num_runs =
+    thrust::reduce_by_key(
+      exec, first, last, thrust::constant_iterator<difference_type>(1), thrust::discard_iterator<>(), lengths.begin())
+      .second
+    - lengths.begin();
+
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> offsets(exec, num_runs);
+  thrust::exclusive_scan(exec, lengths.begin(), lengths.begin() + num_runs, offsets.begin());
+
+  // keep the runs of at least two elements
+  thrust::zip_iterator<thrust::tuple<OutputIterator1, OutputIterator2>> end = thrust::copy_if(
+    exec,
+    thrust::make_zip_iterator(thrust::make_tuple(offsets.begin(), lengths.begin())),
+    thrust::make_zip_iterator(thrust::make_tuple(offsets.end(), lengths.begin() + num_runs)),
+    lengths.begin(),
+    thrust::make_zip_iterator(thrust::make_tuple(offsets_output, lengths_output)),
+    detail::is_non_trivial_run());
+
+  return thrust::make_pair(thrust::get<0>(end.get_iterator_tuple()), thrust::get<1>(end.get_iterator_tuple()));
+} // end run_length_encode_non_trivial_runs()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator run_length_decode(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type count_type;
+  typedef typename thrust::detail::temporary_array<count_type, DerivedPolicy>::iterator run_end_iterator;
+
+  const difference_type num_runs = values_last - values_first;
+
+  if (num_runs == 0)
+  {
+    return result;
+  }
+
+  // the end of every run in the output is an inclusive scan of the lengths
+  thrust::detail::temporary_array<count_type, DerivedPolicy> run_ends(exec, num_runs);
+  thrust::inclusive_scan(exec, counts_first, counts_first + num_runs, run_ends.begin());
+
+  const count_type n = run_ends[num_runs - 1];
+
+  // every element of the output searches for its run
+  return thrust::transform(
+    exec,
+    thrust::counting_iterator<count_type>(0),
+    thrust::counting_iterator<count_type>(n),
+    result,
+    detail::decoded_value<RandomAccessIterator1, run_end_iterator>(values_first, run_ends.begin(), num_runs));
+} // end run_length_decode()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -53,6 +53,15 @@ _CCCL_HOST_DEVICE void shuffle_copy(
   OutputIterator result,
   URBG&& g);
 
+template <typename ExecutionPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator sample(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g);
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
@@ -16,6 +16,7 @@
 
 #include <thrust/detail/config.h>
 
+#include <thrust/detail/minmax.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -167,6 +168,27 @@ struct write_output_op
   }
 };
 
+// like write_output_op, but only the first k of the permuted elements are
+// gathered
+template <typename InputIterT, typename OutputIterT>
+struct write_sample_op
+{
+  std::uint64_t m;
+  std::uint64_t k;
+  InputIterT in;
+  OutputIterT out;
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE std::size_t operator()(key_flag_tuple x)
+  {
+    if (x.key < m && x.flag <= k)
+    {
+      // -1 because inclusive scan
+      out[x.flag - 1] = in[x.key];
+    }
+    return 0; // Discarded
+  }
+};
+
 template <typename ExecutionPolicy, typename RandomIterator, typename URBG>
 _CCCL_HOST_DEVICE void
 shuffle(thrust::execution_policy<ExecutionPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
@@ -207,6 +229,35 @@ _CCCL_HOST_DEVICE void shuffle_copy(
   thrust::inclusive_scan(exec, key_flag_it, key_flag_it + n, gather_output_it, key_flag_scan_op());
 }
 
+template <typename ExecutionPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+_CCCL_HOST_DEVICE OutputIterator sample(
+  thrust::execution_policy<ExecutionPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g)
+{
+  // the sample is the first k elements of the permutation shuffle_copy would
+  // produce, so it is built from the same bijection
+  std::size_t m = last - first;
+  feistel_bijection bijection(m, g);
+  std::uint64_t n = bijection.nearest_power_of_two();
+
+  const std::uint64_t num_selected =
+    k > Size(0) ? (thrust::min)(static_cast<std::uint64_t>(k), static_cast<std::uint64_t>(m)) : 0;
+
+  thrust::counting_iterator<std::uint64_t> indices(0);
+  thrust::transform_iterator<construct_key_flag_op, decltype(indices), key_flag_tuple> key_flag_it(
+    indices, construct_key_flag_op(m, bijection));
+  write_sample_op<RandomIterator, OutputIterator> write_functor{m, num_selected, first, result};
+  auto gather_output_it =
+    thrust::make_transform_output_iterator(thrust::discard_iterator<std::size_t>(), write_functor);
+  thrust::inclusive_scan(exec, key_flag_it, key_flag_it + n, gather_output_it, key_flag_scan_op());
+
+  return result + num_selected;
+}
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
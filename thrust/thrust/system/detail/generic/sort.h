@@ -111,6 +111,91 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Compare>
 _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   thrust::execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Compare comp);
 
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last);
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result);
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  StrictWeakOrdering comp);
+
 } // namespace generic
 } // namespace detail
 } // namespace system
@@ -25,12 +25,20 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/detail/internal_functional.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/find.h>
 #include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/system/detail/generic/sort.h>
 #include <thrust/tuple.h>
 
@@ -152,6 +160,299 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
       .get_iterator_tuple());
 } // end is_sorted_until()
 
+namespace sort_detail
+{
+
+template <typename T, typename StrictWeakOrdering>
+struct ordered_before_pivot
+{
+  T pivot;
+  StrictWeakOrdering comp;
+
+  _CCCL_HOST_DEVICE ordered_before_pivot(const T& pivot, StrictWeakOrdering comp)
+      : pivot(pivot)
+      , comp(comp)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename U>
+  _CCCL_HOST_DEVICE bool operator()(const U& x)
+  {
+    return comp(x, pivot);
+  }
+};
+
+template <typename T, typename StrictWeakOrdering>
+struct not_ordered_after_pivot
+{
+  T pivot;
+  StrictWeakOrdering comp;
+
+  _CCCL_HOST_DEVICE not_ordered_after_pivot(const T& pivot, StrictWeakOrdering comp)
+      : pivot(pivot)
+      , comp(comp)
+  {}
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename U>
+  _CCCL_HOST_DEVICE bool operator()(const U& x)
+  {
+    return !comp(pivot, x);
+  }
+};
+
+template <typename Size>
+struct strided_index
+{
+  Size stride;
+
+  _CCCL_HOST_DEVICE strided_index(Size stride)
+      : stride(stride)
+  {}
+
+  _CCCL_HOST_DEVICE Size operator()(Size i) const
+  {
+    return i * stride;
+  }
+};
+
+} // end namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::nth_element(exec, first, nth, last, thrust::less<value_type>());
+} // end nth_element()
+
+// quickselect built from parallel partitions. Every step partitions the range
+// around a pivot taken from a sorted sample, and keeps only the side which
+// holds nth, so the work is linear in the size of the range on average.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  if (nth == last)
+  {
+    return;
+  }
+
+  // XXX these values are a tuning opportunity
+  const difference_type sort_threshold = 4096;
+  const difference_type num_samples    = 31;
+
+  if (last - first > sort_threshold)
+  {
+    thrust::detail::temporary_array<value_type, DerivedPolicy> samples(exec, num_samples);
+
+    while (last - first > sort_threshold)
+    {
+      const difference_type n = last - first;
+
+      // the sample of the same relative rank as nth estimates its value
+      thrust::gather(
+        exec,
+        thrust::make_transform_iterator(thrust::counting_iterator<difference_type>(0),
+                                        sort_detail::strided_index<difference_type>(n / num_samples)),
+        thrust::make_transform_iterator(thrust::counting_iterator<difference_type>(num_samples),
+                                        sort_detail::strided_index<difference_type>(n / num_samples)),
+        first,
+        samples.begin());
+
+      thrust::sort(exec, samples.begin(), samples.end(), comp);
+
+      const value_type pivot = samples[(nth - first) * num_samples / n];
+
+      RandomAccessIterator middle = thrust::partition(
+        exec, first, last, sort_detail::ordered_before_pivot<value_type, StrictWeakOrdering>(pivot, comp));
+
+      if (nth < middle)
+      {
+        last = middle;
+        continue;
+      }
+
+      // the elements equivalent to the pivot, among them the pivot itself, come
+      // next, so this step always makes progress
+      middle = thrust::partition(
+        exec, middle, last, sort_detail::not_ordered_after_pivot<value_type, StrictWeakOrdering>(pivot, comp));
+
+      if (nth < middle)
+      {
+        return;
+      }
+
+      first = middle;
+    }
+  }
+
+  thrust::sort(exec, first, last, comp);
+} // end nth_element()
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::partial_sort(exec, first, middle, last, thrust::less<value_type>());
+} // end partial_sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  if (first == middle)
+  {
+    return;
+  }
+
+  // select the elements which belong to [first, middle) and sort only those
+  thrust::nth_element(exec, first, middle, last, comp);
+  thrust::sort(exec, first, middle, comp);
+} // end partial_sort()
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  return thrust::partial_sort_copy(exec, first, last, result_first, result_last, thrust::less<value_type>());
+} // end partial_sort_copy()
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  // select within a copy of the input, which must not be modified
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, first, last);
+
+  const difference_type n = static_cast<difference_type>(temp.size());
+  const difference_type k = thrust::min<difference_type>(result_last - result_first, n);
+
+  thrust::partial_sort(exec, temp.begin(), temp.begin() + k, temp.end(), comp);
+
+  return thrust::copy(exec, temp.begin(), temp.begin() + k, result_first);
+} // end partial_sort_copy()
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  return thrust::top_k(exec, first, last, k, result, thrust::greater<value_type>());
+} // end top_k()
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename Size,
+          typename RandomAccessIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  Size k,
+  RandomAccessIterator result,
+  StrictWeakOrdering comp)
+{
+  return thrust::partial_sort_copy(exec, first, last, result, result + k, comp);
+} // end top_k()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::segmented_sort(exec, first, last, offsets_first, offsets_last, thrust::less<value_type>());
+} // end segmented_sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return;
+  }
+
+  // read the bounds of the segments through a copy, the offsets may not be
+  // dereferenceable here
+  thrust::detail::temporary_array<offset_type, DerivedPolicy> bounds(exec, 2);
+  thrust::copy(exec, offsets_first, offsets_first + 1, bounds.begin());
+  thrust::copy(exec, offsets_last - 1, offsets_last, bounds.begin() + 1);
+
+  const offset_type begin = bounds[0];
+  const offset_type end   = bounds[1];
+
+  if (begin == end)
+  {
+    return;
+  }
+
+  // label every element with the index of its segment
+  thrust::detail::temporary_array<segment_index, DerivedPolicy> segments(exec, end - begin);
+  thrust::upper_bound(
+    exec,
+    offsets_first + 1,
+    offsets_last - 1,
+    thrust::counting_iterator<offset_type>(begin),
+    thrust::counting_iterator<offset_type>(end),
+    segments.begin());
+
+  // sort all elements, then restore the order of the segments. The second
+  // sort is stable, so it keeps the elements of every segment sorted.
+  thrust::stable_sort_by_key(exec, first + begin, first + end, segments.begin(), comp);
+  thrust::stable_sort_by_key(exec, segments.begin(), segments.end(), first + begin);
+} // end segmented_sort()
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
 _CCCL_HOST_DEVICE void
 stable_sort(thrust::execution_policy<DerivedPolicy>&, RandomAccessIterator, RandomAccessIterator, StrictWeakOrdering)
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The parallel host systems copy a batch of buffers by dividing the
+// concatenation of all buffers, rather than the buffers themselves, into
+// intervals of equal size. A thread copies the parts of all buffers which
+// fall into its interval, so a large buffer is split among several threads
+// and many small buffers are copied by a single one.
+
+// returns the total size of the buffers [begin, end)
+template <typename SizeIterator, typename Size>
+typename thrust::iterator_value<SizeIterator>::type total_size(SizeIterator sizes, Size begin, Size end)
+{
+  typedef typename thrust::iterator_value<SizeIterator>::type size_type;
+
+  size_type result = 0;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    result += sizes[i];
+  }
+
+  return result;
+}
+
+// copies the part [output_begin, output_end) of the concatenation of all
+// buffers, where buffer begins at position buffer_offset <= output_begin of
+// the concatenation
+template <typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size,
+          typename Offset>
+void copy_buffers(
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size buffer,
+  Offset buffer_offset,
+  Offset output_begin,
+  Offset output_end)
+{
+  typedef typename thrust::iterator_value<InputBufferIterator>::type input_iterator;
+  typedef typename thrust::iterator_value<OutputBufferIterator>::type output_iterator;
+
+  // skip the buffers which end before the part
+  while (buffer_offset + static_cast<Offset>(sizes[buffer]) <= output_begin)
+  {
+    buffer_offset += static_cast<Offset>(sizes[buffer]);
+    ++buffer;
+  }
+
+  for (Offset i = output_begin; i < output_end; ++buffer)
+  {
+    const Offset buffer_end = buffer_offset + static_cast<Offset>(sizes[buffer]);
+    const Offset part_end   = buffer_end < output_end ? buffer_end : output_end;
+
+    // empty buffers may be null
+    if (i < part_end)
+    {
+      const input_iterator first   = input_buffers[buffer];
+      const output_iterator result = output_buffers[buffer];
+
+      thrust::copy_n(thrust::seq, first + (i - buffer_offset), part_end - i, result + (i - buffer_offset));
+    }
+
+    i             = part_end;
+    buffer_offset = buffer_end;
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
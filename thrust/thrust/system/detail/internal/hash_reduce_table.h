@@ -0,0 +1,246 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/integer_sequence.h>
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The hash of the keys of hash_reduce_table. Tuples and pairs, such as the keys
+// of a zip_iterator, combine the hashes of their elements, all other keys use
+// std::hash.
+template <typename Key>
+struct key_hash
+{
+  std::size_t operator()(const Key& key) const
+  {
+    return std::hash<Key>()(key);
+  }
+};
+
+template <typename... Ts>
+struct key_hash<::cuda::std::tuple<Ts...>>
+{
+  std::size_t operator()(const ::cuda::std::tuple<Ts...>& key) const
+  {
+    return combine(key, thrust::make_index_sequence<sizeof...(Ts)>());
+  }
+
+private:
+  template <std::size_t... Is>
+  static std::size_t combine(const ::cuda::std::tuple<Ts...>& key, thrust::index_sequence<Is...>)
+  {
+    std::size_t h                = 0;
+    const std::size_t elements[] = {0, key_hash<Ts>()(::cuda::std::get<Is>(key))...};
+    for (std::size_t i = 1; i <= sizeof...(Ts); ++i)
+    {
+      h ^= elements[i] + static_cast<std::size_t>(0x9e3779b97f4a7c15ull) + (h << 6) + (h >> 2);
+    }
+    return h;
+  }
+};
+
+template <typename T1, typename T2>
+struct key_hash<::cuda::std::pair<T1, T2>>
+{
+  std::size_t operator()(const ::cuda::std::pair<T1, T2>& key) const
+  {
+    return key_hash<::cuda::std::tuple<T1, T2>>()(::cuda::std::tuple<T1, T2>(key.first, key.second));
+  }
+};
+
+// whether key_hash<Key> is usable; the host systems fall back to the sorting
+// implementation of reduce_by_key_unsorted for other keys
+template <typename Key>
+struct is_hashable_key : thrust::detail::integral_constant<bool, std::is_default_constructible<std::hash<Key>>::value>
+{};
+
+template <typename... Ts>
+struct is_hashable_key<::cuda::std::tuple<Ts...>> : thrust::detail::and_<is_hashable_key<Ts>...>
+{};
+
+template <typename T1, typename T2>
+struct is_hashable_key<::cuda::std::pair<T1, T2>> : thrust::detail::and_<is_hashable_key<T1>, is_hashable_key<T2>>
+{};
+
+// the result type of the hash based reduce_by_key_unsorted, which only takes part
+// in overload resolution when the keys of Iterator are hashable
+template <typename Iterator, typename Result>
+struct enable_if_hashable_keys
+    : thrust::detail::enable_if<is_hashable_key<typename thrust::iterator_value<Iterator>::type>::value, Result>
+{};
+
+// An open addressing hash table which accumulates values of equal keys with a
+// binary function. This is the building block of the host implementations of
+// reduce_by_key_unsorted: every thread fills its own table and the tables are
+// merged afterwards.
+//
+// Entries are stored densely in the order in which their keys were first
+// inserted, the slot array only holds indices into that storage. Merging the
+// tables of consecutive chunks of the input in order therefore yields the keys
+// in the order of their first occurrence, and every value is accumulated from
+// left to right just like in reduce_by_key.
+template <typename Key, typename Value, typename KeyEqual, typename BinaryFunction>
+class hash_reduce_table
+{
+public:
+  typedef std::size_t size_type;
+
+  hash_reduce_table(KeyEqual key_eq, BinaryFunction binary_op)
+      : m_key_eq(key_eq)
+      , m_binary_op(binary_op)
+      , m_slots(64, empty_slot())
+  {}
+
+  size_type size() const
+  {
+    return m_keys.size();
+  }
+
+  void insert(const Key& key, const Value& value)
+  {
+    insert(hash(key), key, value);
+  }
+
+  // accumulates the entries of other into this table, other's values are
+  // treated as if they occurred after the values already in this table
+  void merge(const hash_reduce_table& other)
+  {
+    for (size_type i = 0; i < other.size(); ++i)
+    {
+      insert(other.m_hashes[i], other.m_keys[i], other.m_values[i]);
+    }
+  }
+
+  template <typename OutputIterator1, typename OutputIterator2>
+  thrust::pair<OutputIterator1, OutputIterator2>
+  copy_to(OutputIterator1 keys_output, OutputIterator2 values_output) const
+  {
+    for (size_type i = 0; i < size(); ++i, ++keys_output, ++values_output)
+    {
+      *keys_output   = m_keys[i];
+      *values_output = m_values[i];
+    }
+
+    return thrust::make_pair(keys_output, values_output);
+  }
+
+private:
+  static size_type empty_slot()
+  {
+    return ~size_type(0);
+  }
+
+  static size_type hash(const Key& key)
+  {
+    // standard library hashes of integers are usually the identity, mix the
+    // bits so that strided keys do not collide in a power of two sized table
+    thrust::detail::uint64_t h = static_cast<thrust::detail::uint64_t>(key_hash<Key>()(key));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+
+  void insert(size_type h, const Key& key, const Value& value)
+  {
+    const size_type mask = m_slots.size() - 1;
+
+    for (size_type slot = h & mask;; slot = (slot + 1) & mask)
+    {
+      const size_type idx = m_slots[slot];
+
+      if (idx == empty_slot())
+      {
+        m_slots[slot] = m_keys.size();
+        m_keys.push_back(key);
+        m_values.push_back(value);
+        m_hashes.push_back(h);
+
+        // keep the load factor at or below one half
+        if (2 * m_keys.size() > m_slots.size())
+        {
+          rehash(2 * m_slots.size());
+        }
+        return;
+      }
+
+      if (m_hashes[idx] == h && m_key_eq(m_keys[idx], key))
+      {
+        m_values[idx] = m_binary_op(m_values[idx], value);
+        return;
+      }
+    }
+  }
+
+  void rehash(size_type capacity)
+  {
+    std::vector<size_type> slots(capacity, empty_slot());
+    const size_type mask = capacity - 1;
+
+    for (size_type i = 0; i < m_hashes.size(); ++i)
+    {
+      size_type slot = m_hashes[i] & mask;
+      while (slots[slot] != empty_slot())
+      {
+        slot = (slot + 1) & mask;
+      }
+      slots[slot] = i;
+    }
+
+    m_slots.swap(slots);
+  }
+
+  KeyEqual m_key_eq;
+  BinaryFunction m_binary_op;
+  std::vector<size_type> m_slots;
+  std::vector<Key> m_keys;
+  std::vector<Value> m_values;
+  std::vector<size_type> m_hashes;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
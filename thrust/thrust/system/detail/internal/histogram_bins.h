@@ -0,0 +1,327 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cstddef>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// the type of the counters of a histogram written to OutputIterator
+template <typename InputIterator, typename OutputIterator>
+struct histogram_counter
+    : thrust::detail::eval_if<thrust::detail::is_output_iterator<OutputIterator>::value,
+                              thrust::iterator_difference<InputIterator>,
+                              thrust::iterator_value<OutputIterator>>
+{};
+
+// maps a sample to its bin in histogram_even. Samples outside of
+// [lower_level, upper_level) are mapped to num_bins, one past the last bin.
+template <typename Level, bool = thrust::detail::is_integral<Level>::value>
+struct even_bin_index
+{
+  Level lower_level;
+  Level upper_level;
+  Level scale;
+  int num_bins;
+
+  _CCCL_HOST_DEVICE even_bin_index(Level lower_level, Level upper_level, int num_bins)
+      : lower_level(lower_level)
+      , upper_level(upper_level)
+      , scale(Level(num_bins) / (upper_level - lower_level))
+      , num_bins(num_bins)
+  {}
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    // written negated so that NaNs are out of range
+    if (!(lower_level <= sample && sample < upper_level))
+    {
+      return num_bins;
+    }
+
+    const int bin = static_cast<int>((Level(sample) - lower_level) * scale);
+
+    // rounding may push samples just below upper_level past the last bin
+    return bin < num_bins ? bin : num_bins - 1;
+  }
+};
+
+template <typename Level>
+struct even_bin_index<Level, true>
+{
+  // compute the offsets in unsigned 64 bit arithmetic, which cannot overflow
+  // for ranges of signed levels which are wider than Level's maximum
+  typedef unsigned long long wide_type;
+
+  Level lower_level;
+  Level upper_level;
+  wide_type range;
+  int num_bins;
+  bool narrow;
+
+  _CCCL_HOST_DEVICE even_bin_index(Level lower_level, Level upper_level, int num_bins)
+      : lower_level(lower_level)
+      , upper_level(upper_level)
+      , range(static_cast<wide_type>(upper_level) - static_cast<wide_type>(lower_level))
+      , num_bins(num_bins)
+      // 64 bit divisions are several times slower than 32 bit ones, use the
+      // latter whenever offset * num_bins cannot overflow them
+      , narrow(range <= 0xffffffffull / static_cast<wide_type>(num_bins))
+  {}
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    if (!(lower_level <= sample && sample < upper_level))
+    {
+      return num_bins;
+    }
+
+    const wide_type offset = static_cast<wide_type>(static_cast<Level>(sample)) - static_cast<wide_type>(lower_level);
+
+    if (narrow)
+    {
+      return static_cast<int>(static_cast<unsigned int>(offset) * static_cast<unsigned int>(num_bins)
+                              / static_cast<unsigned int>(range));
+    }
+
+    return static_cast<int>(offset * static_cast<wide_type>(num_bins) / range);
+  }
+};
+
+// maps a sample to its bin in histogram_range by a binary search over the
+// num_bins + 1 levels. Samples outside of [levels[0], levels[num_bins]) are
+// mapped to num_bins, one past the last bin.
+template <typename RandomAccessIterator>
+struct range_bin_index
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type level_type;
+
+  RandomAccessIterator levels_first;
+  int num_bins;
+
+  _CCCL_HOST_DEVICE range_bin_index(RandomAccessIterator levels_first, int num_bins)
+      : levels_first(levels_first)
+      , num_bins(num_bins)
+  {}
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    const level_type lower_level = levels_first[0];
+    const level_type upper_level = levels_first[num_bins];
+
+    if (!(lower_level <= sample && sample < upper_level))
+    {
+      return num_bins;
+    }
+
+    // invariant: levels_first[lo] <= sample < levels_first[hi]
+    int lo = 0;
+    int hi = num_bins;
+
+    while (hi - lo > 1)
+    {
+      const int mid          = lo + (hi - lo) / 2;
+      const level_type level = levels_first[mid];
+
+      if (sample < level)
+      {
+        hi = mid;
+      }
+      else
+      {
+        lo = mid;
+      }
+    }
+
+    return lo;
+  }
+};
+
+// adds the number of samples in [first, first + n) which fall into each bin
+// to counters, which holds one counter per bin.
+//
+// Incrementing the same counter for consecutive samples makes every increment
+// wait for the previous store to be forwarded, which is what happens on skewed
+// data where most samples fall into a few bins. When the bins are few enough,
+// consecutive samples are therefore counted into four interleaved
+// sub-histograms, which are summed at the end. Every sub-histogram has an
+// extra counter for the samples which are out of range, so counting never
+// branches.
+template <typename InputIterator, typename Size, typename BinIndex, typename Counter>
+void accumulate_histogram(
+  InputIterator first, Size n, BinIndex bin_index, std::vector<Counter>& counters, thrust::detail::false_type)
+{
+  const std::size_t num_bins = counters.size();
+  const std::size_t stride   = num_bins + 1;
+
+  // XXX these values are a tuning opportunity
+  const std::size_t num_sub_histograms      = 4;
+  const std::size_t max_sub_histogram_bytes = 32 * 1024;
+
+  const bool use_sub_histograms =
+    num_sub_histograms * stride * sizeof(Counter) <= max_sub_histogram_bytes
+    && static_cast<std::size_t>(n) >= num_sub_histograms * stride;
+
+  if (!use_sub_histograms)
+  {
+    std::vector<Counter> histogram(stride, Counter(0));
+    Counter* h = histogram.data();
+
+    for (Size i = 0; i < n; ++i, ++first)
+    {
+      ++h[bin_index(*first)];
+    }
+
+    for (std::size_t bin = 0; bin < num_bins; ++bin)
+    {
+      counters[bin] += h[bin];
+    }
+
+    return;
+  }
+
+  std::vector<Counter> histograms(num_sub_histograms * stride, Counter(0));
+  Counter* h0 = histograms.data();
+  Counter* h1 = h0 + stride;
+  Counter* h2 = h1 + stride;
+  Counter* h3 = h2 + stride;
+
+  Size i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const int b0 = bin_index(*first);
+    ++first;
+    const int b1 = bin_index(*first);
+    ++first;
+    const int b2 = bin_index(*first);
+    ++first;
+    const int b3 = bin_index(*first);
+    ++first;
+
+    ++h0[b0];
+    ++h1[b1];
+    ++h2[b2];
+    ++h3[b3];
+  }
+
+  for (; i < n; ++i, ++first)
+  {
+    ++h0[bin_index(*first)];
+  }
+
+  for (std::size_t bin = 0; bin < num_bins; ++bin)
+  {
+    counters[bin] += h0[bin] + h1[bin] + h2[bin] + h3[bin];
+  }
+}
+
+// maps a byte to itself, it is the bin of a byte in a histogram of raw byte values
+struct byte_bin_index
+{
+  template <typename Sample>
+  int operator()(const Sample& sample) const
+  {
+    return static_cast<unsigned char>(sample);
+  }
+};
+
+// one byte samples have so few values that counting the raw values and
+// mapping each of them to its bin afterwards is cheaper than computing the bin
+// of every sample
+template <typename InputIterator, typename Size, typename BinIndex, typename Counter>
+void accumulate_histogram(
+  InputIterator first, Size n, BinIndex bin_index, std::vector<Counter>& counters, thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type sample_type;
+
+  std::vector<Counter> raw_counters(256, Counter(0));
+  accumulate_histogram(first, n, byte_bin_index(), raw_counters, thrust::detail::false_type());
+
+  const std::size_t num_bins = counters.size();
+
+  for (int value = 0; value < 256; ++value)
+  {
+    const std::size_t bin = static_cast<std::size_t>(bin_index(static_cast<sample_type>(value)));
+
+    if (bin < num_bins)
+    {
+      counters[bin] += raw_counters[value];
+    }
+  }
+}
+
+template <typename InputIterator, typename Size, typename BinIndex, typename Counter>
+void accumulate_histogram(InputIterator first, Size n, BinIndex bin_index, std::vector<Counter>& counters)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type sample_type;
+
+  accumulate_histogram(
+    first,
+    n,
+    bin_index,
+    counters,
+    thrust::detail::integral_constant<bool,
+                                      thrust::detail::is_integral<sample_type>::value && sizeof(sample_type) == 1>());
+}
+
+// counts the samples of [first, last) which fall into each of num_bins bins
+// and writes the counts to histogram
+template <typename InputIterator, typename OutputIterator, typename BinIndex>
+OutputIterator
+serial_histogram(InputIterator first, InputIterator last, OutputIterator histogram, int num_bins, BinIndex bin_index)
+{
+  typedef typename histogram_counter<InputIterator, OutputIterator>::type counter_type;
+
+  std::vector<counter_type> counters(num_bins, counter_type(0));
+  accumulate_histogram(first, thrust::distance(first, last), bin_index, counters);
+
+  for (int bin = 0; bin < num_bins; ++bin, ++histogram)
+  {
+    *histogram = counters[bin];
+  }
+
+  return histogram;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The parallel host systems encode runs in two passes over intervals of the
+// input. The first pass counts the runs which begin in every interval and
+// finds the first of them. After a scan of the counts, the second pass writes
+// the runs which begin in every interval to their place in the output. A run
+// which is still open at the end of an interval ends where the next interval
+// with a run begins, so no run is ever scanned by more than one thread.
+
+// returns true if a run begins at position i of first
+template <typename RandomAccessIterator, typename Size>
+bool is_run_start(RandomAccessIterator first, Size i)
+{
+  return i == 0 || !(first[i - 1] == first[i]);
+}
+
+// writes the value and the length of every run
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+struct run_writer
+{
+  RandomAccessIterator first;
+  OutputIterator1 values_output;
+  OutputIterator2 counts_output;
+
+  run_writer(RandomAccessIterator first, OutputIterator1 values_output, OutputIterator2 counts_output)
+      : first(first)
+      , values_output(values_output)
+      , counts_output(counts_output)
+  {}
+
+  // returns true if the run which begins at position i is written
+  template <typename Size>
+  bool writes_run_at(Size, Size) const
+  {
+    return true;
+  }
+
+  // writes the run [begin, end) as the kth one, returns true if it was written
+  template <typename Size>
+  bool operator()(Size k, Size begin, Size end) const
+  {
+    values_output[k] = first[begin];
+    counts_output[k] = end - begin;
+    return true;
+  }
+};
+
+// writes the offset and the length of every run of at least two elements
+template <typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+struct non_trivial_run_writer
+{
+  RandomAccessIterator first;
+  OutputIterator1 offsets_output;
+  OutputIterator2 lengths_output;
+
+  non_trivial_run_writer(RandomAccessIterator first, OutputIterator1 offsets_output, OutputIterator2 lengths_output)
+      : first(first)
+      , offsets_output(offsets_output)
+      , lengths_output(lengths_output)
+  {}
+
+  template <typename Size>
+  bool writes_run_at(Size i, Size n) const
+  {
+    return i + 1 < n && first[i] == first[i + 1];
+  }
+
+  template <typename Size>
+  bool operator()(Size k, Size begin, Size end) const
+  {
+    if (end - begin < 2)
+    {
+      return false;
+    }
+
+    offsets_output[k] = begin;
+    lengths_output[k] = end - begin;
+    return true;
+  }
+};
+
+// returns the number of runs beginning in [begin, end) which writer writes
+// and sets first_run to the position at which the first run of the interval
+// begins, or to end if there is none
+template <typename RandomAccessIterator, typename Size, typename RunWriter>
+Size count_runs(RandomAccessIterator first, Size n, Size begin, Size end, const RunWriter& writer, Size& first_run)
+{
+  Size num_runs = 0;
+  first_run     = end;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    if (is_run_start(first, i))
+    {
+      if (first_run == end)
+      {
+        first_run = i;
+      }
+
+      if (writer.writes_run_at(i, n))
+      {
+        ++num_runs;
+      }
+    }
+  }
+
+  return num_runs;
+}
+
+// writes the runs beginning in [begin, end), the first of them as the kth
+// run. The run which is open at end ends at next_run.
+template <typename RandomAccessIterator, typename Size, typename RunWriter>
+void write_runs(RandomAccessIterator first, Size begin, Size end, Size next_run, Size k, const RunWriter& writer)
+{
+  Size run_begin = end;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    if (is_run_start(first, i))
+    {
+      if (run_begin != end && writer(k, run_begin, i))
+      {
+        ++k;
+      }
+
+      run_begin = i;
+    }
+  }
+
+  if (run_begin != end)
+  {
+    writer(k, run_begin, next_run);
+  }
+}
+
+// writes the part [output_begin, output_end) of the decoded runs, where run is
+// a run which begins at position run_offset <= output_begin of the output
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename OutputIterator>
+void decode_runs(
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator2 counts_first,
+  Size run,
+  Size run_offset,
+  Size output_begin,
+  Size output_end,
+  OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+
+  // skip the runs which end before the part
+  while (run_offset + static_cast<Size>(counts_first[run]) <= output_begin)
+  {
+    run_offset += static_cast<Size>(counts_first[run]);
+    ++run;
+  }
+
+  for (Size i = output_begin; i < output_end; ++run)
+  {
+    const Size run_end     = run_offset + static_cast<Size>(counts_first[run]);
+    const Size part_end    = run_end < output_end ? run_end : output_end;
+    const value_type value = values_first[run];
+
+    for (; i < part_end; ++i)
+    {
+      result[i] = value;
+    }
+
+    run_offset = run_end;
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,89 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The segments of the segmented algorithms are described by num_segments + 1
+// offsets, segment i being [offsets_first[i], offsets_first[i + 1]). The
+// parallel backends divide the elements of all segments into intervals of
+// equal size and assign every segment to the interval in which it begins.
+// Segments which are larger than an interval would leave the other threads
+// idle, so they are skipped when the intervals are processed and handled one
+// after another by all threads instead.
+
+// returns the index of the first of the num_segments segments which begins at
+// or after offset
+template <typename OffsetIterator, typename Size, typename Offset>
+Size first_segment_at(OffsetIterator offsets_first, Size num_segments, Offset offset)
+{
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  // invariant: the segments before lo begin before offset, those at and after hi don't
+  Size lo = 0;
+  Size hi = num_segments;
+
+  while (lo < hi)
+  {
+    const Size mid = lo + (hi - lo) / 2;
+
+    if (static_cast<offset_type>(offsets_first[mid]) < offset)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  return lo;
+}
+
+// returns true if segment i has more than max_size elements
+template <typename OffsetIterator, typename Size, typename Offset>
+bool is_large_segment(OffsetIterator offsets_first, Size i, Offset max_size)
+{
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const offset_type begin = offsets_first[i];
+  const offset_type end   = offsets_first[i + 1];
+
+  return end - begin > max_size;
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
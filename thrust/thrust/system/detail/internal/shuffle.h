@@ -0,0 +1,92 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/shuffle.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The generic shuffle permutes [0, m) by mapping the indices of [0, n), n
+// being the power of two above m, through a bijection, and compacting the
+// images which fall into [0, m) with a scan. The parallel host systems replace
+// the scan by two passes over intervals of [0, n): the first stores the images
+// in [0, m) of every interval at the start of the interval's part of a buffer
+// of n indices and counts them, and after a scan of the counts the second
+// gathers the elements of the stored images to their place in the output. The
+// bijection is computed once per index, which takes far longer than writing
+// and reading back its image. The result is the same permutation the generic
+// shuffle produces.
+
+// stores the images in [0, m) of the indices in [begin, end) to images and
+// returns their number
+template <typename Bijection>
+std::uint64_t collect_shuffled(
+  const Bijection& bijection, std::uint64_t m, std::uint64_t begin, std::uint64_t end, std::uint64_t* images)
+{
+  std::uint64_t result = 0;
+
+  for (std::uint64_t i = begin; i < end; ++i)
+  {
+    const std::uint64_t key = bijection(i);
+
+    if (key < m)
+    {
+      images[result] = key;
+      ++result;
+    }
+  }
+
+  return result;
+}
+
+// gathers the elements of first at the count images, the first of them to
+// position offset of result, and stops at position k
+template <typename RandomAccessIterator, typename OutputIterator>
+void gather_shuffled(const std::uint64_t* images,
+                     std::uint64_t count,
+                     std::uint64_t offset,
+                     std::uint64_t k,
+                     RandomAccessIterator first,
+                     OutputIterator result)
+{
+  for (std::uint64_t i = 0; i < count && offset < k; ++i, ++offset)
+  {
+    result[offset] = first[images[i]];
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The rectangular block [lower[r], upper[r]) of a Rank dimensional index space.
+// The arrays have one spare element so that rank zero spaces are well formed.
+template <typename IndexType, ::cuda::std::size_t Rank>
+struct index_box
+{
+  IndexType lower[Rank + 1];
+  IndexType upper[Rank + 1];
+};
+
+// Calls f(i0, i1, ..., iRank-1) for every index of a box with one nested loop
+// per rank, the last rank being the innermost loop.
+template <::cuda::std::size_t Rank, ::cuda::std::size_t R = 0>
+struct index_box_loop
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename IndexType, typename Function, typename... Indices>
+  static _CCCL_HOST_DEVICE void run(const index_box<IndexType, Rank>& box, Function& f, Indices... idx)
+  {
+    const IndexType last = box.upper[R];
+    for (IndexType i = box.lower[R]; i < last; ++i)
+    {
+      index_box_loop<Rank, R + 1>::run(box, f, idx..., i);
+    }
+  }
+};
+
+template <::cuda::std::size_t Rank>
+struct index_box_loop<Rank, Rank>
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename IndexType, typename Function, typename... Indices>
+  static _CCCL_HOST_DEVICE void run(const index_box<IndexType, Rank>&, Function& f, Indices... idx)
+  {
+    f(idx...);
+  }
+};
+
+// Splits the index space described by a cuda::std::extents into tiles of about
+// max_tile_size indices. Tiles are numbered in row major order, so the host
+// backends can distribute tile numbers among threads. Mapping a tile number to
+// its box costs a division per rank, visiting the indices of a box none.
+template <typename Extents>
+class tiled_index_space
+{
+public:
+  typedef typename Extents::index_type index_type;
+
+  static const ::cuda::std::size_t rank = Extents::rank();
+
+  typedef index_box<index_type, rank> box_type;
+
+  // XXX these values are a tuning opportunity
+  // a tile of 4096 doubles fills a 32KiB L1 cache, the last rank is limited to
+  // 64 so that tiles of higher rank spaces are square
+  static const index_type max_tile_size = 4096;
+  static const index_type max_inner_tile_extent = 64;
+
+  _CCCL_HOST_DEVICE explicit tiled_index_space(const Extents& extents)
+      : m_extents()
+      , m_tile_extent()
+      , m_tiles()
+      , m_num_tiles(1)
+  {
+    index_type budget = max_tile_size;
+
+    for (::cuda::std::size_t r = rank; r-- > 0;)
+    {
+      const index_type cap = (rank > 1 && r == rank - 1) ? max_inner_tile_extent : budget;
+
+      m_extents[r]     = extents.extent(r);
+      m_tile_extent[r] = m_extents[r] < cap ? m_extents[r] : cap;
+      if (m_tile_extent[r] == 0)
+      {
+        m_tile_extent[r] = 1;
+      }
+      m_tiles[r] = (m_extents[r] + m_tile_extent[r] - 1) / m_tile_extent[r];
+      m_num_tiles *= m_tiles[r];
+
+      budget = budget / m_tile_extent[r] > 0 ? budget / m_tile_extent[r] : 1;
+    }
+  }
+
+  _CCCL_HOST_DEVICE index_type num_tiles() const
+  {
+    return m_num_tiles;
+  }
+
+  _CCCL_HOST_DEVICE box_type tile(index_type t) const
+  {
+    box_type box;
+    for (::cuda::std::size_t r = rank; r-- > 0;)
+    {
+      const index_type lower = (t % m_tiles[r]) * m_tile_extent[r];
+      t /= m_tiles[r];
+
+      box.lower[r] = lower;
+      box.upper[r] = m_extents[r] - lower < m_tile_extent[r] ? m_extents[r] : lower + m_tile_extent[r];
+    }
+    return box;
+  }
+
+  _CCCL_HOST_DEVICE box_type whole() const
+  {
+    box_type box;
+    for (::cuda::std::size_t r = 0; r < rank; ++r)
+    {
+      box.lower[r] = 0;
+      box.upper[r] = m_extents[r];
+    }
+    return box;
+  }
+
+  template <typename Function>
+  _CCCL_HOST_DEVICE void for_each_in_tile(index_type t, Function& f) const
+  {
+    index_box_loop<rank>::run(tile(t), f);
+  }
+
+  template <typename Function>
+  _CCCL_HOST_DEVICE void for_each(Function& f) const
+  {
+    index_box_loop<rank>::run(whole(), f);
+  }
+
+private:
+  index_type m_extents[rank + 1];
+  index_type m_tile_extent[rank + 1];
+  index_type m_tiles[rank + 1];
+  index_type m_num_tiles;
+};
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
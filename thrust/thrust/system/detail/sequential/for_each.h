@@ -30,6 +30,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/tiled_index_space.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -74,6 +75,13 @@ for_each_n(sequential::execution_policy<DerivedPolicy>&, InputIterator first, Si
   return first;
 } // end for_each_n()
 
+template <typename DerivedPolicy, typename Extents, typename Function>
+_CCCL_HOST_DEVICE void for_each_index(sequential::execution_policy<DerivedPolicy>&, const Extents& extents, Function f)
+{
+  // a single thread has no use for tiles, visit the whole space with nested loops
+  thrust::system::detail::internal::tiled_index_space<Extents>(extents).for_each(f);
+} // end for_each_index()
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
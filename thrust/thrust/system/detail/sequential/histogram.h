@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram_bins.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <nv/target>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  typedef thrust::system::detail::internal::even_bin_index<Level> bin_index_type;
+
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  // the counters live in host memory, a single CUDA thread falls back to sorting
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    ((void) exec; return thrust::system::detail::internal::serial_histogram(
+       first, last, histogram, num_levels - 1, bin_index_type(lower_level, upper_level, num_levels - 1));),
+    ( // NV_IS_DEVICE:
+      return thrust::system::detail::generic::histogram_even(
+        exec, first, last, histogram, num_levels, lower_level, upper_level);));
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  typedef thrust::system::detail::internal::range_bin_index<RandomAccessIterator> bin_index_type;
+
+  const int num_levels = static_cast<int>(levels_last - levels_first);
+
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  // the counters live in host memory, a single CUDA thread falls back to sorting
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    ((void) exec; return thrust::system::detail::internal::serial_histogram(
+       first, last, histogram, num_levels - 1, bin_index_type(levels_first, num_levels - 1));),
+    ( // NV_IS_DEVICE:
+      return thrust::system::detail::generic::histogram_range(
+        exec, first, last, histogram, levels_first, levels_last);));
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
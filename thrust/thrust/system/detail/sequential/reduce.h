@@ -64,6 +64,49 @@ _CCCL_HOST_DEVICE OutputType reduce(
   return result;
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE OutputIterator segmented_reduce(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction, T> wrapped_binary_op(binary_op);
+
+  if (offsets_first == offsets_last)
+  {
+    return result;
+  }
+
+  for (OffsetIterator offset = offsets_first; offset + 1 != offsets_last; ++offset, ++result)
+  {
+    RandomAccessIterator begin = first + offset[0];
+    RandomAccessIterator end   = first + offset[1];
+
+    T sum = init;
+
+    for (; begin != end; ++begin)
+    {
+      sum = wrapped_binary_op(sum, *begin);
+    }
+
+    *result = sum;
+  }
+
+  return result;
+}
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
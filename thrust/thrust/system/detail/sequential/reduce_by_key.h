@@ -27,8 +27,12 @@
 #endif // no system header
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
+#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/internal/hash_reduce_table.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
+#include <nv/target>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -98,6 +102,45 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   return thrust::make_pair(keys_output, values_output);
 }
 
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+_CCCL_HOST_DEVICE typename thrust::system::detail::internal::enable_if_hashable_keys<
+  InputIterator1,
+  thrust::pair<OutputIterator1, OutputIterator2>>::type
+reduce_by_key_unsorted(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<InputIterator2>::type ValueType;
+  typedef thrust::system::detail::internal::hash_reduce_table<KeyType, ValueType, BinaryPredicate, BinaryFunction>
+    table_type;
+
+  // the hash table lives in host memory, a single CUDA thread falls back to sorting
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    ((void) exec; table_type table(binary_pred, binary_op);
+
+     for (; keys_first != keys_last; ++keys_first, ++values_first) { table.insert(*keys_first, *values_first); }
+
+     return table.copy_to(keys_output, values_output);),
+    ( // NV_IS_DEVICE:
+      return thrust::system::detail::generic::reduce_by_key_unsorted(
+        exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);));
+}
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  while (first != last)
+  {
+    RandomAccessIterator run_end = first;
+
+    for (++run_end; run_end != last && *first == *run_end; ++run_end)
+    {}
+
+    *values_output = *first;
+    *counts_output = static_cast<difference_type>(run_end - first);
+
+    ++values_output;
+    ++counts_output;
+
+    first = run_end;
+  }
+
+  return thrust::make_pair(values_output, counts_output);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  for (RandomAccessIterator run_begin = first; run_begin != last;)
+  {
+    RandomAccessIterator run_end = run_begin;
+
+    for (++run_end; run_end != last && *run_begin == *run_end; ++run_end)
+    {}
+
+    const difference_type length = run_end - run_begin;
+
+    if (length > 1)
+    {
+      *offsets_output = static_cast<difference_type>(run_begin - first);
+      *lengths_output = length;
+
+      ++offsets_output;
+      ++lengths_output;
+    }
+
+    run_begin = run_end;
+  }
+
+  return thrust::make_pair(offsets_output, lengths_output);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator run_length_decode(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type count_type;
+
+  for (; values_first != values_last; ++values_first, ++counts_first)
+  {
+    const value_type value = *values_first;
+    const count_type count = *counts_first;
+
+    for (count_type i = 0; i < count; ++i, ++result)
+    {
+      *result = value;
+    }
+  }
+
+  return result;
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,324 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file selection.h
+ *  \brief Sequential selection of the smallest elements of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace selection_detail
+{
+
+// swap through a temporary so that proxy references, e.g. those of
+// zip_iterator, are swapped correctly
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void iter_swap(RandomAccessIterator a, RandomAccessIterator b)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  value_type temp = *a;
+  *a              = *b;
+  *b              = temp;
+}
+
+// moves value into the hole of the heap [first, first + len) and sifts it
+// down to its place. The heap keeps its largest element at first.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sift_down(RandomAccessIterator first, Size hole, Size len, const T& value, StrictWeakOrdering& comp)
+{
+  while (true)
+  {
+    Size child = 2 * hole + 1;
+
+    if (child >= len)
+    {
+      break;
+    }
+
+    if (child + 1 < len && comp(first[child], first[child + 1]))
+    {
+      ++child;
+    }
+
+    if (!comp(value, first[child]))
+    {
+      break;
+    }
+
+    first[hole] = first[child];
+    hole        = child;
+  }
+
+  first[hole] = value;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void make_heap(RandomAccessIterator first, Size len, StrictWeakOrdering& comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for (Size i = len / 2; i > 0; --i)
+  {
+    const value_type value = first[i - 1];
+    sift_down(first, i - 1, len, value, comp);
+  }
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_heap(RandomAccessIterator first, Size len, StrictWeakOrdering& comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for (; len > 1; --len)
+  {
+    // move the largest element behind the heap and sift the last one down
+    const value_type value = first[len - 1];
+    first[len - 1]         = first[0];
+    sift_down(first, Size(0), len - 1, value, comp);
+  }
+}
+
+// places the median of *a, *b and *c at result
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void move_median_to_first(
+  RandomAccessIterator result,
+  RandomAccessIterator a,
+  RandomAccessIterator b,
+  RandomAccessIterator c,
+  StrictWeakOrdering& comp)
+{
+  if (comp(*a, *b))
+  {
+    if (comp(*b, *c))
+    {
+      iter_swap(result, b);
+    }
+    else if (comp(*a, *c))
+    {
+      iter_swap(result, c);
+    }
+    else
+    {
+      iter_swap(result, a);
+    }
+  }
+  else if (comp(*a, *c))
+  {
+    iter_swap(result, a);
+  }
+  else if (comp(*b, *c))
+  {
+    iter_swap(result, c);
+  }
+  else
+  {
+    iter_swap(result, b);
+  }
+}
+
+// partitions [first, last) around the median of three of its elements and
+// returns the cut, such that no element of [first, cut) is greater than any
+// element of [cut, last). The pivot is kept at *first, which together with
+// the other two candidates bounds both scans, so neither needs to check for
+// the ends of the range.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator
+partition_around_median(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  RandomAccessIterator mid = first + (last - first) / 2;
+  move_median_to_first(first, first + 1, mid, last - 1, comp);
+
+  RandomAccessIterator pivot = first;
+  RandomAccessIterator lo    = first + 1;
+  RandomAccessIterator hi    = last;
+
+  while (true)
+  {
+    while (comp(*lo, *pivot))
+    {
+      ++lo;
+    }
+
+    --hi;
+    while (comp(*pivot, *hi))
+    {
+      --hi;
+    }
+
+    if (!(lo < hi))
+    {
+      return lo;
+    }
+
+    iter_swap(lo, hi);
+    ++lo;
+  }
+}
+
+} // end namespace selection_detail
+
+// rearranges [first, last) such that nth holds the element which would be
+// there if the range were sorted, no element of [first, nth) is greater than
+// *nth and no element of (nth, last) is less than it, like std::nth_element.
+//
+// This is quickselect with median of three pivots. If the partitions stop
+// shrinking quickly enough, it falls back to selecting with a heap, which
+// bounds the cost to O(n log n) for adversarial inputs.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+introselect(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  if (first == last || nth == last)
+  {
+    return;
+  }
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  // XXX this value is a tuning opportunity
+  const difference_type insertion_sort_threshold = 16;
+
+  int depth_limit = 0;
+  for (difference_type n = last - first; n > 1; n /= 2)
+  {
+    depth_limit += 2;
+  }
+
+  while (last - first > insertion_sort_threshold)
+  {
+    if (depth_limit-- == 0)
+    {
+      // select with a heap of the nth - first + 1 smallest elements
+      const difference_type len = nth - first + 1;
+      selection_detail::make_heap(first, len, wrapped_comp);
+
+      for (RandomAccessIterator i = nth + 1; i != last; ++i)
+      {
+        if (wrapped_comp(*i, *first))
+        {
+          const value_type value = *i;
+          *i                     = *first;
+          selection_detail::sift_down(first, difference_type(0), len, value, wrapped_comp);
+        }
+      }
+
+      // the largest element of the heap belongs to nth
+      selection_detail::iter_swap(first, nth);
+      return;
+    }
+
+    RandomAccessIterator cut = selection_detail::partition_around_median(first, last, wrapped_comp);
+
+    if (cut <= nth)
+    {
+      first = cut;
+    }
+    else
+    {
+      last = cut;
+    }
+  }
+
+  thrust::system::detail::sequential::insertion_sort(first, last, comp);
+}
+
+// copies the result_last - result_first smallest elements of [first, last),
+// or all of them if there are fewer, to the result in sorted order and
+// returns the end of the sorted result. This keeps the selected elements in
+// a heap, so it takes O(n log k) time and no extra storage.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator heap_select_copy(
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp(comp);
+
+  RandomAccessIterator result_end = result_first;
+
+  for (; first != last && result_end != result_last; ++first, ++result_end)
+  {
+    *result_end = *first;
+  }
+
+  const difference_type len = result_end - result_first;
+
+  if (len == 0)
+  {
+    return result_end;
+  }
+
+  selection_detail::make_heap(result_first, len, wrapped_comp);
+
+  for (; first != last; ++first)
+  {
+    const value_type value = *first;
+
+    if (wrapped_comp(value, *result_first))
+    {
+      selection_detail::sift_down(result_first, difference_type(0), len, value, wrapped_comp);
+    }
+  }
+
+  selection_detail::sort_heap(result_first, len, wrapped_comp);
+
+  return result_end;
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -29,6 +29,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reverse.h>
+#include <thrust/system/detail/sequential/selection.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
 
@@ -182,6 +183,67 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
       sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_primitive_sort);));
 }
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  thrust::system::detail::sequential::introselect(first, nth, last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  if (first == middle)
+  {
+    return;
+  }
+
+  // select the elements which belong to [first, middle) and sort only those
+  thrust::system::detail::sequential::introselect(first, middle, last, comp);
+  thrust::system::detail::sequential::stable_sort(exec, first, middle, comp);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator partial_sort_copy(
+  sequential::execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  return thrust::system::detail::sequential::heap_select_copy(first, last, result_first, result_last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void segmented_sort(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  StrictWeakOrdering comp)
+{
+  if (offsets_first == offsets_last)
+  {
+    return;
+  }
+
+  for (OffsetIterator offset = offsets_first; offset + 1 != offsets_last; ++offset)
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first + offset[0], first + offset[1], comp);
+  }
+}
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
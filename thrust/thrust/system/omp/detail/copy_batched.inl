@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/copy_batched.h>
+#include <thrust/system/omp/detail/copy_batched.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+void copy_batched(
+  execution_policy<DerivedPolicy>&,
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size num_buffers)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputBufferIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_value<SizeIterator>::type size_type;
+
+  if (num_buffers <= 0)
+  {
+    return;
+  }
+
+  // sum the sizes of the buffers in each interval of the buffers
+  thrust::system::detail::internal::uniform_decomposition<Size> buffer_decomp = default_decomposition(num_buffers);
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  const std::int64_t num_buffer_intervals = static_cast<std::int64_t>(buffer_decomp.size());
+  std::vector<size_type> output_offsets(num_buffer_intervals + 1, size_type(0));
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t i = 0; i < num_buffer_intervals; ++i)
+  {
+    const Size interval = static_cast<Size>(i);
+    output_offsets[i + 1] = thrust::system::detail::internal::total_size(
+      sizes, buffer_decomp[interval].begin(), buffer_decomp[interval].end());
+  }
+
+  for (std::int64_t i = 0; i < num_buffer_intervals; ++i)
+  {
+    output_offsets[i + 1] += output_offsets[i];
+  }
+
+  const size_type n = output_offsets[num_buffer_intervals];
+
+  // XXX this value is a tuning opportunity
+  const size_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    thrust::copy_batched(thrust::seq, input_buffers, output_buffers, sizes, num_buffers);
+    return;
+  }
+
+  // divide the concatenation of all buffers rather than the buffers. Each
+  // interval of it starts its search for its first buffer at the beginning of
+  // the interval of the buffers which covers it.
+  thrust::system::detail::internal::uniform_decomposition<size_type> output_decomp = default_decomposition(n);
+
+  const std::int64_t num_output_intervals = static_cast<std::int64_t>(output_decomp.size());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t i = 0; i < num_output_intervals; ++i)
+  {
+    const size_type interval     = static_cast<size_type>(i);
+    const size_type output_begin = output_decomp[interval].begin();
+
+    std::int64_t buffer_interval = 0;
+    while (output_offsets[buffer_interval + 1] <= output_begin)
+    {
+      ++buffer_interval;
+    }
+
+    thrust::system::detail::internal::copy_buffers(
+      input_buffers,
+      output_buffers,
+      sizes,
+      buffer_decomp[static_cast<Size>(buffer_interval)].begin(),
+      output_offsets[buffer_interval],
+      output_begin,
+      output_decomp[interval].end());
+  }
+} // end copy_batched()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
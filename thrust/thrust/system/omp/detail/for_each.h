@@ -48,6 +48,9 @@ template <typename DerivedPolicy, typename RandomAccessIterator, typename Size,
 RandomAccessIterator
 for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f);
 
+template <typename DerivedPolicy, typename Extents, typename Function>
+void for_each_index(execution_policy<DerivedPolicy>& exec, const Extents& extents, Function f);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -30,8 +30,11 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/tiled_index_space.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
+#include <cuda/std/type_traits>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -82,6 +85,34 @@ for_each(execution_policy<DerivedPolicy>& s, RandomAccessIterator first, RandomA
   return omp::detail::for_each_n(s, first, thrust::distance(first, last), f);
 } // end for_each()
 
+template <typename DerivedPolicy, typename Extents, typename Function>
+void for_each_index(execution_policy<DerivedPolicy>&, const Extents& extents, Function f)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<Extents, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef thrust::system::detail::internal::tiled_index_space<Extents> space_type;
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  typedef typename ::cuda::std::make_signed<typename space_type::index_type>::type TileType;
+
+  const space_type space(extents);
+  const TileType num_tiles = static_cast<TileType>(space.num_tiles());
+
+  // threads take whole tiles, only the first index of a tile costs divisions
+  THRUST_PRAGMA_OMP(parallel for firstprivate(f))
+  for (TileType t = 0; t < num_tiles; ++t)
+  {
+    space.for_each_in_tile(static_cast<typename space_type::index_type>(t), f);
+  }
+} // end for_each_index()
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram_bins.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/histogram.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+template <typename InputIterator, typename OutputIterator, typename BinIndex>
+OutputIterator privatized_histogram(
+  InputIterator first, InputIterator last, OutputIterator histogram, int num_bins, BinIndex bin_index)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef typename thrust::system::detail::internal::histogram_counter<InputIterator, OutputIterator>::type
+    counter_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::system::detail::internal::serial_histogram(first, last, histogram, num_bins, bin_index);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(n);
+
+  // each interval of the input counts into a private histogram
+  const difference_type num_intervals = decomp.size();
+  std::vector<std::vector<counter_type>> counters(num_intervals, std::vector<counter_type>(num_bins, counter_type(0)));
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (difference_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::accumulate_histogram(
+      first + decomp[i].begin(), decomp[i].size(), bin_index, counters[i]);
+  }
+
+  // sum the private histograms into the first one, bin by bin
+  THRUST_PRAGMA_OMP(parallel for)
+  for (int bin = 0; bin < num_bins; ++bin)
+  {
+    for (difference_type i = 1; i < num_intervals; ++i)
+    {
+      counters[0][bin] += counters[i][bin];
+    }
+  }
+
+  for (int bin = 0; bin < num_bins; ++bin, ++histogram)
+  {
+    *histogram = counters[0][bin];
+  }
+
+  return histogram;
+} // end privatized_histogram()
+
+} // end namespace histogram_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return histogram_detail::privatized_histogram(
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  const int num_levels = static_cast<int>(levels_last - levels_first);
+
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return histogram_detail::privatized_histogram(
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator>(levels_first, num_bins));
+} // end histogram_range()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -25,7 +25,13 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
+#include <thrust/system/detail/internal/segments.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
@@ -70,6 +76,92 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
   return partial_sums[0];
 } // end reduce()
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return result;
+  }
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = offsets_first[num_segments] - begin;
+
+  // XXX this value is a tuning opportunity
+  const offset_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::segmented_reduce(thrust::seq, first, last, offsets_first, offsets_last, result, init, binary_op);
+  }
+
+  using thrust::system::detail::internal::first_segment_at;
+  using thrust::system::detail::internal::is_large_segment;
+
+  thrust::system::detail::internal::uniform_decomposition<offset_type> decomp = default_decomposition(n);
+
+  const segment_index num_intervals = decomp.size();
+  const offset_type max_size        = decomp[0].size();
+
+  // reduce the segments which begin in each interval, except for the large
+  // ones. The last interval also takes the empty segments at the end.
+  THRUST_PRAGMA_OMP(parallel for)
+  for (segment_index i = 0; i < num_intervals; ++i)
+  {
+    const segment_index segments_begin = first_segment_at(offsets_first, num_segments, begin + decomp[i].begin());
+    const segment_index segments_end =
+      i + 1 == num_intervals ? num_segments : first_segment_at(offsets_first, num_segments, begin + decomp[i].end());
+
+    for (segment_index s = segments_begin; s < segments_end; ++s)
+    {
+      if (!is_large_segment(offsets_first, s, max_size))
+      {
+        result[s] =
+          thrust::reduce(thrust::seq, first + offsets_first[s], first + offsets_first[s + 1], init, binary_op);
+      }
+    }
+  }
+
+  // reduce the large segments one after another with all threads
+  for (segment_index s = 0; s < num_segments; ++s)
+  {
+    if (is_large_segment(offsets_first, s, max_size))
+    {
+      result[s] = thrust::reduce(exec, first + offsets_first[s], first + offsets_first[s + 1], init, binary_op);
+    }
+  }
+
+  return result + num_segments;
+} // end segmented_reduce()
+
 } // namespace detail
 } // namespace omp
 } // namespace system
@@ -25,10 +25,18 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
 #include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/internal/hash_reduce_table.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
+#include <vector>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -59,6 +67,86 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
 } // end reduce_by_key()
 
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+typename thrust::system::detail::internal::enable_if_hashable_keys<
+  InputIterator1,
+  thrust::pair<OutputIterator1, OutputIterator2>>::type
+reduce_by_key_unsorted(
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type difference_type;
+  typedef typename thrust::iterator_value<InputIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<InputIterator2>::type ValueType;
+  typedef thrust::system::detail::internal::hash_reduce_table<KeyType, ValueType, BinaryPredicate, BinaryFunction>
+    table_type;
+
+  const difference_type n = thrust::distance(keys_first, keys_last);
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::reduce_by_key_unsorted(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(n);
+
+  // each interval of the input accumulates into a private table
+  const difference_type num_intervals = decomp.size();
+  std::vector<table_type> tables(num_intervals, table_type(binary_pred, binary_op));
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (difference_type i = 0; i < num_intervals; ++i)
+  {
+    InputIterator1 keys     = keys_first + decomp[i].begin();
+    InputIterator1 keys_end = keys_first + decomp[i].end();
+    InputIterator2 values   = values_first + decomp[i].begin();
+    table_type& local_table = tables[i];
+
+    for (; keys != keys_end; ++keys, ++values)
+    {
+      local_table.insert(*keys, *values);
+    }
+  }
+
+  // merge neighboring tables pairwise, so that the keys keep the order of their first occurrence
+  for (difference_type stride = 1; stride < num_intervals; stride *= 2)
+  {
+    THRUST_PRAGMA_OMP(parallel for)
+    for (difference_type i = 0; i < num_intervals - stride; i += 2 * stride)
+    {
+      tables[i].merge(tables[i + stride]);
+    }
+  }
+
+  return tables[0].copy_to(keys_output, values_output);
+} // end reduce_by_key_unsorted()
+
 } // namespace detail
 } // namespace omp
 } // namespace system
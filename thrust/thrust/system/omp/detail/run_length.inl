@@ -0,0 +1,268 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/run_length.h>
+#include <thrust/system/detail/internal/run_length.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/run_length.h>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace run_length_detail
+{
+
+// writes the runs of [first, first + n) with writer and returns their number
+template <typename RandomAccessIterator, typename Size, typename RunWriter>
+Size encode_runs(RandomAccessIterator first, Size n, const RunWriter& writer)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = default_decomposition(n);
+
+  const Size num_intervals = decomp.size();
+  std::vector<Size> num_runs(num_intervals);
+  std::vector<Size> first_runs(num_intervals);
+
+  // count the runs which begin in each interval
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size i = 0; i < num_intervals; ++i)
+  {
+    num_runs[i] = thrust::system::detail::internal::count_runs(
+      first, n, decomp[i].begin(), decomp[i].end(), writer, first_runs[i]);
+  }
+
+  // scan the counts, and find where the run which is open at the end of each
+  // interval ends
+  std::vector<Size> run_offsets(num_intervals + 1, Size(0));
+  std::vector<Size> next_runs(num_intervals);
+
+  for (Size i = 0; i < num_intervals; ++i)
+  {
+    run_offsets[i + 1] = run_offsets[i] + num_runs[i];
+  }
+
+  Size next_run = n;
+  for (Size i = num_intervals; i > 0; --i)
+  {
+    next_runs[i - 1] = next_run;
+
+    if (first_runs[i - 1] != decomp[i - 1].end())
+    {
+      next_run = first_runs[i - 1];
+    }
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::write_runs(
+      first, decomp[i].begin(), decomp[i].end(), next_runs[i], run_offsets[i], writer);
+  }
+
+  return run_offsets[num_intervals];
+} // end encode_runs()
+
+} // end namespace run_length_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::run_length_encode(thrust::seq, first, last, values_output, counts_output);
+  }
+
+  const difference_type num_runs = run_length_detail::encode_runs(
+    first,
+    n,
+    thrust::system::detail::internal::run_writer<RandomAccessIterator, OutputIterator1, OutputIterator2>(
+      first, values_output, counts_output));
+
+  return thrust::make_pair(values_output + num_runs, counts_output + num_runs);
+} // end run_length_encode()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::run_length_encode_non_trivial_runs(thrust::seq, first, last, offsets_output, lengths_output);
+  }
+
+  const difference_type num_runs = run_length_detail::encode_runs(
+    first,
+    n,
+    thrust::system::detail::internal::non_trivial_run_writer<RandomAccessIterator, OutputIterator1, OutputIterator2>(
+      first, offsets_output, lengths_output));
+
+  return thrust::make_pair(offsets_output + num_runs, lengths_output + num_runs);
+} // end run_length_encode_non_trivial_runs()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator run_length_decode(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  const difference_type num_runs = values_last - values_first;
+
+  if (num_runs == 0)
+  {
+    return result;
+  }
+
+  // sum the lengths of the runs in each interval of the runs
+  thrust::system::detail::internal::uniform_decomposition<difference_type> run_decomp =
+    default_decomposition(num_runs);
+
+  const difference_type num_run_intervals = run_decomp.size();
+  std::vector<difference_type> output_offsets(num_run_intervals + 1, difference_type(0));
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (difference_type i = 0; i < num_run_intervals; ++i)
+  {
+    difference_type sum = 0;
+
+    for (difference_type run = run_decomp[i].begin(); run < run_decomp[i].end(); ++run)
+    {
+      sum += static_cast<difference_type>(counts_first[run]);
+    }
+
+    output_offsets[i + 1] = sum;
+  }
+
+  for (difference_type i = 0; i < num_run_intervals; ++i)
+  {
+    output_offsets[i + 1] += output_offsets[i];
+  }
+
+  const difference_type n = output_offsets[num_run_intervals];
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::run_length_decode(thrust::seq, values_first, values_last, counts_first, result);
+  }
+
+  // divide the output rather than the runs, so that a few long runs don't
+  // leave all but a few threads idle. Each interval of the output starts its
+  // search for its first run at the beginning of the interval of the runs
+  // which covers it.
+  thrust::system::detail::internal::uniform_decomposition<difference_type> output_decomp = default_decomposition(n);
+
+  const difference_type num_output_intervals = output_decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (difference_type i = 0; i < num_output_intervals; ++i)
+  {
+    const difference_type output_begin = output_decomp[i].begin();
+
+    difference_type run_interval = 0;
+    while (output_offsets[run_interval + 1] <= output_begin)
+    {
+      ++run_interval;
+    }
+
+    thrust::system::detail::internal::decode_runs(
+      values_first,
+      counts_first,
+      run_decomp[run_interval].begin(),
+      output_offsets[run_interval],
+      output_begin,
+      output_decomp[i].end(),
+      result);
+  }
+
+  return result + n;
+} // end run_length_decode()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
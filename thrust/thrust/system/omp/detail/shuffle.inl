@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstdint>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+// gathers the first k elements of the permutation of [first, first + m)
+// defined by bijection to result
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator>
+void gather_permutation(
+  execution_policy<DerivedPolicy>& exec,
+  const thrust::system::detail::generic::feistel_bijection& bijection,
+  std::uint64_t m,
+  std::uint64_t k,
+  RandomIterator first,
+  OutputIterator result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  const std::uint64_t n = bijection.nearest_power_of_two();
+
+  thrust::system::detail::internal::uniform_decomposition<std::uint64_t> decomp = default_decomposition(n);
+
+  // use a signed type for the iteration variable or suffer the consequences of warnings
+  const std::int64_t num_intervals = static_cast<std::int64_t>(decomp.size());
+  std::vector<std::uint64_t> offsets(num_intervals + 1, 0);
+
+  // every interval stores its images in its own part of the buffer
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> buffer(exec, n);
+  std::uint64_t* images = thrust::raw_pointer_cast(buffer.data());
+
+  // store and count the images in [0, m) of each interval
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t i = 0; i < num_intervals; ++i)
+  {
+    const std::uint64_t begin = decomp[static_cast<std::uint64_t>(i)].begin();
+    const std::uint64_t end   = decomp[static_cast<std::uint64_t>(i)].end();
+
+    offsets[i + 1] = thrust::system::detail::internal::collect_shuffled(bijection, m, begin, end, images + begin);
+  }
+
+  for (std::int64_t i = 0; i < num_intervals; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (std::int64_t i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::gather_shuffled(
+      images + decomp[static_cast<std::uint64_t>(i)].begin(),
+      offsets[i + 1] - offsets[i],
+      offsets[i],
+      k,
+      first,
+      result);
+  }
+} // end gather_permutation()
+
+} // end namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  const std::uint64_t m = last - first;
+
+  // XXX this value is a tuning opportunity
+  const std::uint64_t parallelism_threshold = 10000;
+
+  if (m < parallelism_threshold)
+  {
+    // don't bother parallelizing for small m
+    thrust::shuffle_copy(thrust::seq, first, last, result, g);
+    return;
+  }
+
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  shuffle_detail::gather_permutation(exec, bijection, m, m, first, result);
+} // end shuffle_copy()
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+OutputIterator sample(
+  execution_policy<DerivedPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g)
+{
+  const std::uint64_t m = last - first;
+
+  // XXX this value is a tuning opportunity
+  const std::uint64_t parallelism_threshold = 10000;
+
+  if (m < parallelism_threshold)
+  {
+    // don't bother parallelizing for small m
+    return thrust::sample(thrust::seq, first, last, result, k, g);
+  }
+
+  thrust::system::detail::generic::feistel_bijection bijection(m, g);
+
+  const std::uint64_t num_selected = k > Size(0) ? (thrust::min)(static_cast<std::uint64_t>(k), m) : 0;
+
+  shuffle_detail::gather_permutation(exec, bijection, m, num_selected, first, result);
+
+  return result + num_selected;
+} // end sample()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
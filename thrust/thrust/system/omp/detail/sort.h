@@ -52,6 +52,37 @@ void stable_sort_by_key(
   RandomAccessIterator2 values_first,
   StrictWeakOrdering comp);
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(execution_policy<DerivedPolicy>& exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+void segmented_sort(execution_policy<DerivedPolicy>& exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OffsetIterator offsets_first,
+                    OffsetIterator offsets_last,
+                    StrictWeakOrdering comp);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -31,13 +31,19 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/detail/minmax.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/sort.h>
+#include <thrust/system/detail/internal/segments.h>
+#include <thrust/system/detail/sequential/selection.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -255,6 +261,169 @@ void stable_sort_by_key(
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  // omp prefers generic::nth_element to cpp::nth_element
+  thrust::system::detail::generic::nth_element(exec, first, nth, last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(execution_policy<DerivedPolicy>& exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  // omp prefers generic::partial_sort to cpp::partial_sort
+  thrust::system::detail::generic::partial_sort(exec, first, middle, last, comp);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  const difference_type n = thrust::distance(first, last);
+  const difference_type k = thrust::min<difference_type>(result_last - result_first, n);
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    return thrust::system::detail::sequential::heap_select_copy(first, last, result_first, result_last, comp);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = default_decomposition(n);
+
+  const difference_type num_intervals = decomp.size();
+
+  // when the heaps would hold a sizeable part of every interval, selecting
+  // by partitioning does less work. The last interval is the smallest one.
+  // XXX this value is a tuning opportunity
+  if (8 * k > decomp[num_intervals - 1].size())
+  {
+    return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  // every interval selects its k candidates into a heap of its own, and the
+  // result is selected from the candidates. Every interval holds at least k
+  // elements, so every heap is full.
+  thrust::detail::temporary_array<value_type, DerivedPolicy> candidates(exec, num_intervals * k);
+  value_type* candidates_first = thrust::raw_pointer_cast(candidates.data());
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for (difference_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::sequential::heap_select_copy(
+      first + decomp[i].begin(),
+      first + decomp[i].end(),
+      candidates_first + i * k,
+      candidates_first + (i + 1) * k,
+      comp);
+  }
+
+  return thrust::system::detail::sequential::heap_select_copy(
+    candidates_first, candidates_first + num_intervals * k, result_first, result_last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+void segmented_sort(execution_policy<DerivedPolicy>& exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OffsetIterator offsets_first,
+                    OffsetIterator offsets_last,
+                    StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return;
+  }
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = offsets_first[num_segments] - begin;
+
+  // XXX this value is a tuning opportunity
+  const offset_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    thrust::segmented_sort(thrust::seq, first, last, offsets_first, offsets_last, comp);
+    return;
+  }
+
+  using thrust::system::detail::internal::first_segment_at;
+  using thrust::system::detail::internal::is_large_segment;
+
+  thrust::system::detail::internal::uniform_decomposition<offset_type> decomp = default_decomposition(n);
+
+  const segment_index num_intervals = decomp.size();
+  const offset_type max_size        = decomp[0].size();
+
+  // sort the segments which begin in each interval, except for the large ones
+  THRUST_PRAGMA_OMP(parallel for)
+  for (segment_index i = 0; i < num_intervals; ++i)
+  {
+    const segment_index segments_begin = first_segment_at(offsets_first, num_segments, begin + decomp[i].begin());
+    const segment_index segments_end =
+      i + 1 == num_intervals ? num_segments : first_segment_at(offsets_first, num_segments, begin + decomp[i].end());
+
+    for (segment_index s = segments_begin; s < segments_end; ++s)
+    {
+      if (!is_large_segment(offsets_first, s, max_size))
+      {
+        thrust::sort(thrust::seq, first + offsets_first[s], first + offsets_first[s + 1], comp);
+      }
+    }
+  }
+
+  // sort the large segments one after another with all threads
+  for (segment_index s = 0; s < num_segments; ++s)
+  {
+    if (is_large_segment(offsets_first, s, max_size))
+    {
+      thrust::sort(exec, first + offsets_first[s], first + offsets_first[s + 1], comp);
+    }
+  }
+}
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
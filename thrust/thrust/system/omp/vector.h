@@ -33,6 +33,15 @@
 #include <thrust/detail/vector_base.h>
 #include <thrust/system/omp/memory.h>
 
+// vector_base relocates, fills and destroys its elements with thrust::copy and
+// thrust::for_each; make sure those find this system's parallel versions instead
+// of the sequential ones omp::tag inherits from cpp. Without OpenMP, the vector
+// keeps using the sequential ones, the parallel ones wouldn't compile
+#if THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE
+#  include <thrust/system/omp/detail/copy.h>
+#  include <thrust/system/omp/detail/for_each.h>
+#endif
+
 #include <vector>
 
 THRUST_NAMESPACE_BEGIN
@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/copy_batched.h>
+#include <thrust/system/tbb/detail/copy_batched.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace copy_batched_detail
+{
+
+// generates one interval of sequential work per processor
+template <typename Size>
+Size interval_size_for(Size n)
+{
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  const Size num_threads = static_cast<Size>(p);
+  return (n + num_threads - 1) / num_threads;
+}
+
+template <typename SizeIterator, typename Size>
+struct sum_body
+{
+  typedef typename thrust::iterator_value<SizeIterator>::type size_type;
+
+  SizeIterator sizes;
+  size_type* sums;
+  Size num_buffers;
+  Size interval_size;
+
+  sum_body(SizeIterator sizes, size_type* sums, Size num_buffers, Size interval_size)
+      : sizes(sizes)
+      , sums(sums)
+      , num_buffers(num_buffers)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const Size offset_to_first = interval_size * interval_idx;
+      const Size offset_to_last  = (thrust::min)(num_buffers, offset_to_first + interval_size);
+
+      sums[interval_idx] = thrust::system::detail::internal::total_size(sizes, offset_to_first, offset_to_last);
+    }
+  }
+};
+
+template <typename InputBufferIterator, typename OutputBufferIterator, typename SizeIterator, typename Size>
+struct copy_body
+{
+  typedef typename thrust::iterator_value<SizeIterator>::type size_type;
+
+  InputBufferIterator input_buffers;
+  OutputBufferIterator output_buffers;
+  SizeIterator sizes;
+  const size_type* output_offsets;
+  Size buffer_interval_size;
+  size_type n;
+  size_type interval_size;
+
+  copy_body(InputBufferIterator input_buffers,
+            OutputBufferIterator output_buffers,
+            SizeIterator sizes,
+            const size_type* output_offsets,
+            Size buffer_interval_size,
+            size_type n,
+            size_type interval_size)
+      : input_buffers(input_buffers)
+      , output_buffers(output_buffers)
+      , sizes(sizes)
+      , output_offsets(output_offsets)
+      , buffer_interval_size(buffer_interval_size)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      // start the search for the first buffer at the beginning of the
+      // interval of the buffers which covers offset_to_first
+      Size buffer_interval = 0;
+      while (output_offsets[buffer_interval + 1] <= offset_to_first)
+      {
+        ++buffer_interval;
+      }
+
+      thrust::system::detail::internal::copy_buffers(
+        input_buffers,
+        output_buffers,
+        sizes,
+        buffer_interval_size * buffer_interval,
+        output_offsets[buffer_interval],
+        offset_to_first,
+        offset_to_last);
+    }
+  }
+};
+
+} // end namespace copy_batched_detail
+
+template <typename DerivedPolicy,
+          typename InputBufferIterator,
+          typename OutputBufferIterator,
+          typename SizeIterator,
+          typename Size>
+void copy_batched(
+  execution_policy<DerivedPolicy>&,
+  InputBufferIterator input_buffers,
+  OutputBufferIterator output_buffers,
+  SizeIterator sizes,
+  Size num_buffers)
+{
+  typedef typename thrust::iterator_value<SizeIterator>::type size_type;
+
+  if (num_buffers <= 0)
+  {
+    return;
+  }
+
+  // sum the sizes of the buffers in each interval of the buffers
+  const Size buffer_interval_size = copy_batched_detail::interval_size_for(num_buffers);
+  const Size num_buffer_intervals = (num_buffers + buffer_interval_size - 1) / buffer_interval_size;
+
+  std::vector<size_type> output_offsets(num_buffer_intervals + 1, size_type(0));
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_buffer_intervals, 1),
+                      copy_batched_detail::sum_body<SizeIterator, Size>(
+                        sizes, output_offsets.data() + 1, num_buffers, buffer_interval_size),
+                      ::tbb::simple_partitioner());
+
+  for (Size i = 0; i < num_buffer_intervals; ++i)
+  {
+    output_offsets[i + 1] += output_offsets[i];
+  }
+
+  const size_type n = output_offsets[num_buffer_intervals];
+
+  // XXX this value is a tuning opportunity
+  const size_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    thrust::copy_batched(thrust::seq, input_buffers, output_buffers, sizes, num_buffers);
+    return;
+  }
+
+  // divide the concatenation of all buffers rather than the buffers
+  const size_type interval_size = copy_batched_detail::interval_size_for(n);
+  const size_type num_intervals = (n + interval_size - 1) / interval_size;
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<size_type>(0, num_intervals, 1),
+    copy_batched_detail::copy_body<InputBufferIterator, OutputBufferIterator, SizeIterator, Size>(
+      input_buffers, output_buffers, sizes, output_offsets.data(), buffer_interval_size, n, interval_size),
+    ::tbb::simple_partitioner());
+} // end copy_batched()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
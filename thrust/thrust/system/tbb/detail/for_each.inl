@@ -28,6 +28,7 @@
 #include <thrust/detail/static_assert.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/tiled_index_space.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
 
 #include <tbb/blocked_range.h>
@@ -67,6 +68,29 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
   return body<RandomAccessIterator, Size, UnaryFunction>(first, f);
 } // end make_body()
 
+template <typename Space, typename Function>
+struct index_body
+{
+  const Space& m_space;
+  Function m_f;
+
+  index_body(const Space& space, Function f)
+      : m_space(space)
+      , m_f(f)
+  {}
+
+  void operator()(const ::tbb::blocked_range<typename Space::index_type>& r) const
+  {
+    // every task gets its own copy of the function object
+    Function f = m_f;
+
+    for (typename Space::index_type t = r.begin(); t != r.end(); ++t)
+    {
+      m_space.for_each_in_tile(t, f);
+    }
+  } // end operator()()
+}; // end index_body
+
 } // namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
@@ -85,6 +109,19 @@ for_each(execution_policy<DerivedPolicy>& s, RandomAccessIterator first, RandomA
   return tbb::detail::for_each_n(s, first, thrust::distance(first, last), f);
 } // end for_each()
 
+template <typename DerivedPolicy, typename Extents, typename Function>
+void for_each_index(execution_policy<DerivedPolicy>&, const Extents& extents, Function f)
+{
+  typedef thrust::system::detail::internal::tiled_index_space<Extents> space_type;
+  typedef typename space_type::index_type index_type;
+
+  const space_type space(extents);
+
+  // tiles are already sized to amortize the cost of a task, so no coarser grain is needed
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, space.num_tiles()),
+                      for_each_detail::index_body<space_type, Function>(space, f));
+} // end for_each_index()
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
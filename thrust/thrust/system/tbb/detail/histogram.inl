@@ -0,0 +1,209 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram_bins.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/histogram.h>
+
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+template <typename InputIterator, typename BinIndex, typename Counter>
+struct accumulate_body
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type size_type;
+
+  InputIterator first;
+  BinIndex bin_index;
+  std::vector<Counter>* counters;
+  size_type n;
+  size_type interval_size;
+
+  accumulate_body(
+    InputIterator first, BinIndex bin_index, std::vector<Counter>* counters, size_type n, size_type interval_size)
+      : first(first)
+      , bin_index(bin_index)
+      , counters(counters)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      thrust::system::detail::internal::accumulate_histogram(
+        first + offset_to_first, offset_to_last - offset_to_first, bin_index, counters[interval_idx]);
+    }
+  }
+};
+
+template <typename Counter>
+struct merge_body
+{
+  std::vector<Counter>* counters;
+  std::size_t num_intervals;
+
+  merge_body(std::vector<Counter>* counters, std::size_t num_intervals)
+      : counters(counters)
+      , num_intervals(num_intervals)
+  {}
+
+  void operator()(const ::tbb::blocked_range<int>& r) const
+  {
+    for (int bin = r.begin(); bin != r.end(); ++bin)
+    {
+      for (std::size_t i = 1; i < num_intervals; ++i)
+      {
+        counters[0][bin] += counters[i][bin];
+      }
+    }
+  }
+};
+
+template <typename InputIterator, typename OutputIterator, typename BinIndex>
+OutputIterator privatized_histogram(
+  InputIterator first, InputIterator last, OutputIterator histogram, int num_bins, BinIndex bin_index)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef typename thrust::system::detail::internal::histogram_counter<InputIterator, OutputIterator>::type
+    counter_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::system::detail::internal::serial_histogram(first, last, histogram, num_bins, bin_index);
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate one interval of sequential work per processor, each with a private histogram
+  const difference_type num_threads   = static_cast<difference_type>(p);
+  const difference_type interval_size = (n + num_threads - 1) / num_threads;
+  const difference_type num_intervals = (n + interval_size - 1) / interval_size;
+
+  std::vector<std::vector<counter_type>> counters(num_intervals, std::vector<counter_type>(num_bins, counter_type(0)));
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+                      accumulate_body<InputIterator, BinIndex, counter_type>(
+                        first, bin_index, counters.data(), n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  // sum the private histograms into the first one, bin by bin
+  ::tbb::parallel_for(::tbb::blocked_range<int>(0, num_bins),
+                      merge_body<counter_type>(counters.data(), counters.size()));
+
+  for (int bin = 0; bin < num_bins; ++bin, ++histogram)
+  {
+    *histogram = counters[0][bin];
+  }
+
+  return histogram;
+} // end privatized_histogram()
+
+} // end namespace histogram_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return histogram_detail::privatized_histogram(
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename RandomAccessIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>&,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator histogram,
+  RandomAccessIterator levels_first,
+  RandomAccessIterator levels_last)
+{
+  const int num_levels = static_cast<int>(levels_last - levels_first);
+
+  if (num_levels < 2)
+  {
+    return histogram;
+  }
+
+  const int num_bins = num_levels - 1;
+
+  return histogram_detail::privatized_histogram(
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator>(levels_first, num_bins));
+} // end histogram_range()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/scratch_arena_aware_execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -39,6 +40,7 @@ namespace detail
 struct par_t
     : thrust::system::tbb::detail::execution_policy<par_t>
     , thrust::detail::allocator_aware_execution_policy<thrust::system::tbb::detail::execution_policy>
+    , thrust::detail::scratch_arena_aware_execution_policy<thrust::system::tbb::detail::execution_policy>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::tbb::detail::execution_policy<par_t>()
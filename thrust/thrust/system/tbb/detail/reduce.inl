@@ -26,12 +26,18 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/segments.h>
+
+#include <thread>
 
 #include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -110,6 +116,79 @@ struct body
 
 } // namespace reduce_detail
 
+namespace segmented_reduce_detail
+{
+
+// reduces the segments which begin in each interval, except for the large ones
+template <typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+struct reduce_body
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  RandomAccessIterator first;
+  OffsetIterator offsets_first;
+  OutputIterator result;
+  T init;
+  BinaryFunction binary_op;
+  segment_index num_segments;
+  offset_type begin;
+  offset_type n;
+  offset_type interval_size;
+
+  reduce_body(RandomAccessIterator first,
+              OffsetIterator offsets_first,
+              OutputIterator result,
+              T init,
+              BinaryFunction binary_op,
+              segment_index num_segments,
+              offset_type begin,
+              offset_type n,
+              offset_type interval_size)
+      : first(first)
+      , offsets_first(offsets_first)
+      , result(result)
+      , init(init)
+      , binary_op(binary_op)
+      , num_segments(num_segments)
+      , begin(begin)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<segment_index>& r) const
+  {
+    using thrust::system::detail::internal::first_segment_at;
+    using thrust::system::detail::internal::is_large_segment;
+
+    for (segment_index interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const offset_type offset_to_first = interval_size * static_cast<offset_type>(interval_idx);
+      const offset_type offset_to_last  = offset_to_first + interval_size;
+
+      // the last interval also takes the empty segments at the end
+      const segment_index segments_begin = first_segment_at(offsets_first, num_segments, begin + offset_to_first);
+      const segment_index segments_end =
+        offset_to_last >= n ? num_segments : first_segment_at(offsets_first, num_segments, begin + offset_to_last);
+
+      for (segment_index s = segments_begin; s < segments_end; ++s)
+      {
+        if (!is_large_segment(offsets_first, s, interval_size))
+        {
+          result[s] =
+            thrust::reduce(thrust::seq, first + offsets_first[s], first + offsets_first[s + 1], init, binary_op);
+        }
+      }
+    }
+  }
+};
+
+} // end namespace segmented_reduce_detail
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
 OutputType reduce(
   execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
@@ -131,6 +210,71 @@ OutputType reduce(
   }
 }
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename T,
+          typename BinaryFunction>
+OutputIterator segmented_reduce(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OffsetIterator offsets_first,
+  OffsetIterator offsets_last,
+  OutputIterator result,
+  T init,
+  BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return result;
+  }
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = offsets_first[num_segments] - begin;
+
+  // XXX this value is a tuning opportunity
+  const offset_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::segmented_reduce(thrust::seq, first, last, offsets_first, offsets_last, result, init, binary_op);
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate one interval of sequential work per processor
+  const offset_type num_threads     = static_cast<offset_type>(p);
+  const offset_type interval_size   = (n + num_threads - 1) / num_threads;
+  const segment_index num_intervals = static_cast<segment_index>((n + interval_size - 1) / interval_size);
+
+  typedef segmented_reduce_detail::reduce_body<RandomAccessIterator, OffsetIterator, OutputIterator, T, BinaryFunction>
+    Body;
+
+  ::tbb::parallel_for(::tbb::blocked_range<segment_index>(0, num_intervals, 1),
+                      Body(first, offsets_first, result, init, binary_op, num_segments, begin, n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  // reduce the segments which are larger than an interval one after another with all threads
+  for (segment_index s = 0; s < num_segments; ++s)
+  {
+    if (thrust::system::detail::internal::is_large_segment(offsets_first, s, interval_size))
+    {
+      result[s] = thrust::reduce(exec, first + offsets_first[s], first + offsets_first[s + 1], init, binary_op);
+    }
+  }
+
+  return result + num_segments;
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
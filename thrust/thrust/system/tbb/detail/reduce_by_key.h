@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/pair.h>
+#include <thrust/system/detail/internal/hash_reduce_table.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -53,6 +54,26 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op);
 
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+typename thrust::system::detail::internal::enable_if_hashable_keys<
+  InputIterator1,
+  thrust::pair<OutputIterator1, OutputIterator2>>::type
+reduce_by_key_unsorted(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op);
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
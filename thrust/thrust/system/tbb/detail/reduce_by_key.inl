@@ -30,12 +30,14 @@
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/reverse_iterator.h>
+#include <thrust/system/detail/internal/hash_reduce_table.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
 
 #include <cassert>
 #include <thread>
+#include <vector>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -289,6 +291,66 @@ make_serial_reduce_by_key_body(
     binary_op);
 }
 
+template <typename Iterator1, typename Iterator2, typename Table>
+struct hash_reduce_body
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type size_type;
+
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Table* tables;
+  size_type n;
+  size_type interval_size;
+
+  hash_reduce_body(Iterator1 keys_first, Iterator2 values_first, Table* tables, size_type n, size_type interval_size)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , tables(tables)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      Iterator1 my_keys_first   = keys_first + offset_to_first;
+      Iterator1 my_keys_last    = keys_first + offset_to_last;
+      Iterator2 my_values_first = values_first + offset_to_first;
+
+      for (; my_keys_first != my_keys_last; ++my_keys_first, ++my_values_first)
+      {
+        tables[interval_idx].insert(*my_keys_first, *my_values_first);
+      }
+    }
+  }
+};
+
+template <typename Table, typename Size>
+struct hash_reduce_merge_body
+{
+  Table* tables;
+  Size stride;
+
+  hash_reduce_merge_body(Table* tables, Size stride)
+      : tables(tables)
+      , stride(stride)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    // the range enumerates pairs of neighboring tables
+    for (Size pair_idx = r.begin(); pair_idx != r.end(); ++pair_idx)
+    {
+      const Size i = 2 * stride * pair_idx;
+      tables[i].merge(tables[i + stride]);
+    }
+  }
+};
+
 } // namespace reduce_by_key_detail
 
 template <typename DerivedPolicy,
@@ -400,6 +462,71 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   return thrust::make_pair(keys_result + size_of_result, values_result + size_of_result);
 }
 
+template <typename DerivedPolicy,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+typename thrust::system::detail::internal::enable_if_hashable_keys<
+  Iterator1,
+  thrust::pair<Iterator3, Iterator4>>::type
+reduce_by_key_unsorted(
+  thrust::tbb::execution_policy<DerivedPolicy>&,
+  Iterator1 keys_first,
+  Iterator1 keys_last,
+  Iterator2 values_first,
+  Iterator3 keys_result,
+  Iterator4 values_result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
+  typedef typename thrust::iterator_value<Iterator1>::type key_type;
+  typedef typename thrust::iterator_value<Iterator2>::type value_type;
+  typedef thrust::system::detail::internal::hash_reduce_table<key_type, value_type, BinaryPredicate, BinaryFunction>
+    table_type;
+
+  difference_type n = keys_last - keys_first;
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::reduce_by_key_unsorted(
+      thrust::seq, keys_first, keys_last, values_first, keys_result, values_result, binary_pred, binary_op);
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate one interval of sequential work per processor, each with a private table
+  difference_type interval_size = reduce_by_key_detail::divide_ri(n, static_cast<difference_type>(p));
+  difference_type num_intervals = reduce_by_key_detail::divide_ri(n, interval_size);
+
+  std::vector<table_type> tables(num_intervals, table_type(binary_pred, binary_op));
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+                      reduce_by_key_detail::hash_reduce_body<Iterator1, Iterator2, table_type>(
+                        keys_first, values_first, tables.data(), n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  // merge neighboring tables pairwise, so that the keys keep the order of their first occurrence
+  for (difference_type stride = 1; stride < num_intervals; stride *= 2)
+  {
+    const difference_type num_pairs = reduce_by_key_detail::divide_ri(num_intervals - stride, 2 * stride);
+
+    ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_pairs, 1),
+                        reduce_by_key_detail::hash_reduce_merge_body<table_type, difference_type>(tables.data(), stride),
+                        ::tbb::simple_partitioner());
+  }
+
+  return tables[0].copy_to(keys_result, values_result);
+}
+
 } // namespace detail
 } // namespace tbb
 } // namespace system
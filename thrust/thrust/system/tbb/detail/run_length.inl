@@ -0,0 +1,402 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in ctbbliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/run_length.h>
+#include <thrust/system/detail/internal/run_length.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/run_length.h>
+
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace run_length_detail
+{
+
+// generates one interval of sequential work per processor
+template <typename Size>
+Size interval_size_for(Size n)
+{
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  const Size num_threads = static_cast<Size>(p);
+  return (n + num_threads - 1) / num_threads;
+}
+
+template <typename RandomAccessIterator, typename RunWriter>
+struct count_body
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  RandomAccessIterator first;
+  RunWriter writer;
+  size_type* num_runs;
+  size_type* first_runs;
+  size_type n;
+  size_type interval_size;
+
+  count_body(RandomAccessIterator first,
+             RunWriter writer,
+             size_type* num_runs,
+             size_type* first_runs,
+             size_type n,
+             size_type interval_size)
+      : first(first)
+      , writer(writer)
+      , num_runs(num_runs)
+      , first_runs(first_runs)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      num_runs[interval_idx] = thrust::system::detail::internal::count_runs(
+        first, n, offset_to_first, offset_to_last, writer, first_runs[interval_idx]);
+    }
+  }
+};
+
+template <typename RandomAccessIterator, typename RunWriter>
+struct write_body
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  RandomAccessIterator first;
+  RunWriter writer;
+  const size_type* run_offsets;
+  const size_type* next_runs;
+  size_type n;
+  size_type interval_size;
+
+  write_body(RandomAccessIterator first,
+             RunWriter writer,
+             const size_type* run_offsets,
+             const size_type* next_runs,
+             size_type n,
+             size_type interval_size)
+      : first(first)
+      , writer(writer)
+      , run_offsets(run_offsets)
+      , next_runs(next_runs)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      thrust::system::detail::internal::write_runs(
+        first, offset_to_first, offset_to_last, next_runs[interval_idx], run_offsets[interval_idx], writer);
+    }
+  }
+};
+
+// writes the runs of [first, first + n) with writer and returns their number
+template <typename RandomAccessIterator, typename Size, typename RunWriter>
+Size encode_runs(RandomAccessIterator first, Size n, const RunWriter& writer)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type size_type;
+
+  const size_type interval_size = interval_size_for(n);
+  const size_type num_intervals = (n + interval_size - 1) / interval_size;
+
+  std::vector<size_type> num_runs(num_intervals);
+  std::vector<size_type> first_runs(num_intervals);
+
+  // count the runs which begin in each interval
+  ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, num_intervals, 1),
+                      count_body<RandomAccessIterator, RunWriter>(
+                        first, writer, num_runs.data(), first_runs.data(), n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  // scan the counts, and find where the run which is open at the end of each
+  // interval ends
+  std::vector<size_type> run_offsets(num_intervals + 1, size_type(0));
+  std::vector<size_type> next_runs(num_intervals);
+
+  for (size_type i = 0; i < num_intervals; ++i)
+  {
+    run_offsets[i + 1] = run_offsets[i] + num_runs[i];
+  }
+
+  size_type next_run = n;
+  for (size_type i = num_intervals; i > 0; --i)
+  {
+    next_runs[i - 1] = next_run;
+
+    if (first_runs[i - 1] != (thrust::min)(n, interval_size * i))
+    {
+      next_run = first_runs[i - 1];
+    }
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<size_type>(0, num_intervals, 1),
+                      write_body<RandomAccessIterator, RunWriter>(
+                        first, writer, run_offsets.data(), next_runs.data(), n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  return run_offsets[num_intervals];
+} // end encode_runs()
+
+template <typename RandomAccessIterator, typename Size>
+struct sum_body
+{
+  RandomAccessIterator counts_first;
+  Size* sums;
+  Size num_runs;
+  Size interval_size;
+
+  sum_body(RandomAccessIterator counts_first, Size* sums, Size num_runs, Size interval_size)
+      : counts_first(counts_first)
+      , sums(sums)
+      , num_runs(num_runs)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const Size offset_to_first = interval_size * interval_idx;
+      const Size offset_to_last  = (thrust::min)(num_runs, offset_to_first + interval_size);
+
+      Size sum = 0;
+
+      for (Size run = offset_to_first; run < offset_to_last; ++run)
+      {
+        sum += static_cast<Size>(counts_first[run]);
+      }
+
+      sums[interval_idx] = sum;
+    }
+  }
+};
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator, typename Size>
+struct decode_body
+{
+  RandomAccessIterator1 values_first;
+  RandomAccessIterator2 counts_first;
+  OutputIterator result;
+  const Size* output_offsets;
+  Size run_interval_size;
+  Size n;
+  Size interval_size;
+
+  decode_body(RandomAccessIterator1 values_first,
+              RandomAccessIterator2 counts_first,
+              OutputIterator result,
+              const Size* output_offsets,
+              Size run_interval_size,
+              Size n,
+              Size interval_size)
+      : values_first(values_first)
+      , counts_first(counts_first)
+      , result(result)
+      , output_offsets(output_offsets)
+      , run_interval_size(run_interval_size)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    for (Size interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const Size offset_to_first = interval_size * interval_idx;
+      const Size offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      // start the search for the first run at the beginning of the interval
+      // of the runs which covers offset_to_first
+      Size run_interval = 0;
+      while (output_offsets[run_interval + 1] <= offset_to_first)
+      {
+        ++run_interval;
+      }
+
+      thrust::system::detail::internal::decode_runs(
+        values_first,
+        counts_first,
+        run_interval_size * run_interval,
+        output_offsets[run_interval],
+        offset_to_first,
+        offset_to_last,
+        result);
+    }
+  }
+};
+
+} // end namespace run_length_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 values_output,
+  OutputIterator2 counts_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::run_length_encode(thrust::seq, first, last, values_output, counts_output);
+  }
+
+  const difference_type num_runs = run_length_detail::encode_runs(
+    first,
+    n,
+    thrust::system::detail::internal::run_writer<RandomAccessIterator, OutputIterator1, OutputIterator2>(
+      first, values_output, counts_output));
+
+  return thrust::make_pair(values_output + num_runs, counts_output + num_runs);
+} // end run_length_encode()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator1, typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> run_length_encode_non_trivial_runs(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator1 offsets_output,
+  OutputIterator2 lengths_output)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::run_length_encode_non_trivial_runs(thrust::seq, first, last, offsets_output, lengths_output);
+  }
+
+  const difference_type num_runs = run_length_detail::encode_runs(
+    first,
+    n,
+    thrust::system::detail::internal::non_trivial_run_writer<RandomAccessIterator, OutputIterator1, OutputIterator2>(
+      first, offsets_output, lengths_output));
+
+  return thrust::make_pair(offsets_output + num_runs, lengths_output + num_runs);
+} // end run_length_encode_non_trivial_runs()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator run_length_decode(
+  execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 values_first,
+  RandomAccessIterator1 values_last,
+  RandomAccessIterator2 counts_first,
+  OutputIterator result)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  const difference_type num_runs = values_last - values_first;
+
+  if (num_runs == 0)
+  {
+    return result;
+  }
+
+  // sum the lengths of the runs in each interval of the runs
+  const difference_type run_interval_size = run_length_detail::interval_size_for(num_runs);
+  const difference_type num_run_intervals = (num_runs + run_interval_size - 1) / run_interval_size;
+
+  std::vector<difference_type> output_offsets(num_run_intervals + 1, difference_type(0));
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_run_intervals, 1),
+                      run_length_detail::sum_body<RandomAccessIterator2, difference_type>(
+                        counts_first, output_offsets.data() + 1, num_runs, run_interval_size),
+                      ::tbb::simple_partitioner());
+
+  for (difference_type i = 0; i < num_run_intervals; ++i)
+  {
+    output_offsets[i + 1] += output_offsets[i];
+  }
+
+  const difference_type n = output_offsets[num_run_intervals];
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::run_length_decode(thrust::seq, values_first, values_last, counts_first, result);
+  }
+
+  // divide the output rather than the runs, so that a few long runs don't
+  // leave all but a few threads idle
+  const difference_type interval_size = run_length_detail::interval_size_for(n);
+  const difference_type num_intervals = (n + interval_size - 1) / interval_size;
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+    run_length_detail::decode_body<RandomAccessIterator1, RandomAccessIterator2, OutputIterator, difference_type>(
+      values_first, counts_first, result, output_offsets.data(), run_interval_size, n, interval_size),
+    ::tbb::simple_partitioner());
+
+  return result + n;
+} // end run_length_decode()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
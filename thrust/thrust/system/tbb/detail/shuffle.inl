@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/shuffle.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace shuffle_detail
+{
+
+typedef thrust::system::detail::generic::feistel_bijection bijection_type;
+
+struct collect_body
+{
+  const bijection_type& bijection;
+  std::uint64_t m;
+  std::uint64_t* images;
+  std::uint64_t* counts;
+  std::uint64_t n;
+  std::uint64_t interval_size;
+
+  collect_body(const bijection_type& bijection,
+               std::uint64_t m,
+               std::uint64_t* images,
+               std::uint64_t* counts,
+               std::uint64_t n,
+               std::uint64_t interval_size)
+      : bijection(bijection)
+      , m(m)
+      , images(images)
+      , counts(counts)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<std::uint64_t>& r) const
+  {
+    for (std::uint64_t interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const std::uint64_t offset_to_first = interval_size * interval_idx;
+      const std::uint64_t offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      counts[interval_idx] = thrust::system::detail::internal::collect_shuffled(
+        bijection, m, offset_to_first, offset_to_last, images + offset_to_first);
+    }
+  }
+};
+
+template <typename RandomIterator, typename OutputIterator>
+struct gather_body
+{
+  const std::uint64_t* images;
+  std::uint64_t k;
+  RandomIterator first;
+  OutputIterator result;
+  const std::uint64_t* offsets;
+  std::uint64_t interval_size;
+
+  gather_body(const std::uint64_t* images,
+              std::uint64_t k,
+              RandomIterator first,
+              OutputIterator result,
+              const std::uint64_t* offsets,
+              std::uint64_t interval_size)
+      : images(images)
+      , k(k)
+      , first(first)
+      , result(result)
+      , offsets(offsets)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<std::uint64_t>& r) const
+  {
+    for (std::uint64_t interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      thrust::system::detail::internal::gather_shuffled(
+        images + interval_size * interval_idx,
+        offsets[interval_idx + 1] - offsets[interval_idx],
+        offsets[interval_idx],
+        k,
+        first,
+        result);
+    }
+  }
+};
+
+// gathers the first k elements of the permutation of [first, first + m)
+// defined by bijection to result
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator>
+void gather_permutation(
+  execution_policy<DerivedPolicy>& exec,
+  const bijection_type& bijection,
+  std::uint64_t m,
+  std::uint64_t k,
+  RandomIterator first,
+  OutputIterator result)
+{
+  const std::uint64_t n = bijection.nearest_power_of_two();
+
+  // generate one interval of sequential work per processor
+  const std::uint64_t p             = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+  const std::uint64_t interval_size = (n + p - 1) / p;
+  const std::uint64_t num_intervals = (n + interval_size - 1) / interval_size;
+
+  std::vector<std::uint64_t> offsets(num_intervals + 1, 0);
+
+  // every interval stores its images in its own part of the buffer
+  thrust::detail::temporary_array<std::uint64_t, DerivedPolicy> buffer(exec, n);
+  std::uint64_t* images = thrust::raw_pointer_cast(buffer.data());
+
+  // store and count the images in [0, m) of each interval
+  ::tbb::parallel_for(::tbb::blocked_range<std::uint64_t>(0, num_intervals, 1),
+                      collect_body(bijection, m, images, offsets.data() + 1, n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  for (std::uint64_t i = 0; i < num_intervals; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  ::tbb::parallel_for(
+    ::tbb::blocked_range<std::uint64_t>(0, num_intervals, 1),
+    gather_body<RandomIterator, OutputIterator>(images, k, first, result, offsets.data(), interval_size),
+    ::tbb::simple_partitioner());
+} // end gather_permutation()
+
+} // end namespace shuffle_detail
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  const std::uint64_t m = last - first;
+
+  // XXX this value is a tuning opportunity
+  const std::uint64_t parallelism_threshold = 10000;
+
+  if (m < parallelism_threshold)
+  {
+    // don't bother parallelizing for small m
+    thrust::shuffle_copy(thrust::seq, first, last, result, g);
+    return;
+  }
+
+  shuffle_detail::bijection_type bijection(m, g);
+
+  shuffle_detail::gather_permutation(exec, bijection, m, m, first, result);
+} // end shuffle_copy()
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename Size, typename URBG>
+OutputIterator sample(
+  execution_policy<DerivedPolicy>& exec,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  Size k,
+  URBG&& g)
+{
+  const std::uint64_t m = last - first;
+
+  // XXX this value is a tuning opportunity
+  const std::uint64_t parallelism_threshold = 10000;
+
+  if (m < parallelism_threshold)
+  {
+    // don't bother parallelizing for small m
+    return thrust::sample(thrust::seq, first, last, result, k, g);
+  }
+
+  shuffle_detail::bijection_type bijection(m, g);
+
+  const std::uint64_t num_selected = k > Size(0) ? (thrust::min)(static_cast<std::uint64_t>(k), m) : 0;
+
+  shuffle_detail::gather_permutation(exec, bijection, m, num_selected, first, result);
+
+  return result + num_selected;
+} // end sample()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,13 +26,21 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/minmax.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/generic/sort.h>
+#include <thrust/system/detail/internal/segments.h>
+#include <thrust/system/detail/sequential/selection.h>
 
+#include <thread>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -289,6 +297,242 @@ void stable_sort_by_key(
   sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
 
+namespace partial_sort_copy_detail
+{
+
+template <typename InputIterator, typename T, typename StrictWeakOrdering>
+struct select_body
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type size_type;
+
+  InputIterator first;
+  T* candidates;
+  StrictWeakOrdering comp;
+  size_type n;
+  size_type k;
+  size_type interval_size;
+
+  select_body(
+    InputIterator first, T* candidates, StrictWeakOrdering comp, size_type n, size_type k, size_type interval_size)
+      : first(first)
+      , candidates(candidates)
+      , comp(comp)
+      , n(n)
+      , k(k)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<size_type>& r) const
+  {
+    for (size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last  = (thrust::min)(n, offset_to_first + interval_size);
+
+      thrust::system::detail::sequential::heap_select_copy(
+        first + offset_to_first,
+        first + offset_to_last,
+        candidates + k * interval_idx,
+        candidates + k * (interval_idx + 1),
+        comp);
+    }
+  }
+};
+
+} // end namespace partial_sort_copy_detail
+
+namespace segmented_sort_detail
+{
+
+// sorts the segments which begin in each interval, except for the large ones
+template <typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+struct sort_body
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  RandomAccessIterator first;
+  OffsetIterator offsets_first;
+  StrictWeakOrdering comp;
+  segment_index num_segments;
+  offset_type begin;
+  offset_type n;
+  offset_type interval_size;
+
+  sort_body(RandomAccessIterator first,
+            OffsetIterator offsets_first,
+            StrictWeakOrdering comp,
+            segment_index num_segments,
+            offset_type begin,
+            offset_type n,
+            offset_type interval_size)
+      : first(first)
+      , offsets_first(offsets_first)
+      , comp(comp)
+      , num_segments(num_segments)
+      , begin(begin)
+      , n(n)
+      , interval_size(interval_size)
+  {}
+
+  void operator()(const ::tbb::blocked_range<segment_index>& r) const
+  {
+    using thrust::system::detail::internal::first_segment_at;
+    using thrust::system::detail::internal::is_large_segment;
+
+    for (segment_index interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      const offset_type offset_to_first = interval_size * static_cast<offset_type>(interval_idx);
+      const offset_type offset_to_last  = offset_to_first + interval_size;
+
+      const segment_index segments_begin = first_segment_at(offsets_first, num_segments, begin + offset_to_first);
+      const segment_index segments_end =
+        offset_to_last >= n ? num_segments : first_segment_at(offsets_first, num_segments, begin + offset_to_last);
+
+      for (segment_index s = segments_begin; s < segments_end; ++s)
+      {
+        if (!is_large_segment(offsets_first, s, interval_size))
+        {
+          thrust::sort(thrust::seq, first + offsets_first[s], first + offsets_first[s + 1], comp);
+        }
+      }
+    }
+  }
+};
+
+} // end namespace segmented_sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  // tbb prefers generic::nth_element to cpp::nth_element
+  thrust::system::detail::generic::nth_element(exec, first, nth, last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(execution_policy<DerivedPolicy>& exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  // tbb prefers generic::partial_sort to cpp::partial_sort
+  thrust::system::detail::generic::partial_sort(exec, first, middle, last, comp);
+}
+
+template <typename DerivedPolicy, typename InputIterator, typename RandomAccessIterator, typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  RandomAccessIterator result_first,
+  RandomAccessIterator result_last,
+  StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  const difference_type n = thrust::distance(first, last);
+  const difference_type k = thrust::min<difference_type>(result_last - result_first, n);
+
+  // XXX this value is a tuning opportunity
+  const difference_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::system::detail::sequential::heap_select_copy(first, last, result_first, result_last, comp);
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate one interval of sequential work per processor
+  const difference_type num_threads   = static_cast<difference_type>(p);
+  const difference_type interval_size = (n + num_threads - 1) / num_threads;
+  const difference_type num_intervals = (n + interval_size - 1) / interval_size;
+
+  // when the heaps would hold a sizeable part of every interval, selecting
+  // by partitioning does less work. The last interval is the smallest one.
+  // XXX this value is a tuning opportunity
+  if (8 * k > n - interval_size * (num_intervals - 1))
+  {
+    return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  // every interval selects its k candidates into a heap of its own, and the
+  // result is selected from the candidates. Every interval holds at least k
+  // elements, so every heap is full.
+  thrust::detail::temporary_array<value_type, DerivedPolicy> candidates(exec, num_intervals * k);
+  value_type* candidates_first = thrust::raw_pointer_cast(candidates.data());
+
+  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+                      partial_sort_copy_detail::select_body<InputIterator, value_type, StrictWeakOrdering>(
+                        first, candidates_first, comp, n, k, interval_size),
+                      ::tbb::simple_partitioner());
+
+  return thrust::system::detail::sequential::heap_select_copy(
+    candidates_first, candidates_first + num_intervals * k, result_first, result_last, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OffsetIterator, typename StrictWeakOrdering>
+void segmented_sort(execution_policy<DerivedPolicy>& exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator last,
+                    OffsetIterator offsets_first,
+                    OffsetIterator offsets_last,
+                    StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<OffsetIterator>::type segment_index;
+  typedef typename thrust::iterator_value<OffsetIterator>::type offset_type;
+
+  const segment_index num_segments = (offsets_last - offsets_first) - 1;
+
+  if (num_segments <= 0)
+  {
+    return;
+  }
+
+  const offset_type begin = offsets_first[0];
+  const offset_type n     = offsets_first[num_segments] - begin;
+
+  // XXX this value is a tuning opportunity
+  const offset_type parallelism_threshold = 10000;
+
+  if (n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    thrust::segmented_sort(thrust::seq, first, last, offsets_first, offsets_last, comp);
+    return;
+  }
+
+  // count the number of processors
+  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+
+  // generate one interval of sequential work per processor
+  const offset_type num_threads     = static_cast<offset_type>(p);
+  const offset_type interval_size   = (n + num_threads - 1) / num_threads;
+  const segment_index num_intervals = static_cast<segment_index>((n + interval_size - 1) / interval_size);
+
+  ::tbb::parallel_for(::tbb::blocked_range<segment_index>(0, num_intervals, 1),
+                      segmented_sort_detail::sort_body<RandomAccessIterator, OffsetIterator, StrictWeakOrdering>(
+                        first, offsets_first, comp, num_segments, begin, n, interval_size),
+                      ::tbb::simple_partitioner());
+
+  // sort the segments which are larger than an interval one after another with all threads
+  for (segment_index s = 0; s < num_segments; ++s)
+  {
+    if (thrust::system::detail::internal::is_large_segment(offsets_first, s, interval_size))
+    {
+      thrust::sort(exec, first + offsets_first[s], first + offsets_first[s + 1], comp);
+    }
+  }
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
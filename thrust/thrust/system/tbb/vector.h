@@ -33,6 +33,12 @@
 #include <thrust/detail/vector_base.h>
 #include <thrust/system/tbb/memory.h>
 
+// vector_base relocates, fills and destroys its elements with thrust::copy and
+// thrust::for_each; make sure those find this system's parallel versions instead
+// of the sequential ones tbb::tag inherits from cpp
+#include <thrust/system/tbb/detail/copy.h>
+#include <thrust/system/tbb/detail/for_each.h>
+
 #include <vector>
 
 THRUST_NAMESPACE_BEGIN
@@ -31,6 +31,8 @@
 #endif // no system header
 #include <thrust/detail/execution_policy.h>
 
+#include <cuda/std/mdspan>
+
 THRUST_NAMESPACE_BEGIN
 
 /*! \addtogroup algorithms
@@ -143,6 +145,67 @@ _CCCL_HOST_DEVICE OutputIterator transform(
 template <typename InputIterator, typename OutputIterator, typename UnaryFunction>
 OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result, UnaryFunction op);
 
+#if _CCCL_STD_VER >= 2014
+/*! This version of \p transform applies a unary function to each element
+ *  of a multidimensional array and stores the result in the element of
+ *  another multidimensional array with the same index. Specifically, for each
+ *  multidimensional index <tt>i...</tt> of <tt>input.extents()</tt> the
+ *  operation <tt>op(input(i...))</tt> is performed and the result is assigned
+ *  to <tt>result(i...)</tt>.
+ *
+ *  The index space is iterated with \p for_each_index, so the host backends
+ *  process it in cache sized tiles without dividing linear indices, which
+ *  keeps accesses to both arrays local even if their layouts differ.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param input The input array.
+ *  \param result The output array.
+ *  \param op The tranformation operation.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam UnaryFunction is a model of <a
+ * href="https://en.cppreference.com/w/cpp/utility/functional/unary_function">Unary Function</a> which accepts the
+ * \c reference of \p input and whose \c result_type is assignable to the \c reference of \p result.
+ *
+ *  \pre <tt>input.extents() == result.extents()</tt>.
+ *  \pre \p input and \p result either refer to the same elements with the same mapping or do not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p transform to store the
+ *  transpose of a row major matrix using the \p thrust::omp::par execution policy:
+ *
+ *  \code
+ *  #include <thrust/transform.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <cuda/std/mdspan>
+ *  ...
+ *  std::vector<float> a(1000 * 500), b(1000 * 500);
+ *  cuda::std::mdspan<float, cuda::std::dextents<int, 2>> in(a.data(), 1000, 500);
+ *  cuda::std::mdspan<float, cuda::std::dextents<int, 2>, cuda::std::layout_left> out(b.data(), 1000, 500);
+ *
+ *  thrust::transform(thrust::omp::par, in, out, thrust::identity<float>());
+ *  \endcode
+ *
+ *  \see for_each_index
+ */
+template <typename DerivedPolicy,
+          typename T1,
+          typename Extents1,
+          typename Layout1,
+          typename Accessor1,
+          typename T2,
+          typename Extents2,
+          typename Layout2,
+          typename Accessor2,
+          typename UnaryFunction>
+_CCCL_HOST_DEVICE void transform(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                 ::cuda::std::mdspan<T1, Extents1, Layout1, Accessor1> input,
+                                 ::cuda::std::mdspan<T2, Extents2, Layout2, Accessor2> result,
+                                 UnaryFunction op);
+#endif // _CCCL_STD_VER >= 2014
+
 /*! This version of \p transform applies a binary function to each pair
  *  of elements from two input sequences and stores the result in the
  *  corresponding position in an output sequence.  Specifically, for